@@ -13,6 +13,10 @@
 #include <zephyr/logging/log.h>
 #include <zephyr/rtio/work.h>
 
+#if defined(CONFIG_CMSIS_DSP_SUPPORT) && defined(CONFIG_CMSIS_DSP_BASICMATH)
+#include <arm_math.h>
+#endif
+
 LOG_MODULE_REGISTER(sensor_compat, CONFIG_SENSOR_LOG_LEVEL);
 
 /*
@@ -533,3 +537,164 @@ const struct sensor_decoder_api __sensor_default_decoder = {
 	.get_size_info = sensor_natively_supported_channel_size_info,
 	.decode = decode,
 };
+
+static int decode_bulk_chunked(struct sensor_decode_context *ctx, struct sensor_bulk_data *out,
+			       uint16_t max_count)
+{
+	const struct sensor_decoder_api *decoder = ctx->decoder;
+	union {
+		struct sensor_three_axis_data three_axis;
+		struct sensor_q31_data q31;
+		uint8_t raw[sizeof(struct sensor_three_axis_data) +
+			    (CONFIG_SENSOR_DECODE_BULK_CHUNK_SIZE - 1) *
+				    sizeof(struct sensor_three_axis_sample_data)];
+	} chunk;
+	size_t base_size, frame_size;
+	uint16_t num_axes;
+	uint16_t total = 0;
+	int rc;
+
+	switch (ctx->channel.chan_type) {
+	case SENSOR_CHAN_ACCEL_XYZ:
+	case SENSOR_CHAN_GYRO_XYZ:
+	case SENSOR_CHAN_MAGN_XYZ:
+	case SENSOR_CHAN_POS_DXYZ:
+		num_axes = 3;
+		break;
+	default:
+		num_axes = 1;
+		rc = decoder->get_size_info(ctx->channel, &base_size, &frame_size);
+		if (rc != 0) {
+			return rc;
+		}
+		if (base_size != sizeof(struct sensor_q31_data) ||
+		    frame_size != sizeof(struct sensor_q31_sample_data)) {
+			return -ENOTSUP;
+		}
+		break;
+	}
+
+	while (total < max_count) {
+		uint16_t n = MIN(max_count - total, CONFIG_SENSOR_DECODE_BULK_CHUNK_SIZE);
+		uint32_t fit = ctx->fit;
+		uint64_t base_timestamp_ns;
+		int8_t shift;
+
+		rc = decoder->decode(ctx->buffer, ctx->channel, &fit, n, &chunk);
+		if (rc <= 0) {
+			return (total > 0) ? total : rc;
+		}
+
+		if (num_axes == 3) {
+			base_timestamp_ns = chunk.three_axis.header.base_timestamp_ns;
+			shift = chunk.three_axis.shift;
+		} else {
+			base_timestamp_ns = chunk.q31.header.base_timestamp_ns;
+			shift = chunk.q31.shift;
+		}
+
+		if (total == 0) {
+			out->base_timestamp_ns = base_timestamp_ns;
+			out->shift = shift;
+		} else if (base_timestamp_ns != out->base_timestamp_ns || shift != out->shift) {
+			/* Leave the frame iterator alone, the next call starts from here */
+			break;
+		}
+
+		/* Separate loops per array so that each one is a plain strided copy */
+		if (num_axes == 3) {
+			const struct sensor_three_axis_sample_data *r = chunk.three_axis.readings;
+
+			if (out->timestamp_delta != NULL) {
+				for (int i = 0; i < rc; i++) {
+					out->timestamp_delta[total + i] = r[i].timestamp_delta;
+				}
+			}
+			for (int axis = 0; axis < 3; axis++) {
+				q31_t *values = out->values[axis];
+
+				if (values == NULL) {
+					continue;
+				}
+				for (int i = 0; i < rc; i++) {
+					values[total + i] = r[i].values[axis];
+				}
+			}
+		} else {
+			const struct sensor_q31_sample_data *r = chunk.q31.readings;
+
+			if (out->timestamp_delta != NULL) {
+				for (int i = 0; i < rc; i++) {
+					out->timestamp_delta[total + i] = r[i].timestamp_delta;
+				}
+			}
+			if (out->values[0] != NULL) {
+				for (int i = 0; i < rc; i++) {
+					out->values[0][total + i] = r[i].value;
+				}
+			}
+		}
+
+		ctx->fit = fit;
+		total += rc;
+
+		if (rc < n) {
+			/* The decoder ran out of frames */
+			break;
+		}
+	}
+
+	return total;
+}
+
+int sensor_decode_bulk(struct sensor_decode_context *ctx, struct sensor_bulk_data *out,
+		       uint16_t max_count)
+{
+	const struct sensor_decoder_api *decoder = ctx->decoder;
+	int rc;
+
+	if (max_count == 0) {
+		return 0;
+	}
+
+	if (decoder->decode_bulk != NULL) {
+		rc = decoder->decode_bulk(ctx->buffer, ctx->channel, &ctx->fit, max_count, out);
+		if (rc != -ENOTSUP) {
+			return rc;
+		}
+	}
+
+	return decode_bulk_chunked(ctx, out, max_count);
+}
+
+/* 2^exp, exact for the exponents a q31 shift can lead to and without needing libm */
+static float pow2f(int exp)
+{
+	float value = 1.0f;
+
+	for (; exp > 0; exp--) {
+		value *= 2.0f;
+	}
+	for (; exp < 0; exp++) {
+		value *= 0.5f;
+	}
+
+	return value;
+}
+
+void sensor_q31_to_float_array(const q31_t *values, int8_t shift, float *out, size_t count)
+{
+#if defined(CONFIG_CMSIS_DSP_SUPPORT) && defined(CONFIG_CMSIS_DSP_BASICMATH)
+	arm_q31_to_float(values, out, count);
+	if (shift != 0) {
+		arm_scale_f32(out, pow2f(shift), out, count);
+	}
+#else
+	/* One multiply per value and no branches, so that the loop can be vectorized */
+	const float scale = pow2f(shift - 31);
+
+	for (size_t i = 0; i < count; i++) {
+		out[i] = (float)values[i] * scale;
+	}
+#endif
+}
@@ -411,6 +411,79 @@ static int icm42688_fifo_decode(const uint8_t *buffer, struct sensor_chan_spec c
 	return count;
 }
 
+static int icm42688_fifo_decode_bulk(const uint8_t *buffer, struct sensor_chan_spec chan_spec,
+				     uint32_t *fit, uint16_t max_count,
+				     struct sensor_bulk_data *data_out)
+{
+	const struct icm42688_fifo_data *edata = (const struct icm42688_fifo_data *)buffer;
+	const uint8_t *buffer_end = buffer + sizeof(struct icm42688_fifo_data) + edata->fifo_count;
+	const bool is_accel = chan_spec.chan_type == SENSOR_CHAN_ACCEL_XYZ;
+	const uint8_t header_mask = is_accel ? FIFO_HEADER_ACCEL : FIFO_HEADER_GYRO;
+	const int fs = is_accel ? edata->header.accel_fs : edata->header.gyro_fs;
+	const uint32_t period_ns =
+		is_accel ? accel_period_ns[edata->accel_odr] : gyro_period_ns[edata->gyro_odr];
+	uint32_t frame_count = 0;
+	int count = 0;
+
+	if (chan_spec.chan_type != SENSOR_CHAN_ACCEL_XYZ &&
+	    chan_spec.chan_type != SENSOR_CHAN_GYRO_XYZ) {
+		return -ENOTSUP;
+	}
+
+	if ((uintptr_t)buffer_end <= *fit || chan_spec.chan_idx != 0) {
+		return 0;
+	}
+
+	/* Everything that is the same for all frames is only looked up once */
+	data_out->base_timestamp_ns = edata->header.timestamp;
+	icm42688_get_shift(chan_spec.chan_type, edata->header.accel_fs, edata->header.gyro_fs,
+			   &data_out->shift);
+
+	buffer += sizeof(struct icm42688_fifo_data);
+	while (count < max_count && buffer < buffer_end) {
+		const uint8_t *frame_end = buffer;
+
+		if (FIELD_GET(FIFO_HEADER_20, buffer[0]) == 1) {
+			frame_end += 20;
+		} else if ((buffer[0] & (FIFO_HEADER_ACCEL | FIFO_HEADER_GYRO)) ==
+			   (FIFO_HEADER_ACCEL | FIFO_HEADER_GYRO)) {
+			frame_end += 16;
+		} else {
+			frame_end += 8;
+		}
+
+		if ((buffer[0] & header_mask) == 0) {
+			/* No sample of this channel in the frame */
+			buffer = frame_end;
+			continue;
+		}
+
+		frame_count++;
+		if ((uintptr_t)buffer < *fit) {
+			/* This frame was already decoded, move on to the next frame */
+			buffer = frame_end;
+			continue;
+		}
+
+		if (data_out->timestamp_delta != NULL) {
+			data_out->timestamp_delta[count] = (frame_count - 1) * period_ns;
+		}
+		for (uint8_t axis = 0; axis < 3; axis++) {
+			q31_t value;
+
+			icm42688_read_imu_from_packet(buffer, is_accel, fs, axis, &value);
+			if (data_out->values[axis] != NULL) {
+				data_out->values[axis][count] = value;
+			}
+		}
+
+		buffer = frame_end;
+		*fit = (uintptr_t)frame_end;
+		count++;
+	}
+	return count;
+}
+
 static int icm42688_one_shot_decode(const uint8_t *buffer, struct sensor_chan_spec chan_spec,
 				    uint32_t *fit, uint16_t max_count, void *data_out)
 {
@@ -510,6 +583,20 @@ static int icm42688_decoder_decode(const uint8_t *buffer, struct sensor_chan_spe
 	return icm42688_one_shot_decode(buffer, chan_spec, fit, max_count, data_out);
 }
 
+static int icm42688_decoder_decode_bulk(const uint8_t *buffer, struct sensor_chan_spec chan_spec,
+					uint32_t *fit, uint16_t max_count,
+					struct sensor_bulk_data *data_out)
+{
+	const struct icm42688_decoder_header *header =
+		(const struct icm42688_decoder_header *)buffer;
+
+	if (!header->is_fifo) {
+		/* A single frame, nothing to gain over the generic path */
+		return -ENOTSUP;
+	}
+	return icm42688_fifo_decode_bulk(buffer, chan_spec, fit, max_count, data_out);
+}
+
 static int icm42688_decoder_get_frame_count(const uint8_t *buffer,
 					    struct sensor_chan_spec chan_spec,
 					    uint16_t *frame_count)
@@ -629,6 +716,7 @@ SENSOR_DECODER_API_DT_DEFINE() = {
 	.get_size_info = icm42688_decoder_get_size_info,
 	.decode = icm42688_decoder_decode,
 	.has_trigger = icm24688_decoder_has_trigger,
+	.decode_bulk = icm42688_decoder_decode_bulk,
 };
 
 int icm42688_get_decoder(const struct device *dev, const struct sensor_decoder_api **decoder)
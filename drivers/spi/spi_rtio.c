@@ -22,7 +22,7 @@ static void spi_rtio_iodev_default_submit_sync(struct rtio_iodev_sqe *iodev_sqe)
 {
 	struct spi_dt_spec *dt_spec = iodev_sqe->sqe.iodev->data;
 	const struct device *dev = dt_spec->bus;
-	uint8_t num_msgs = 0;
+	size_t num_msgs = 0;
 	int err = 0;
 
 	LOG_DBG("Sync RTIO work item for: %p", (void *)dev);
@@ -46,6 +46,16 @@ static void spi_rtio_iodev_default_submit_sync(struct rtio_iodev_sqe *iodev_sqe)
 		case RTIO_OP_TXRX:
 			num_msgs++;
 			break;
+		case RTIO_OP_RXV:
+		case RTIO_OP_TXV:
+			if (txn_curr->sqe.iov.iov_cnt == 0) {
+				LOG_ERR("Empty vector for submission %p", (void *)&txn_curr->sqe);
+				err = -EINVAL;
+				break;
+			}
+			/* One message per segment */
+			num_msgs += txn_curr->sqe.iov.iov_cnt;
+			break;
 		default:
 			LOG_ERR("Invalid op code %d for submission %p", txn_curr->sqe.op,
 				(void *)&txn_curr->sqe);
@@ -88,6 +98,8 @@ static void spi_rtio_iodev_default_submit_sync(struct rtio_iodev_sqe *iodev_sqe)
 
 	for (size_t i = 0 ; i < num_msgs ; i++) {
 		struct rtio_sqe *sqe = &txn_curr->sqe;
+		const struct rtio_iovec *iov;
+		uint16_t iov_cnt;
 
 		switch (sqe->op) {
 		case RTIO_OP_RX:
@@ -114,6 +126,20 @@ static void spi_rtio_iodev_default_submit_sync(struct rtio_iodev_sqe *iodev_sqe)
 			tx_bufs[i].buf = (uint8_t *)sqe->txrx.tx_buf;
 			tx_bufs[i].len = sqe->txrx.buf_len;
 			break;
+		case RTIO_OP_RXV:
+		case RTIO_OP_TXV:
+			iov = rtio_sqe_iov(txn_curr, &iov_cnt);
+			for (uint16_t j = 0; j < iov_cnt; j++, i++) {
+				bool rx = sqe->op == RTIO_OP_RXV;
+
+				rx_bufs[i].buf = rx ? iov[j].buf : NULL;
+				rx_bufs[i].len = iov[j].buf_len;
+				tx_bufs[i].buf = rx ? NULL : iov[j].buf;
+				tx_bufs[i].len = iov[j].buf_len;
+			}
+			/* Loop increments past the last segment */
+			i--;
+			break;
 		default:
 			err = -EIO;
 			break;
@@ -97,6 +97,12 @@ struct disk_info {
 	const struct device *dev;
 	/** Internally used disk reference count */
 	uint16_t refcnt;
+#if defined(CONFIG_DISK_CACHE) || defined(__DOXYGEN__)
+	/** Internally used number of sectors, 0 if disk is not cached */
+	uint32_t cache_sector_count;
+	/** Internally used sector following the last read, to detect sequential reads */
+	uint32_t cache_next_sector;
+#endif
 };
 
 /**
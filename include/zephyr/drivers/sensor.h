@@ -536,6 +536,26 @@ struct sensor_decoder_api {
 	 * @return Whether the trigger is present in the buffer
 	 */
 	bool (*has_trigger)(const uint8_t *buffer, enum sensor_trigger_type trigger);
+
+	/**
+	 * @brief Decode up to @p max_count samples into one array per axis
+	 *
+	 * Optional fast path of sensor_decode_bulk(). Decoders reading packed hardware FIFO
+	 * frames can write the values straight into @p data_out instead of going through
+	 * @ref decode and a transpose.
+	 *
+	 * @param[in]     buffer The buffer provided on the @ref rtio context
+	 * @param[in]     channel The channel to decode
+	 * @param[in,out] fit The current frame iterator
+	 * @param[in]     max_count The maximum number of samples to decode
+	 * @param[out]    data_out The decoded data
+	 * @return 0 no more samples to decode
+	 * @return >0 the number of decoded samples
+	 * @return -ENOTSUP to have sensor_decode_bulk() fall back to @ref decode
+	 * @return <0 on error
+	 */
+	int (*decode_bulk)(const uint8_t *buffer, struct sensor_chan_spec channel, uint32_t *fit,
+			   uint16_t max_count, struct sensor_bulk_data *data_out);
 };
 
 /**
@@ -593,6 +613,41 @@ static inline int sensor_decode(struct sensor_decode_context *ctx, void *out, ui
 	return ctx->decoder->decode(ctx->buffer, ctx->channel, &ctx->fit, max_count, out);
 }
 
+/**
+ * @brief Decode N samples of a q31 channel into one array per axis
+ *
+ * Decodes the samples of a buffer in one pass into @ref sensor_bulk_data, which is easier
+ * to process in bulk than the array of structures used by sensor_decode(). Decoders
+ * implementing @ref sensor_decoder_api.decode_bulk are used directly, others are decoded
+ * with @ref sensor_decoder_api.decode a few frames at a time.
+ *
+ * All samples returned by one call share @ref sensor_bulk_data.shift and
+ * @ref sensor_bulk_data.base_timestamp_ns. If they change within the buffer, decoding stops
+ * before the first sample which differs and the next call starts from it.
+ *
+ * @param[in,out] ctx The context to use for decoding
+ * @param[out]    out The output arrays, each large enough for @p max_count samples
+ * @param[in]     max_count Maximum number of samples to decode
+ * @return 0 no more samples to decode
+ * @return >0 the number of decoded samples
+ * @return -ENOTSUP if the channel is not a q31 channel
+ * @return <0 on error
+ */
+int sensor_decode_bulk(struct sensor_decode_context *ctx, struct sensor_bulk_data *out,
+		       uint16_t max_count);
+
+/**
+ * @brief Convert an array of q31 values to floats
+ *
+ * Uses CMSIS-DSP when it is enabled, otherwise a plain loop the compiler can vectorize.
+ *
+ * @param[in]  values The q31 values, such as an array of @ref sensor_bulk_data
+ * @param[in]  shift The shift of @p values
+ * @param[out] out The converted values, can't overlap @p values
+ * @param[in]  count Number of values to convert
+ */
+void sensor_q31_to_float_array(const q31_t *values, int8_t shift, float *out, size_t count);
+
 int sensor_natively_supported_channel_size_info(struct sensor_chan_spec channel, size_t *base_size,
 						size_t *frame_size);
 
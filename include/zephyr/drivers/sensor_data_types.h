@@ -195,6 +195,24 @@ struct sensor_uint64_data {
 	(data_).header.base_timestamp_ns + (data_).readings[(readings_offset_)].timestamp_delta,   \
 		(data_).readings[(readings_offset_)].value
 
+/**
+ * Structure of arrays form of decoded q31 data, filled by :c:func:`sensor_decode_bulk`.
+ *
+ * Reading ``i`` of axis ``a`` is stored at ``values[a][i]``. Three axis channels fill all three
+ * value arrays, other q31 channels only ``values[0]``. Arrays which are not needed can be left
+ * NULL and are skipped. All readings share the same base timestamp and shift.
+ */
+struct sensor_bulk_data {
+	/** Timestamp of the readings, see :c:struct:`sensor_data_header` */
+	uint64_t base_timestamp_ns;
+	/** Offset of each reading from base_timestamp_ns, may be NULL */
+	uint32_t *timestamp_delta;
+	/** Readings of each axis, any of them may be NULL */
+	q31_t *values[3];
+	/** Shift of all the readings */
+	int8_t shift;
+};
+
 #ifdef __cplusplus
 }
 #endif
@@ -62,6 +62,26 @@ struct nvs_fs {
 #if CONFIG_NVS_LOOKUP_CACHE
 	uint32_t lookup_cache[CONFIG_NVS_LOOKUP_CACHE_SIZE];
 #endif
+#if CONFIG_NVS_WRITE_COMBINE
+	/** Data not yet programmed, starting at @ref nvs_fs.wc_data_addr */
+	uint8_t wc_data[CONFIG_NVS_WRITE_COMBINE_SIZE];
+	/** ATEs not yet programmed, ending at the end of the buffer */
+	uint8_t wc_ate[CONFIG_NVS_WRITE_COMBINE_SIZE];
+	/** Address of the first byte in @ref nvs_fs.wc_data */
+	uint32_t wc_data_addr;
+	/** Address of the last ATE in @ref nvs_fs.wc_ate */
+	uint32_t wc_ate_addr;
+	/** Number of bytes in @ref nvs_fs.wc_data */
+	uint16_t wc_data_len;
+	/** Number of bytes in @ref nvs_fs.wc_ate */
+	uint16_t wc_ate_len;
+#endif
+#if CONFIG_NVS_GC_ASYNC
+	/** Work item switching sector and collecting garbage in the background */
+	struct k_work gc_work;
+	/** Sector left nearly full by the background garbage collection */
+	uint16_t gc_async_sector;
+#endif
 };
 
 /**
@@ -78,6 +98,9 @@ struct nvs_fs {
 /**
  * @brief Mount an NVS file system onto the flash device specified in @p fs.
  *
+ * With CONFIG_NVS_WRITE_COMBINE, writes of a previous mount that were not flushed
+ * are dropped, call nvs_flush() before remounting to keep them.
+ *
  * @param fs Pointer to file system
  * @retval 0 Success
  * @retval -ERRNO errno code if error
@@ -188,6 +211,21 @@ size_t nvs_sector_max_data_size(struct nvs_fs *fs);
  */
 int nvs_sector_use_next(struct nvs_fs *fs);
 
+/**
+ * @brief Program the writes gathered by the write combining buffer.
+ *
+ * With CONFIG_NVS_WRITE_COMBINE, nvs_write() and nvs_delete() may return before the
+ * entry is programmed to flash. Entries are readable right away but are lost on power
+ * failure until they are flushed. Writes are flushed when the buffer is full, before a
+ * sector is erased and by this routine. If programming them fails the file system is
+ * no longer ready and has to be mounted again, which rebuilds it from the flash content.
+ *
+ * @param fs Pointer to the file system.
+ *
+ * @return 0 on success. On error, returns negative value of errno.h defined error codes.
+ */
+int nvs_flush(struct nvs_fs *fs);
+
 /**
  * @}
  */
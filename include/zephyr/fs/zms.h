@@ -31,6 +31,14 @@ extern "C" {
  * @{
  */
 
+/** Entry of the ZMS lookup index */
+struct zms_lookup_index_entry {
+	/** Address of the latest ATE of the ID, all ones if the entry is free */
+	uint64_t addr;
+	/** ID of the entry */
+	uint32_t id;
+};
+
 /** Zephyr Memory Storage file system structure */
 struct zms_fs {
 	/** File system offset in flash */
@@ -65,6 +73,34 @@ struct zms_fs {
 	/** Lookup table used to cache ATE addresses of written IDs */
 	uint64_t lookup_cache[CONFIG_ZMS_LOOKUP_CACHE_SIZE];
 #endif
+#if CONFIG_ZMS_LOOKUP_INDEX
+	/** Hash table holding the address of the latest ATE of every stored ID */
+	struct zms_lookup_index_entry lookup_index[CONFIG_ZMS_LOOKUP_INDEX_SIZE];
+	/** Number of IDs in `lookup_index` */
+	uint32_t lookup_index_count;
+	/** Flag indicating if `lookup_index` holds every stored ID */
+	bool lookup_index_valid;
+#endif
+#if CONFIG_ZMS_WRITE_COMBINE
+	/** Data not yet written, starting at `wc_data_addr` */
+	uint8_t wc_data[CONFIG_ZMS_WRITE_COMBINE_SIZE];
+	/** ATEs not yet written, ending at the end of the buffer */
+	uint8_t wc_ate[CONFIG_ZMS_WRITE_COMBINE_SIZE];
+	/** Address of the first byte in `wc_data` */
+	uint64_t wc_data_addr;
+	/** Address of the last ATE in `wc_ate` */
+	uint64_t wc_ate_addr;
+	/** Number of bytes in `wc_data` */
+	uint16_t wc_data_len;
+	/** Number of bytes in `wc_ate` */
+	uint16_t wc_ate_len;
+#endif
+#if CONFIG_ZMS_GC_ASYNC
+	/** Work item switching sector and collecting garbage in the background */
+	struct k_work gc_work;
+	/** Sector left nearly full by the background garbage collection */
+	uint32_t gc_async_sector;
+#endif
 };
 
 /**
@@ -80,6 +116,9 @@ struct zms_fs {
 /**
  * @brief Mount a ZMS file system onto the device specified in `fs`.
  *
+ * With CONFIG_ZMS_WRITE_COMBINE, the entries of a previous mount that were not flushed are
+ * dropped, call zms_flush() before remounting to keep them.
+ *
  * @param fs Pointer to the file system.
  *
  * @retval 0 on success.
@@ -237,6 +276,23 @@ size_t zms_active_sector_free_space(struct zms_fs *fs);
  */
 int zms_sector_use_next(struct zms_fs *fs);
 
+/**
+ * @brief Write the entries gathered by the write combining buffer to the storage.
+ *
+ * With CONFIG_ZMS_WRITE_COMBINE, zms_write() and zms_delete() may return before the
+ * entry is written to the storage. Entries are readable right away but are lost on power
+ * failure until they are flushed. Entries are flushed when the buffer is full, before a
+ * sector is erased and by this function. If writing them fails the file system is no
+ * longer ready and has to be mounted again, which rebuilds it from the storage content.
+ *
+ * @param fs Pointer to the file system.
+ *
+ * @retval 0 on success.
+ * @retval -EACCES if ZMS is still not initialized.
+ * @retval -EIO if there is a memory write error, the file system must be mounted again.
+ */
+int zms_flush(struct zms_fs *fs);
+
 /**
  * @}
  */
@@ -961,6 +961,41 @@ __syscall void k_thread_priority_set(k_tid_t thread, int prio);
 __syscall void k_thread_deadline_set(k_tid_t thread, int deadline);
 #endif
 
+#ifdef CONFIG_SCHED_DEADLINE_CBS
+/**
+ * @brief Set a constant bandwidth server reservation for a thread
+ *
+ * Reserves @a budget_us of CPU time for @a thread in every period of
+ * @a period_us. The thread's deadline is then managed by the kernel: it
+ * is set one period from now, and when the thread exhausts its budget
+ * before the deadline it is throttled until the deadline, at which point
+ * the budget is replenished and the deadline moves one period ahead.
+ * A thread waking up after blocking gets a fresh budget and deadline if
+ * keeping the old ones would exceed its reserved bandwidth.
+ *
+ * Deadlines only order threads of the same static priority, so threads
+ * with reservations are expected to share one priority level.
+ *
+ * A reservation is only accepted if the sum of budget/period over all
+ * reservations stays within
+ * @kconfig{CONFIG_SCHED_DEADLINE_CBS_MAX_UTILIZATION}. Passing a zero
+ * budget removes the thread's reservation.
+ *
+ * @note You should enable @kconfig{CONFIG_SCHED_DEADLINE_CBS} in your
+ * project configuration.
+ *
+ * @param thread Thread to configure
+ * @param budget_us Runtime budget per period, in microseconds
+ * @param period_us Reservation period, in microseconds
+ *
+ * @retval 0 Reservation set (or removed)
+ * @retval -EINVAL Budget larger than period, zero period or dead thread
+ * @retval -EBUSY Admission control rejected the reservation
+ */
+__syscall int k_thread_cbs_set(k_tid_t thread, uint32_t budget_us,
+			       uint32_t period_us);
+#endif /* CONFIG_SCHED_DEADLINE_CBS */
+
 /**
  * @brief Invoke the scheduler
  *
@@ -3636,6 +3671,37 @@ void k_work_queue_start(struct k_work_q *queue,
  */
 static inline k_tid_t k_work_queue_thread_get(struct k_work_q *queue);
 
+/** @brief Add a worker thread to a work queue.
+ *
+ * The new thread processes items of @p queue alongside the thread given to
+ * k_work_queue_start(), so independent work items may run in parallel on
+ * SMP systems.  A given work item is never run by two workers at the same
+ * time, and flush, cancel and drain operations behave as they do for a
+ * single threaded queue.  The worker inherits the no-yield and essential
+ * settings of the queue.
+ *
+ * Worker threads stop together with the queue in k_work_queue_stop().
+ *
+ * @kconfig_dep{CONFIG_WORKQUEUE_WORKERS}
+ *
+ * @param queue pointer to a started queue.
+ * @param thread thread object for the worker.
+ * @param stack pointer to the worker thread stack area.
+ * @param stack_size size of the worker thread stack area, in bytes.
+ * @param prio initial thread priority.
+ * @param cpu CPU the worker is pinned to, or -1 to let it run on any CPU.
+ *
+ * @retval 0 if the worker was added and started
+ * @retval -ENODEV if the queue is not started
+ * @retval -ENOMEM if the queue already has CONFIG_WORKQUEUE_WORKERS_MAX
+ *         additional workers
+ * @retval -EINVAL if @p cpu is not a valid CPU index
+ * @retval -ENOTSUP if @p cpu is given but CONFIG_SCHED_CPU_MASK is disabled
+ */
+int k_work_queue_add_worker(struct k_work_q *queue, struct k_thread *thread,
+			    k_thread_stack_t *stack, size_t stack_size,
+			    int prio, int cpu);
+
 /** @brief Wait until the work queue has drained, optionally plugging it.
  *
  * This blocks submission to the work queue except when coming from queue
@@ -4128,6 +4194,10 @@ struct k_work_delayable {
 struct z_work_flusher {
 	struct k_work work;
 	struct k_sem sem;
+#ifdef CONFIG_WORKQUEUE_WORKERS
+	/* The work item being flushed. */
+	struct k_work *target;
+#endif
 };
 
 /* Record used to wait for work to complete a cancellation.
@@ -4219,6 +4289,20 @@ struct k_work_q {
 
 	/* Flags describing queue state. */
 	uint32_t flags;
+
+#ifdef CONFIG_WORKQUEUE_WORKERS
+	/* Threads added with k_work_queue_add_worker(). */
+	struct k_thread *workers[CONFIG_WORKQUEUE_WORKERS_MAX];
+
+	/* Number of entries in workers. */
+	uint8_t num_workers;
+
+	/* Number of worker threads, including thread, not yet stopped. */
+	uint8_t live;
+
+	/* Number of work items being run by the worker threads. */
+	uint16_t running;
+#endif
 };
 
 /* Provide the implementation for inline functions declared above */
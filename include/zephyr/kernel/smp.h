@@ -8,6 +8,8 @@
 #define ZEPHYR_INCLUDE_KERNEL_SMP_H_
 
 #include <stdbool.h>
+#include <stdint.h>
+#include <zephyr/kernel.h>
 
 typedef void (*smp_init_fn)(void *arg);
 
@@ -68,4 +70,84 @@ void k_smp_cpu_start(int id, smp_init_fn fn, void *arg);
 void k_smp_cpu_resume(int id, smp_init_fn fn, void *arg,
 		      bool reinit_timer, bool invoke_sched);
 
+#if defined(CONFIG_SCHED_IPI_WORK) || defined(__DOXYGEN__)
+
+struct k_ipi_work;
+
+/**
+ * @brief Cross-CPU function call handler
+ *
+ * Runs in the scheduling IPI handler (ISR context) of each target CPU.
+ *
+ * @param work The work item that was queued.
+ */
+typedef void (*k_ipi_func_t)(struct k_ipi_work *work);
+
+/**
+ * @brief Cross-CPU function call item
+ *
+ * The item is owned by the caller and must remain valid until every
+ * targeted CPU has executed it (see @ref k_ipi_work_wait).
+ */
+struct k_ipi_work {
+	/** @cond INTERNAL_HIDDEN */
+	sys_snode_t node[CONFIG_MP_MAX_NUM_CPUS];
+	k_ipi_func_t func;
+	atomic_t pending;
+	/** @endcond */
+};
+
+/**
+ * @brief Initialize a cross-CPU function call item.
+ *
+ * @param work Work item to initialize.
+ */
+void k_ipi_work_init(struct k_ipi_work *work);
+
+/**
+ * @brief Queue a function for execution on other CPUs.
+ *
+ * The function is queued on every CPU in @a cpu_bitmask except the
+ * calling CPU, and the corresponding IPIs are flagged as pending. The
+ * IPIs are sent at the next scheduling point or by an explicit call to
+ * @ref k_ipi_work_signal, which allows several items to be queued and
+ * delivered with a single IPI per CPU.
+ *
+ * @param work Initialized work item.
+ * @param cpu_bitmask Bitmask of CPUs on which @a func is to be executed.
+ * @param func Function to execute.
+ *
+ * @retval 0 Work item queued.
+ * @retval -EBUSY Work item is still pending on at least one CPU.
+ * @retval -EINVAL No CPU other than the calling one was targeted.
+ */
+int k_ipi_work_add(struct k_ipi_work *work, uint32_t cpu_bitmask,
+		   k_ipi_func_t func);
+
+/**
+ * @brief Send all pending IPIs.
+ *
+ * Delivers the IPIs flagged by @ref k_ipi_work_add (and any pending
+ * scheduling IPIs) immediately.
+ */
+void k_ipi_work_signal(void);
+
+/**
+ * @brief Wait for a cross-CPU function call to complete on all CPUs.
+ *
+ * Completion is polled, yielding the CPU between checks when called
+ * from a thread. The targeted CPUs only run the function from their
+ * IPI handler, so the wait is normally short.
+ *
+ * @param work Work item previously passed to @ref k_ipi_work_add.
+ * @param timeout Maximum time to wait.
+ *
+ * @retval 0 All targeted CPUs have executed the work item.
+ * @retval -EAGAIN Waiting period timed out.
+ * @retval -EBUSY Returned without waiting.
+ */
+int k_ipi_work_wait(struct k_ipi_work *work, k_timeout_t timeout);
+
+#endif /* CONFIG_SCHED_IPI_WORK */
+
 #endif /* ZEPHYR_INCLUDE_KERNEL_SMP_H_ */
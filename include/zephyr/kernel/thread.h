@@ -54,6 +54,20 @@ struct _pipe_desc {
 	struct k_thread *thread;         /* Back pointer to pended thread */
 };
 
+#ifdef CONFIG_SCHED_DEADLINE_CBS
+/* Constant bandwidth server state, in k_cycle_get_32() units */
+struct _thread_cbs {
+	/* Runtime allowed per period, zero when no reservation is set */
+	uint32_t budget;
+	uint32_t period;
+	/* Budget left before the current deadline */
+	int32_t remaining;
+	/* Budget exhausted, waiting for replenishment */
+	bool throttled;
+	struct _timeout replenish;
+};
+#endif /* CONFIG_SCHED_DEADLINE_CBS */
+
 /* can be used for creating 'dummy' threads, e.g. for pending on objects */
 struct _thread_base {
 
@@ -105,6 +119,11 @@ struct _thread_base {
 	int prio_deadline;
 #endif /* CONFIG_SCHED_DEADLINE */
 
+#ifdef CONFIG_SCHED_DEADLINE_CBS
+	/* Constant bandwidth server reservation */
+	struct _thread_cbs cbs;
+#endif /* CONFIG_SCHED_DEADLINE_CBS */
+
 #if defined(CONFIG_SCHED_SCALABLE) || defined(CONFIG_WAITQ_SCALABLE)
 	uint32_t order_key;
 #endif
@@ -24,6 +24,7 @@
 #include <zephyr/sys/atomic.h>
 #include <zephyr/types.h>
 #include <zephyr/sys/dlist.h>
+#include <zephyr/sys/slist.h>
 #include <zephyr/sys/util.h>
 #include <zephyr/sys/sys_heap.h>
 #include <zephyr/arch/structs.h>
@@ -178,6 +179,11 @@ struct _cpu {
 	uint8_t swap_ok;
 #endif
 
+#ifdef CONFIG_SCHED_IPI_WORK
+	/* Cross-CPU function calls waiting to run on this CPU */
+	sys_slist_t ipi_workq;
+#endif
+
 #ifdef CONFIG_SCHED_THREAD_USAGE
 	/*
 	 * [usage0] is used as a timestamp to mark the beginning of an
@@ -305,6 +311,10 @@ struct _timeout {
 #else
 	int32_t dticks;
 #endif
+#ifdef CONFIG_TIMEOUT_QUEUE_PER_CPU
+	/* CPU whose timeout queue holds this timeout */
+	uint8_t cpu;
+#endif
 };
 
 typedef void (*k_thread_timeslice_fn_t)(struct k_thread *thread, void *data);
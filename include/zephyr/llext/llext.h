@@ -129,6 +129,11 @@ struct llext {
 	elf_shdr_t *sect_hdrs;
 	bool sect_hdrs_on_heap;
 	bool mmu_permissions_set;
+#ifdef CONFIG_LLEXT_LOAD_CACHE
+	bool cacheable;
+	uint32_t cache_key;
+	void *cache_data;
+#endif
 	/** @endcond */
 };
 
@@ -176,6 +181,17 @@ struct llext_load_param {
 	 *       before the extension can be unloaded via @ref llext_unload.
 	 */
 	bool keep_section_info;
+
+	/**
+	 * Keep the extension relocated in memory when it is unloaded, so that
+	 * loading the same ELF file under the same name again is fast.
+	 * Ignored unless @kconfig{CONFIG_LLEXT_LOAD_CACHE} is enabled, and when
+	 * @ref llext_load_param.keep_section_info is set.
+	 *
+	 * @note A cached extension keeps its dependencies loaded until it is
+	 *       evicted from the cache or @ref llext_cache_flush is called.
+	 */
+	bool cache;
 };
 
 /** Default initializer for @ref llext_load_param */
@@ -227,6 +243,15 @@ int llext_load(struct llext_loader *loader, const char *name, struct llext **ext
  */
 int llext_unload(struct llext **ext);
 
+/**
+ * @brief Free all extensions kept in the load cache
+ *
+ * Extensions loaded with @ref llext_load_param.cache are kept in memory after
+ * they are unloaded. This frees them, along with the dependencies they
+ * hold. Has no effect unless @kconfig{CONFIG_LLEXT_LOAD_CACHE} is enabled.
+ */
+void llext_cache_flush(void);
+
 /**
  * @brief Free any inspection-related memory for the specified loader and extension.
  *
@@ -84,6 +84,14 @@ struct llext_symtable {
 
 	/** Array of symbols */
 	struct llext_symbol *syms;
+
+#if defined(CONFIG_LLEXT_SYMTAB_HASH) || defined(__DOXYGEN__)
+	/**
+	 * Hash table of 1-based indexes in @ref syms, 0 for an empty slot.
+	 * Its size is the power of 2 above twice the number of symbols.
+	 */
+	uint32_t *hash;
+#endif
 };
 
 
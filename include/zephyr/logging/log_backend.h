@@ -45,6 +45,23 @@ enum log_backend_evt {
 	 */
 	LOG_BACKEND_EVT_PROCESS_THREAD_DONE,
 
+	/**
+	 * @brief Event before a batch of messages is processed.
+	 *
+	 * Backend may defer writing out the messages until
+	 * @ref LOG_BACKEND_EVT_BATCH_END.
+	 *
+	 * @note Deferred mode with CONFIG_LOG_PROCESS_BATCH only.
+	 */
+	LOG_BACKEND_EVT_BATCH_START,
+
+	/**
+	 * @brief Event after a batch of messages is processed.
+	 *
+	 * @note Deferred mode with CONFIG_LOG_PROCESS_BATCH only.
+	 */
+	LOG_BACKEND_EVT_BATCH_END,
+
 	/** @brief Maximum number of backend events */
 	LOG_BACKEND_EVT_MAX,
 };
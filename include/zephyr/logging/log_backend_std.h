@@ -8,6 +8,7 @@
 
 #include <zephyr/logging/log_msg.h>
 #include <zephyr/logging/log_output.h>
+#include <zephyr/logging/log_backend.h>
 #include <zephyr/kernel.h>
 
 #ifdef __cplusplus
@@ -47,6 +48,7 @@ static inline uint32_t log_backend_std_get_flags(void)
 static inline void
 log_backend_std_panic(const struct log_output *const output)
 {
+	log_output_batch_end(output);
 	log_output_flush(output);
 }
 
@@ -61,6 +63,23 @@ log_backend_std_dropped(const struct log_output *const output, uint32_t cnt)
 	log_output_dropped_process(output, cnt);
 }
 
+/** @brief Forward backend events to a standard logger backend.
+ *
+ * Makes the log output write out a batch of messages at once.
+ *
+ * @param output	Log output instance.
+ * @param event		Backend event.
+ */
+static inline void
+log_backend_std_notify(const struct log_output *const output, enum log_backend_evt event)
+{
+	if (event == LOG_BACKEND_EVT_BATCH_START) {
+		log_output_batch_begin(output);
+	} else if (event == LOG_BACKEND_EVT_BATCH_END) {
+		log_output_batch_end(output);
+	}
+}
+
 /**
  * @}
  */
@@ -295,6 +295,23 @@ int log_mem_get_usage(uint32_t *buf_size, uint32_t *usage);
  */
 int log_mem_get_max_usage(uint32_t *max);
 
+/**
+ * @brief Get number of messages dropped on a CPU.
+ *
+ * Requires CONFIG_LOG_BUFFER_PER_CPU option. Messages are accounted to the
+ * CPU which created them, whether they were dropped because the buffer of
+ * that CPU was full or overwritten by newer messages of that CPU. The count
+ * is only reset by log_core_init().
+ *
+ * @param cpu CPU index.
+ * @param[out] cnt Number of dropped messages.
+ *
+ * @retval -ENOTSUP if per-CPU buffers are not enabled.
+ * @retval -EINVAL if @p cpu is out of range.
+ * @retval 0 successfully collected the count.
+ */
+int log_mem_get_cpu_dropped(unsigned int cpu, uint32_t *cnt);
+
 #if defined(CONFIG_LOG) && !defined(CONFIG_LOG_MODE_MINIMAL)
 #define LOG_CORE_INIT() log_core_init()
 #define LOG_PANIC() log_panic()
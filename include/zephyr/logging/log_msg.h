@@ -325,10 +325,25 @@ enum z_log_msg_mode {
 		LOG_MSG_SIMPLE_FUNC(_source, _level, __VA_ARGS__); \
 	))
 
-#define Z_LOG_MSG_STACK_CREATE(_cstr_cnt, _domain_id, _source, _level, _data, _dlen, ...) \
+/** @brief Get package flags resolved at compile time from the format string.
+ *
+ * If format string has no pointer conversion then all character pointer
+ * arguments are strings and the format string does not need to be checked
+ * when strings are copied into the message.
+ *
+ * @param ...	Optional string with arguments (may be empty).
+ */
+#define Z_LOG_MSG_FMT_FLAGS(...) \
+	COND_CODE_0(NUM_VA_ARGS_LESS_1(_, ##__VA_ARGS__), \
+		(0), \
+		(Z_CBPRINTF_FMT_NO_PTR(GET_ARG_N(1, __VA_ARGS__)) ? \
+		 CBPRINTF_PACKAGE_PCHAR_ARGS_ARE_STR : 0))
+
+#define Z_LOG_MSG_STACK_CREATE(_cstr_cnt, _fmt_flags, _domain_id, _source, _level, \
+			       _data, _dlen, ...) \
 do { \
 	int _plen; \
-	uint32_t _options = Z_LOG_MSG_CBPRINTF_FLAGS(_cstr_cnt) | \
+	uint32_t _options = Z_LOG_MSG_CBPRINTF_FLAGS(_cstr_cnt) | (_fmt_flags) | \
 			  CBPRINTF_PACKAGE_ADD_RW_STR_POS; \
 	if (GET_ARG_N(1, __VA_ARGS__) == NULL) { \
 		_plen = 0; \
@@ -540,8 +555,9 @@ do { \
 			) \
 		) \
 		LOG_MSG_DBG("create on stack message\n");\
-		Z_LOG_MSG_STACK_CREATE(_cstr_cnt, _domain_id, _source, _level, _data, \
-					_dlen, Z_LOG_FMT_ARGS(_fmt, ##__VA_ARGS__)); \
+		Z_LOG_MSG_STACK_CREATE(_cstr_cnt, Z_LOG_MSG_FMT_FLAGS(__VA_ARGS__), \
+				       _domain_id, _source, _level, _data, _dlen, \
+				       Z_LOG_FMT_ARGS(_fmt, ##__VA_ARGS__)); \
 		(_mode) = Z_LOG_MSG_MODE_FROM_STACK; \
 	} \
 	(void)(_mode); \
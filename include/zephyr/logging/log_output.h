@@ -85,11 +85,43 @@ extern "C" {
  */
 typedef int (*log_output_func_t)(uint8_t *buf, size_t size, void *ctx);
 
+/** @brief Segment of output data passed to a vectored output function. */
+struct log_output_iovec {
+	/** Segment data. */
+	uint8_t *buf;
+	/** Segment length in bytes. */
+	size_t len;
+};
+
+/**
+ * @brief Prototype of the vectored function processing output data.
+ *
+ * Each segment holds one or more complete formatted messages, except for
+ * a message which did not fit in the output buffer which is split over
+ * several calls. Segments are consecutive in memory, so a backend without
+ * framing requirements can write them out as a single block.
+ *
+ * Unlike @ref log_output_func_t all of the data is consumed.
+ *
+ * @param iov Array of segments.
+ * @param iovcnt Number of segments.
+ * @param ctx User context.
+ */
+typedef void (*log_output_vec_func_t)(const struct log_output_iovec *iov, size_t iovcnt,
+				      void *ctx);
+
 /* @brief Control block structure for log_output instance.  */
 struct log_output_control_block {
 	atomic_t offset;
 	void *ctx;
 	const char *hostname;
+#ifdef CONFIG_LOG_PROCESS_BATCH
+	/* Messages are not written out individually while set. */
+	bool batch;
+	/* Number of complete messages in the buffer and their end offsets. */
+	uint16_t msg_cnt;
+	uint32_t msg_end[CONFIG_LOG_PROCESS_BATCH_SIZE];
+#endif
 };
 
 /** @brief Log_output instance structure. */
@@ -98,6 +130,9 @@ struct log_output {
 	struct log_output_control_block *control_block;
 	uint8_t *buf;
 	size_t size;
+#ifdef CONFIG_LOG_PROCESS_BATCH
+	log_output_vec_func_t vfunc;
+#endif
 };
 
 /**
@@ -133,6 +168,28 @@ log_format_func_t log_format_func_t_get(uint32_t log_type);
 		.size = _size,						\
 	}
 
+/** @brief Create log_output instance with a vectored output function.
+ *
+ * During a batch (see @ref log_output_batch_begin) the buffer is written
+ * out through @p _vfunc, with one segment per message. Outside of batches,
+ * or when CONFIG_LOG_PROCESS_BATCH is disabled, @p _func is used.
+ *
+ * @param _name  Instance name.
+ * @param _func  Function for processing output data.
+ * @param _vfunc Vectored function for processing output data.
+ * @param _buf   Pointer to the output buffer.
+ * @param _size  Size of the output buffer.
+ */
+#define LOG_OUTPUT_VEC_DEFINE(_name, _func, _vfunc, _buf, _size)	\
+	static struct log_output_control_block _name##_control_block;	\
+	static const struct log_output _name = {			\
+		.func = _func,						\
+		.control_block = &_name##_control_block,		\
+		.buf = _buf,						\
+		.size = _size,						\
+		IF_ENABLED(CONFIG_LOG_PROCESS_BATCH, (.vfunc = _vfunc,))	\
+	}
+
 /** @brief Process log messages v2 to readable strings.
  *
  * Function is using provided context with the buffer and output function to
@@ -190,6 +247,10 @@ void log_output_msg_syst_process(const struct log_output *log_output,
  */
 void log_output_dropped_process(const struct log_output *output, uint32_t cnt);
 
+/** @cond INTERNAL_HIDDEN */
+void z_log_output_batch_flush(const struct log_output *output);
+/** @endcond */
+
 /** @brief Write to the output buffer.
  *
  * @param outf Output function.
@@ -214,11 +275,47 @@ static inline void log_output_write(log_output_func_t outf, uint8_t *buf, size_t
  */
 static inline void log_output_flush(const struct log_output *output)
 {
+#ifdef CONFIG_LOG_PROCESS_BATCH
+	if (output->control_block->msg_cnt != 0) {
+		z_log_output_batch_flush(output);
+		return;
+	}
+#endif
 	log_output_write(output->func, output->buf, output->control_block->offset,
 			 output->control_block->ctx);
 	output->control_block->offset = 0;
 }
 
+/** @brief Start a batch of messages.
+ *
+ * Until @ref log_output_batch_end is called formatted messages are kept in
+ * the output buffer, which is only written out when full.
+ *
+ * @param output Pointer to the log output instance.
+ */
+static inline void log_output_batch_begin(const struct log_output *output)
+{
+#ifdef CONFIG_LOG_PROCESS_BATCH
+	output->control_block->batch = true;
+#else
+	ARG_UNUSED(output);
+#endif
+}
+
+/** @brief End a batch of messages and write out the output buffer.
+ *
+ * @param output Pointer to the log output instance.
+ */
+static inline void log_output_batch_end(const struct log_output *output)
+{
+#ifdef CONFIG_LOG_PROCESS_BATCH
+	output->control_block->batch = false;
+	log_output_flush(output);
+#else
+	ARG_UNUSED(output);
+#endif
+}
+
 /** @brief Function for setting user context passed to the output function.
  *
  * @param output	Pointer to the log output instance.
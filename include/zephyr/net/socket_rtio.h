@@ -0,0 +1,167 @@
+/**
+ * @file
+ * @brief BSD socket RTIO API
+ *
+ * API can be used to drive socket operations through an RTIO context.
+ */
+
+/*
+ * Copyright (c) 2025 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef ZEPHYR_INCLUDE_NET_SOCKET_RTIO_H_
+#define ZEPHYR_INCLUDE_NET_SOCKET_RTIO_H_
+
+/**
+ * @brief BSD socket RTIO API
+ * @defgroup bsd_socket_rtio BSD socket RTIO API
+ * @since 4.2
+ * @version 0.1.0
+ * @ingroup networking
+ * @{
+ */
+
+#include <zephyr/sys/util.h>
+#include <zephyr/net/socket.h>
+#include <zephyr/rtio/rtio.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** @cond INTERNAL_HIDDEN */
+
+extern const struct rtio_iodev_api net_socket_rtio_api;
+
+/** @endcond */
+
+/**
+ * @brief Statically define a socket iodev.
+ *
+ * The iodev is not bound to a socket until net_socket_rtio_iodev_init()
+ * is called.
+ *
+ * @param name Name of the iodev.
+ */
+#define NET_SOCKET_RTIO_IODEV_DEFINE(name) \
+	RTIO_IODEV_DEFINE(name, &net_socket_rtio_api, INT_TO_POINTER(-1))
+
+/**
+ * @brief Bind a socket iodev to a socket.
+ *
+ * The iodev does not need to be statically defined, so an iodev can be
+ * set up for every socket that is accepted at runtime.
+ *
+ * @param iodev Iodev to bind.
+ * @param sock Socket the operations submitted to the iodev act on.
+ */
+static inline void net_socket_rtio_iodev_init(struct rtio_iodev *iodev, int sock)
+{
+	iodev->api = &net_socket_rtio_api;
+	iodev->data = INT_TO_POINTER(sock);
+}
+
+/**
+ * @brief Get the socket a socket iodev is bound to.
+ *
+ * @param iodev Socket iodev.
+ *
+ * @return Socket, or -1 if the iodev is not bound.
+ */
+static inline int net_socket_rtio_iodev_sock(const struct rtio_iodev *iodev)
+{
+	return (int)POINTER_TO_INT(iodev->data);
+}
+
+/**
+ * @brief Prepare an accept operation.
+ *
+ * The result of the completion is the accepted socket or a negative error.
+ *
+ * @param sqe Submission to prepare.
+ * @param iodev Iodev of the listening socket.
+ * @param addr Address of the peer, can be NULL.
+ * @param addrlen Length of @p addr, updated with the length of the address.
+ * @param userdata Userdata returned with the completion.
+ */
+static inline void net_socket_rtio_prep_accept(struct rtio_sqe *sqe,
+					       const struct rtio_iodev *iodev,
+					       struct sockaddr *addr, socklen_t *addrlen,
+					       void *userdata)
+{
+	memset(sqe, 0, sizeof(struct rtio_sqe));
+	sqe->op = RTIO_OP_SOCK_ACCEPT;
+	sqe->prio = RTIO_PRIO_NORM;
+	sqe->iodev = iodev;
+	sqe->sock_accept.addr = addr;
+	sqe->sock_accept.addrlen = addrlen;
+	sqe->userdata = userdata;
+}
+
+/**
+ * @brief Prepare a receive message operation.
+ *
+ * The result of the completion is the number of bytes received or a
+ * negative error.
+ *
+ * @param sqe Submission to prepare.
+ * @param iodev Iodev of the socket.
+ * @param msg Message to receive into.
+ * @param userdata Userdata returned with the completion.
+ */
+static inline void net_socket_rtio_prep_recvmsg(struct rtio_sqe *sqe,
+						const struct rtio_iodev *iodev,
+						struct msghdr *msg, void *userdata)
+{
+	memset(sqe, 0, sizeof(struct rtio_sqe));
+	sqe->op = RTIO_OP_SOCK_RECVMSG;
+	sqe->prio = RTIO_PRIO_NORM;
+	sqe->iodev = iodev;
+	sqe->sock_msg = msg;
+	sqe->userdata = userdata;
+}
+
+/**
+ * @brief Prepare a send message operation.
+ *
+ * The result of the completion is the number of bytes sent or a negative
+ * error.
+ *
+ * @param sqe Submission to prepare.
+ * @param iodev Iodev of the socket.
+ * @param msg Message to send.
+ * @param userdata Userdata returned with the completion.
+ */
+static inline void net_socket_rtio_prep_sendmsg(struct rtio_sqe *sqe,
+						const struct rtio_iodev *iodev,
+						const struct msghdr *msg, void *userdata)
+{
+	net_socket_rtio_prep_recvmsg(sqe, iodev, (struct msghdr *)msg, userdata);
+	sqe->op = RTIO_OP_SOCK_SENDMSG;
+}
+
+/**
+ * @brief Cancel a socket operation.
+ *
+ * Same as rtio_sqe_cancel(), but also wakes up the socket RTIO thread so that
+ * an operation waiting for its socket is dropped right away. With
+ * rtio_sqe_cancel() alone it keeps its pending slot until the next event on
+ * any pending socket.
+ *
+ * @param sqe Submission to cancel.
+ *
+ * @retval 0 Success.
+ */
+int net_socket_rtio_cancel(struct rtio_sqe *sqe);
+
+#ifdef __cplusplus
+}
+#endif
+
+/**
+ * @}
+ */
+
+#endif /* ZEPHYR_INCLUDE_NET_SOCKET_RTIO_H_ */
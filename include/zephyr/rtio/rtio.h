@@ -141,6 +141,17 @@ extern "C" {
  */
 #define RTIO_SQE_NO_RESPONSE BIT(5)
 
+/**
+ * @brief The buffers of the SQE are registered with the RTIO context
+ *
+ * The buffer of a read or write lies within one of the buffers registered with
+ * rtio_register_buffers(), and a scatter/gather operation uses the registered
+ * buffers as its segments. Registered buffers were validated once when they
+ * were registered, so from user mode they are checked with a cheap bounds
+ * check instead of a memory access check on each submission.
+ */
+#define RTIO_SQE_REGISTERED_BUFFER BIT(6)
+
 /**
  * @}
  */
@@ -289,6 +300,14 @@ typedef void (*rtio_callback_t)(struct rtio *r, const struct rtio_sqe *sqe, void
  */
 typedef void (*rtio_signaled_t)(struct rtio_iodev_sqe *iodev_sqe, void *userdata);
 
+/**
+ * @brief A buffer segment of a scatter/gather operation or a registered buffer
+ */
+struct rtio_iovec {
+	uint8_t *buf; /**< Start of the segment */
+	uint32_t buf_len; /**< Length of the segment */
+};
+
 /**
  * @brief A submission queue event
  */
@@ -365,6 +384,29 @@ struct rtio_sqe {
 		/* struct i3c_ccc_payload *ccc_payload; */
 		void *ccc_payload;
 
+		/** OP_SOCK_ACCEPT */
+		struct {
+			/* struct sockaddr *addr; */
+			void *addr;
+			/* socklen_t *addrlen; */
+			void *addrlen;
+		} sock_accept;
+
+		/** OP_SOCK_RECVMSG and OP_SOCK_SENDMSG */
+		/* struct msghdr *sock_msg; */
+		void *sock_msg;
+
+		/** OP_RXV and OP_TXV */
+		struct {
+			/**
+			 * Segments to read into or write from, NULL to use registered
+			 * buffers of the context
+			 */
+			const struct rtio_iovec *iov;
+			uint16_t iov_cnt; /**< Number of segments */
+			uint16_t buf_index; /**< First registered buffer if iov is NULL */
+		} iov;
+
 		/** OP_AWAIT */
 		struct {
 			atomic_t ok;
@@ -404,6 +446,14 @@ struct rtio_cqe_pool {
 	struct rtio_cqe *pool;
 };
 
+/** @cond ignore */
+/* Submissions acquired by a producer and not yet visible to the executor */
+struct rtio_sqe_batch {
+	struct mpsc_node *head;
+	struct mpsc_node *tail;
+};
+/** @endcond */
+
 /**
  * @brief An RTIO context containing what can be viewed as a pair of queues.
  *
@@ -452,11 +502,30 @@ struct rtio {
 	struct sys_mem_blocks *block_pool;
 #endif
 
+	/* Submissions acquired with rtio_sqe_acquire() and not yet submitted */
+	struct rtio_sqe_batch sq_batch;
+
+	/* Number of requests to work through the submission queue, non-zero
+	 * while a context is doing so
+	 */
+	atomic_t sq_doorbell;
+
+#if defined(CONFIG_SMP) && !defined(CONFIG_RTIO_SUBMIT_SEM)
+	/* CPU of the context that rang the doorbell first */
+	atomic_t sq_drain_cpu;
+#endif
+
 	/* Submission queue */
 	struct mpsc sq;
 
 	/* Completion queue */
 	struct mpsc cq;
+
+#if CONFIG_RTIO_REGISTERED_BUFFERS > 0
+	/* Buffers registered with rtio_register_buffers() */
+	struct rtio_iovec reg_bufs[CONFIG_RTIO_REGISTERED_BUFFERS];
+	uint16_t reg_buf_cnt;
+#endif
 };
 
 /** The memory partition associated with all RTIO context information */
@@ -516,6 +585,9 @@ struct rtio_iodev_sqe {
 	struct mpsc_node q;
 	struct rtio_iodev_sqe *next;
 	struct rtio *r;
+#ifdef CONFIG_RTIO_SQ_PRODUCER
+	struct rtio_sqe_pool *pool;
+#endif
 };
 
 /**
@@ -583,6 +655,21 @@ struct rtio_iodev {
 /** An operation to suspend bus while awaiting signal */
 #define RTIO_OP_AWAIT (RTIO_OP_I3C_CCC+1)
 
+/** An operation that receives (reads) into several segments (scatter) */
+#define RTIO_OP_RXV (RTIO_OP_AWAIT+1)
+
+/** An operation that transmits (writes) from several segments (gather) */
+#define RTIO_OP_TXV (RTIO_OP_RXV+1)
+
+/** An operation that accepts a connection on a socket */
+#define RTIO_OP_SOCK_ACCEPT (RTIO_OP_TXV+1)
+
+/** An operation that receives a message from a socket */
+#define RTIO_OP_SOCK_RECVMSG (RTIO_OP_SOCK_ACCEPT+1)
+
+/** An operation that sends a message to a socket */
+#define RTIO_OP_SOCK_SENDMSG (RTIO_OP_SOCK_RECVMSG+1)
+
 /**
  * @brief Prepare a nop (no op) submission
  */
@@ -636,6 +723,104 @@ static inline void rtio_sqe_prep_read_multishot(struct rtio_sqe *sqe,
 	sqe->flags |= RTIO_SQE_MULTISHOT;
 }
 
+/**
+ * @brief Prepare a scatter read op submission
+ *
+ * The data is read into each segment in turn.
+ *
+ * @param sqe Submission to prepare
+ * @param iodev Device to read from
+ * @param prio Priority of the operation
+ * @param iov Segments to read into, must stay valid until completion
+ * @param iov_cnt Number of segments
+ * @param userdata Userdata returned with the completion
+ */
+static inline void rtio_sqe_prep_readv(struct rtio_sqe *sqe,
+				       const struct rtio_iodev *iodev,
+				       int8_t prio,
+				       const struct rtio_iovec *iov,
+				       uint16_t iov_cnt,
+				       void *userdata)
+{
+	memset(sqe, 0, sizeof(struct rtio_sqe));
+	sqe->op = RTIO_OP_RXV;
+	sqe->prio = prio;
+	sqe->iodev = iodev;
+	sqe->iov.iov = iov;
+	sqe->iov.iov_cnt = iov_cnt;
+	sqe->userdata = userdata;
+}
+
+/**
+ * @brief Prepare a scatter read op submission into registered buffers
+ *
+ * @see rtio_sqe_prep_readv()
+ *
+ * @param sqe Submission to prepare
+ * @param iodev Device to read from
+ * @param prio Priority of the operation
+ * @param buf_index Index of the first registered buffer to read into
+ * @param buf_cnt Number of registered buffers to read into
+ * @param userdata Userdata returned with the completion
+ */
+static inline void rtio_sqe_prep_readv_registered(struct rtio_sqe *sqe,
+						  const struct rtio_iodev *iodev,
+						  int8_t prio,
+						  uint16_t buf_index,
+						  uint16_t buf_cnt,
+						  void *userdata)
+{
+	rtio_sqe_prep_readv(sqe, iodev, prio, NULL, buf_cnt, userdata);
+	sqe->iov.buf_index = buf_index;
+	sqe->flags = RTIO_SQE_REGISTERED_BUFFER;
+}
+
+/**
+ * @brief Prepare a gather write op submission
+ *
+ * The data is written from each segment in turn.
+ *
+ * @param sqe Submission to prepare
+ * @param iodev Device to write to
+ * @param prio Priority of the operation
+ * @param iov Segments to write from, must stay valid until completion
+ * @param iov_cnt Number of segments
+ * @param userdata Userdata returned with the completion
+ */
+static inline void rtio_sqe_prep_writev(struct rtio_sqe *sqe,
+					const struct rtio_iodev *iodev,
+					int8_t prio,
+					const struct rtio_iovec *iov,
+					uint16_t iov_cnt,
+					void *userdata)
+{
+	rtio_sqe_prep_readv(sqe, iodev, prio, iov, iov_cnt, userdata);
+	sqe->op = RTIO_OP_TXV;
+}
+
+/**
+ * @brief Prepare a gather write op submission from registered buffers
+ *
+ * @see rtio_sqe_prep_writev()
+ *
+ * @param sqe Submission to prepare
+ * @param iodev Device to write to
+ * @param prio Priority of the operation
+ * @param buf_index Index of the first registered buffer to write from
+ * @param buf_cnt Number of registered buffers to write from
+ * @param userdata Userdata returned with the completion
+ */
+static inline void rtio_sqe_prep_writev_registered(struct rtio_sqe *sqe,
+						   const struct rtio_iodev *iodev,
+						   int8_t prio,
+						   uint16_t buf_index,
+						   uint16_t buf_cnt,
+						   void *userdata)
+{
+	rtio_sqe_prep_readv_registered(sqe, iodev, prio, buf_index, buf_cnt, userdata);
+	sqe->op = RTIO_OP_TXV;
+}
+
 /**
  * @brief Prepare a write op submission
  */
@@ -781,6 +966,10 @@ static inline struct rtio_iodev_sqe *rtio_sqe_pool_alloc(struct rtio_sqe_pool *p
 
 	pool->pool_free--;
 
+#ifdef CONFIG_RTIO_SQ_PRODUCER
+	iodev_sqe->pool = pool;
+#endif
+
 	return iodev_sqe;
 }
 
@@ -791,6 +980,61 @@ static inline void rtio_sqe_pool_free(struct rtio_sqe_pool *pool, struct rtio_io
 	pool->pool_free++;
 }
 
+/* Pool an sqe was acquired from, which is not the one of the context with producers */
+static inline struct rtio_sqe_pool *rtio_iodev_sqe_pool(const struct rtio *r,
+							 const struct rtio_iodev_sqe *iodev_sqe)
+{
+#ifdef CONFIG_RTIO_SQ_PRODUCER
+	ARG_UNUSED(r);
+	return iodev_sqe->pool;
+#else
+	ARG_UNUSED(iodev_sqe);
+	return r->sqe_pool;
+#endif
+}
+
+static inline void rtio_sqe_batch_append(struct rtio_sqe_batch *batch,
+					 struct rtio_iodev_sqe *iodev_sqe)
+{
+	mpsc_ptr_set(iodev_sqe->q.next, NULL);
+
+	if (batch->tail == NULL) {
+		batch->head = &iodev_sqe->q;
+	} else {
+		mpsc_ptr_set(batch->tail->next, &iodev_sqe->q);
+	}
+	batch->tail = &iodev_sqe->q;
+}
+
+static inline void rtio_sqe_batch_drop(struct rtio *r, struct rtio_sqe_batch *batch)
+{
+	struct mpsc_node *node = batch->head;
+
+	while (node != NULL) {
+		struct rtio_iodev_sqe *iodev_sqe = CONTAINER_OF(node, struct rtio_iodev_sqe, q);
+
+		/* Freeing reuses the node, get the next one first */
+		node = (struct mpsc_node *)mpsc_ptr_get(node->next);
+		rtio_sqe_pool_free(rtio_iodev_sqe_pool(r, iodev_sqe), iodev_sqe);
+	}
+
+	batch->head = NULL;
+	batch->tail = NULL;
+}
+
+/* Make a batch visible to the executor in one go, so chains stay contiguous */
+static inline void rtio_sqe_batch_publish(struct rtio *r, struct rtio_sqe_batch *batch)
+{
+	if (batch->head == NULL) {
+		return;
+	}
+
+	mpsc_push_list(&r->sq, batch->head, batch->tail);
+
+	batch->head = NULL;
+	batch->tail = NULL;
+}
+
 static inline struct rtio_cqe *rtio_cqe_pool_alloc(struct rtio_cqe_pool *pool)
 {
 	struct mpsc_node *node = mpsc_pop(&pool->free_q);
@@ -943,6 +1187,7 @@ static inline void rtio_block_pool_free(struct rtio *r, void *buf, uint32_t buf_
 		IF_ENABLED(CONFIG_RTIO_CONSUME_SEM, (.consume_sem = &CONCAT(_consume_sem_, name),))\
 		.cq_count = ATOMIC_INIT(0),                                                        \
 		.xcqcnt = ATOMIC_INIT(0),                                                          \
+		.sq_doorbell = ATOMIC_INIT(0),                                                     \
 		.sqe_pool = _sqe_pool,                                                             \
 		.cqe_pool = _cqe_pool,                                                             \
 		IF_ENABLED(CONFIG_RTIO_SYS_MEM_BLOCKS, (.block_pool = _block_pool,))               \
@@ -1046,6 +1291,8 @@ static inline struct rtio_iodev_sqe *rtio_iodev_sqe_next(const struct rtio_iodev
 /**
  * @brief Acquire a single submission queue event if available
  *
+ * The submission is handed to the executor by the next call to rtio_submit().
+ *
  * @param r RTIO context
  *
  * @retval sqe A valid submission queue event acquired from the submission queue
@@ -1059,7 +1306,7 @@ static inline struct rtio_sqe *rtio_sqe_acquire(struct rtio *r)
 		return NULL;
 	}
 
-	mpsc_push(&r->sq, &iodev_sqe->q);
+	rtio_sqe_batch_append(&r->sq_batch, iodev_sqe);
 
 	return &iodev_sqe->sqe;
 }
@@ -1071,14 +1318,7 @@ static inline struct rtio_sqe *rtio_sqe_acquire(struct rtio *r)
  */
 static inline void rtio_sqe_drop_all(struct rtio *r)
 {
-	struct rtio_iodev_sqe *iodev_sqe;
-	struct mpsc_node *node = mpsc_pop(&r->sq);
-
-	while (node != NULL) {
-		iodev_sqe = CONTAINER_OF(node, struct rtio_iodev_sqe, q);
-		rtio_sqe_pool_free(r->sqe_pool, iodev_sqe);
-		node = mpsc_pop(&r->sq);
-	}
+	rtio_sqe_batch_drop(r, &r->sq_batch);
 }
 
 /**
@@ -1388,6 +1628,82 @@ static inline int rtio_sqe_rx_buf(const struct rtio_iodev_sqe *iodev_sqe, uint32
 	return 0;
 }
 
+/**
+ * @brief Get the segments of a scatter/gather submission
+ *
+ * Resolves the registered buffers of the context when the submission uses
+ * them, so that the iodev always gets an array of segments it can hand to its
+ * DMA or bus driver.
+ *
+ * @param[in] iodev_sqe The IODev submission of a RTIO_OP_RXV or RTIO_OP_TXV op
+ * @param[out] iov_cnt Number of segments
+ *
+ * @return Array of segments
+ */
+static inline const struct rtio_iovec *rtio_sqe_iov(const struct rtio_iodev_sqe *iodev_sqe,
+						   uint16_t *iov_cnt)
+{
+	const struct rtio_sqe *sqe = &iodev_sqe->sqe;
+
+	__ASSERT_NO_MSG(sqe->op == RTIO_OP_RXV || sqe->op == RTIO_OP_TXV);
+
+	*iov_cnt = sqe->iov.iov_cnt;
+
+#if CONFIG_RTIO_REGISTERED_BUFFERS > 0
+	if (sqe->iov.iov == NULL) {
+		return &iodev_sqe->r->reg_bufs[sqe->iov.buf_index];
+	}
+#endif
+
+	return sqe->iov.iov;
+}
+
+/**
+ * @brief Register buffers with an RTIO context
+ *
+ * Replaces the buffers registered with the context. Registered buffers are
+ * referred to by index from scatter/gather submissions, and plain reads and
+ * writes within them may be flagged with @ref RTIO_SQE_REGISTERED_BUFFER. When
+ * called from user mode, access to the buffers is checked once here rather
+ * than on each submission.
+ *
+ * @note Buffers must not be unregistered while submissions using them are
+ * in flight.
+ *
+ * @param[in] r RTIO context
+ * @param[in] bufs Buffers to register, copied into the context
+ * @param[in] buf_cnt Number of buffers, 0 to unregister all buffers
+ *
+ * @retval 0 Success
+ * @retval -ENOMEM More than CONFIG_RTIO_REGISTERED_BUFFERS buffers
+ * @retval -ENOTSUP Registered buffers are not enabled
+ */
+__syscall int rtio_register_buffers(struct rtio *r, const struct rtio_iovec *bufs,
+				    uint16_t buf_cnt);
+
+static inline int z_impl_rtio_register_buffers(struct rtio *r, const struct rtio_iovec *bufs,
+					       uint16_t buf_cnt)
+{
+#if CONFIG_RTIO_REGISTERED_BUFFERS > 0
+	if (buf_cnt > ARRAY_SIZE(r->reg_bufs)) {
+		return -ENOMEM;
+	}
+
+	for (uint16_t i = 0; i < buf_cnt; i++) {
+		r->reg_bufs[i] = bufs[i];
+	}
+	r->reg_buf_cnt = buf_cnt;
+
+	return 0;
+#else
+	ARG_UNUSED(r);
+	ARG_UNUSED(bufs);
+	ARG_UNUSED(buf_cnt);
+
+	return -ENOTSUP;
+#endif
+}
+
 /**
  * @brief Release memory that was allocated by the RTIO's memory pool
  *
@@ -1503,6 +1819,107 @@ static inline void rtio_iodev_sqe_await_signal(struct rtio_iodev_sqe *iodev_sqe,
 	}
 }
 
+#if defined(CONFIG_RTIO_SQ_PRODUCER) || defined(__DOXYGEN__)
+
+/**
+ * @brief A submission producer of an RTIO context
+ *
+ * Each producer has its own pool of submission queue entries and hands them
+ * over to the executor of the context in batches. Several threads, possibly
+ * on different CPUs, may each use their own producer to submit to the same
+ * context concurrently without a lock.
+ */
+struct rtio_sq_producer {
+	/** RTIO context the producer submits to */
+	struct rtio *r;
+
+	/** @cond ignore */
+	struct rtio_sqe_pool *sqe_pool;
+	struct rtio_sqe_batch batch;
+	/** @endcond */
+};
+
+/**
+ * @brief Statically define a submission producer of an RTIO context
+ *
+ * @param name Name of the producer
+ * @param _r RTIO context the producer submits to
+ * @param sq_sz Number of submission queue entries owned by the producer
+ */
+#define RTIO_SQ_PRODUCER_DEFINE(name, _r, sq_sz)				\
+	Z_RTIO_SQE_POOL_DEFINE(CONCAT(name, _sqe_pool), sq_sz);		\
+	static struct rtio_sq_producer name = {					\
+		.r = &(_r),							\
+		.sqe_pool = &CONCAT(name, _sqe_pool),				\
+	}
+
+/**
+ * @brief Count of submission queue entries a producer can acquire
+ *
+ * @param p Submission producer
+ *
+ * @return Count of acquirable submission queue entries
+ */
+static inline uint32_t rtio_sq_producer_acquirable(struct rtio_sq_producer *p)
+{
+	return p->sqe_pool->pool_free;
+}
+
+/**
+ * @brief Acquire a submission queue entry from a producer
+ *
+ * The entry is private to the producer until rtio_sq_producer_submit() is
+ * called. A chain or transaction must be acquired from a single producer.
+ *
+ * @param p Submission producer
+ *
+ * @retval sqe A submission queue entry to prepare
+ * @retval NULL No submission queue entry available
+ */
+static inline struct rtio_sqe *rtio_sq_producer_acquire(struct rtio_sq_producer *p)
+{
+	struct rtio_iodev_sqe *iodev_sqe = rtio_sqe_pool_alloc(p->sqe_pool);
+
+	if (iodev_sqe == NULL) {
+		return NULL;
+	}
+
+	rtio_sqe_batch_append(&p->batch, iodev_sqe);
+
+	return &iodev_sqe->sqe;
+}
+
+/**
+ * @brief Drop all entries acquired from a producer since its last submit
+ *
+ * @param p Submission producer
+ */
+static inline void rtio_sq_producer_drop_all(struct rtio_sq_producer *p)
+{
+	rtio_sqe_batch_drop(p->r, &p->batch);
+}
+
+/**
+ * @brief Submit all entries acquired from a producer
+ *
+ * The entries are queued to the executor of the context at once, after the
+ * batches of other producers. If another thread is already working through
+ * the submission queue of the context, it also takes care of this batch and
+ * the call returns right away. Completions are produced in the completion
+ * queue of the context, which must be consumed by a single thread.
+ *
+ * @note Only callable from kernel mode.
+ *
+ * @param p Submission producer
+ */
+static inline void rtio_sq_producer_submit(struct rtio_sq_producer *p)
+{
+	rtio_sqe_batch_publish(p->r, &p->batch);
+	rtio_executor_submit(p->r);
+}
+
+#endif /* CONFIG_RTIO_SQ_PRODUCER || __DOXYGEN__ */
+
 /**
  * @brief Copy an array of SQEs into the queue and get resulting handles back
  *
@@ -1637,6 +2054,7 @@ static inline int z_impl_rtio_submit(struct rtio *r, uint32_t wait_count)
 		r->submit_count = wait_count;
 	}
 
+	rtio_sqe_batch_publish(r, &r->sq_batch);
 	rtio_executor_submit(r);
 
 	if (wait_count > 0) {
@@ -1648,6 +2066,35 @@ static inline int z_impl_rtio_submit(struct rtio *r, uint32_t wait_count)
 	return res;
 }
 #else
+/**
+ * @brief Let others progress while a submitter spins on its completions
+ *
+ * While the doorbell is rung, the submissions are drained by another context.
+ * If that context started on this CPU, it is a thread of lower priority
+ * preempted by this one: yielding would never let it run again, so sleep
+ * instead until it is done. A context draining on another CPU keeps making
+ * progress and the submitter keeps polling.
+ *
+ * @param r RTIO context
+ */
+static inline void rtio_submit_wait_yield(struct rtio *r)
+{
+	bool drain_preempted = atomic_get(&r->sq_doorbell) != 0;
+
+#ifdef CONFIG_SMP
+	drain_preempted = drain_preempted &&
+			  (atomic_get(&r->sq_drain_cpu) == (atomic_val_t)arch_curr_cpu()->id);
+#endif
+
+	if (IS_ENABLED(CONFIG_MULTITHREADING) && drain_preempted) {
+		k_sleep(K_TICKS(1));
+		return;
+	}
+
+	Z_SPIN_DELAY(10);
+	k_yield();
+}
+
 static inline int z_impl_rtio_submit(struct rtio *r, uint32_t wait_count)
 {
 
@@ -1656,18 +2103,17 @@ static inline int z_impl_rtio_submit(struct rtio *r, uint32_t wait_count)
 	uintptr_t cq_complete_count = cq_count + wait_count;
 	bool wraps = cq_complete_count < cq_count;
 
+	rtio_sqe_batch_publish(r, &r->sq_batch);
 	rtio_executor_submit(r);
 
 	if (wraps) {
 		while ((uintptr_t)atomic_get(&r->cq_count) >= cq_count) {
-			Z_SPIN_DELAY(10);
-			k_yield();
+			rtio_submit_wait_yield(r);
 		}
 	}
 
 	while ((uintptr_t)atomic_get(&r->cq_count) < cq_complete_count) {
-		Z_SPIN_DELAY(10);
-		k_yield();
+		rtio_submit_wait_yield(r);
 	}
 
 	return res;
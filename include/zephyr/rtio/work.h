@@ -11,6 +11,7 @@
 #include <zephyr/device.h>
 #include <zephyr/rtio/rtio.h>
 #include <zephyr/sys/p4wq.h>
+#include <zephyr/sys/slist.h>
 
 #ifdef __cplusplus
 extern "C" {
@@ -42,6 +43,23 @@ struct rtio_work_req {
 	 * This is filled inside @ref rtio_work_req_submit.
 	 */
 	rtio_work_submit_t handler;
+
+#ifdef CONFIG_RTIO_WORKQ_BATCHING
+	/** Iodev of the request, kept for batching as the IODEV SQE is
+	 * released once the request completes. Only used internally.
+	 */
+	const struct rtio_iodev *iodev;
+
+	/** Requests for the same iodev run by the worker of this request
+	 * once this request is handled. Only used internally.
+	 */
+	sys_slist_t batch;
+
+	/** Node in the list of batches, or in the batch this request
+	 * was added to. Only used internally.
+	 */
+	sys_snode_t node;
+#endif
 };
 
 /**
@@ -58,6 +76,11 @@ struct rtio_work_req *rtio_work_req_alloc(void);
 /**
  * @brief Submit RTIO work request.
  *
+ * With @kconfig{CONFIG_RTIO_WORKQ_BATCHING}, a request for an iodev that
+ * already has a request of the same priority queued or running is run by
+ * the same worker right after it, in submission order, instead of taking
+ * a worker of its own.
+ *
  * @param req Item to fill with request information.
  * @param iodev_sqe RTIO Operation information.
  * @param handler Callback to handler where work operation is performed.
@@ -12,6 +12,7 @@
 #include <zephyr/sys/util.h>
 #include <zephyr/sys/slist.h>
 #include <zephyr/sys/iterable_sections.h>
+#include <zephyr/sys_clock.h>
 #include <stdint.h>
 
 #ifdef __cplusplus
@@ -322,6 +323,30 @@ int settings_load_subtree_direct(
 	settings_load_direct_cb cb,
 	void                   *param);
 
+/**
+ * Defer loading of a subtree to the background.
+ *
+ * Items of the subtree are skipped by settings_load(), and handlers of the
+ * subtree are not committed by it. Once settings_load() is done, the subtree
+ * is loaded with settings_load_subtree() by a low priority work queue, so
+ * settings needed early are available sooner.
+ *
+ * Requires @kconfig{CONFIG_SETTINGS_DEFERRED_LOAD}.
+ *
+ * @param[in] subtree name of the subtree, must remain valid until it is loaded.
+ * @return 0 on success, -ENOMEM if too many subtrees are deferred,
+ *         -EINVAL on invalid subtree.
+ */
+int settings_load_defer(const char *subtree);
+
+/**
+ * Wait for the loading of deferred subtrees to complete.
+ *
+ * @param[in] timeout waiting period.
+ * @return 0 on success, -EAGAIN if loading did not complete in time.
+ */
+int settings_load_deferred_wait(k_timeout_t timeout);
+
 /**
  * Save currently running serialized items. All serialized items which are
  * different from currently persisted values will be saved.
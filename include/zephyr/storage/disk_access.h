@@ -113,6 +113,45 @@ int disk_access_write(const char *pdrv, const uint8_t *data_buf,
  */
 int disk_access_ioctl(const char *pdrv, uint8_t cmd, void *buff);
 
+/**
+ * @brief Disk block cache statistics
+ *
+ * Counters are in sectors, except for @ref disk_cache_stats.write_backs.
+ */
+struct disk_cache_stats {
+	/** Sectors read from the cache */
+	uint32_t read_hits;
+	/** Sectors read from the disk */
+	uint32_t read_misses;
+	/** Sectors read ahead of sequential reads */
+	uint32_t read_ahead;
+	/** Sectors written to cached sectors */
+	uint32_t write_hits;
+	/** Sectors written to newly cached sectors or directly to the disk */
+	uint32_t write_misses;
+	/** Disk write requests issued to write back modified sectors */
+	uint32_t write_backs;
+	/** Sectors written back */
+	uint32_t write_back_sectors;
+	/** Sectors evicted from the cache */
+	uint32_t evictions;
+};
+
+/**
+ * @brief Get disk block cache statistics
+ *
+ * Statistics are common to all cached disks. Requires
+ * @kconfig{CONFIG_DISK_CACHE_STATS}.
+ *
+ * @param[out] stats        Statistics
+ */
+void disk_access_cache_stats_get(struct disk_cache_stats *stats);
+
+/**
+ * @brief Reset disk block cache statistics
+ */
+void disk_access_cache_stats_reset(void);
+
 #ifdef __cplusplus
 }
 #endif
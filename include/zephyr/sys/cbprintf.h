@@ -200,6 +200,16 @@ BUILD_ASSERT(Z_IS_POW2(CBPRINTF_PACKAGE_ALIGNMENT));
  */
 #define CBPRINTF_PACKAGE_ARGS_ARE_TAGGED BIT(6)
 
+/** @brief Indicate that all character pointer arguments are used for %s.
+ *
+ * Locations of read-write strings are then marked as strings in the package
+ * and @ref CBPRINTF_PACKAGE_CONVERT_PTR_CHECK does not need to look into the
+ * format string to check them. Flag can be used when it is known that format
+ * string has no pointer conversion with a character pointer argument, e.g.
+ * when it is checked at compile time.
+ */
+#define CBPRINTF_PACKAGE_PCHAR_ARGS_ARE_STR BIT(7)
+
 /**@} */
 
 /**
@@ -252,6 +262,9 @@ BUILD_ASSERT(Z_IS_POW2(CBPRINTF_PACKAGE_ALIGNMENT));
  * user to cast such argument to void *. It is recommended because there are
  * configurations where string is not accessible and inspection cannot be done.
  * In those cases there are no means to detect such cases.
+ *
+ * Check is skipped for strings of packages created with
+ * @ref CBPRINTF_PACKAGE_PCHAR_ARGS_ARE_STR.
  */
 #define CBPRINTF_PACKAGE_CONVERT_PTR_CHECK BIT(3)
 
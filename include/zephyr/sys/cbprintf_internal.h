@@ -496,6 +496,40 @@ extern "C" {
 	(Z_CBPRINTF_NONE_CHAR_PTR_COUNT(__VA_ARGS__) == \
 	 Z_CBPRINTF_P_COUNT(GET_ARG_N(1, __VA_ARGS__)))
 
+/* Bit set in the argument index of a read-write string location when argument
+ * is known to be used for %s (see CBPRINTF_PACKAGE_PCHAR_ARGS_ARE_STR).
+ */
+#define Z_CBPRINTF_RW_STR_ARG_IS_STR BIT(7)
+
+#define Z_CBPRINTF_FMT_HAS_SEQ(seq, fmt) (__builtin_strstr(fmt, seq) != NULL)
+
+/* Pointer conversion is 'p' following '%', a flag, a field width or a precision. */
+#define Z_CBPRINTF_FMT_HAS_PTR(fmt) \
+	(FOR_EACH_FIXED_ARG(Z_CBPRINTF_FMT_HAS_SEQ, (||), fmt, \
+			    "%p", "-p", "+p", "#p", ".p", "*p", \
+			    "0p", "1p", "2p", "3p", "4p", "5p", "6p", "7p", "8p", "9p", \
+			    "% p", "- p", "+ p", "# p", "0 p"))
+
+/** @brief Check at compile time that format string has no pointer conversion.
+ *
+ * Unlike @ref Z_CBPRINTF_P_COUNT, check relies on the compiler folding a
+ * substring search in a string known at compile time so it is cheap to compile
+ * and it is not limited by the string length. Check is conservative: result is
+ * 0 if string is not known at compile time or if it contains a sequence which
+ * may end a pointer conversion, even if it is not one (e.g. "10ps").
+ *
+ * @param fmt Format string. Must not be a null pointer constant.
+ *
+ * @retval 1 if it is known at compile time that there is no pointer conversion.
+ * @retval 0 otherwise.
+ */
+#if defined(__GNUC__)
+#define Z_CBPRINTF_FMT_NO_PTR(fmt) \
+	(__builtin_constant_p(Z_CBPRINTF_FMT_HAS_PTR(fmt)) && !Z_CBPRINTF_FMT_HAS_PTR(fmt))
+#else
+#define Z_CBPRINTF_FMT_NO_PTR(fmt) 0
+#endif
+
 /* @brief Check if argument is a certain type of char pointer. What exactly is checked
  * depends on @p flags. If flags is 0 then 1 is returned if @p x is a char pointer.
  *
@@ -696,7 +730,8 @@ do { \
 		if (_cros_en) { \
 			if (Z_CBPRINTF_IS_X_PCHAR(arg_idx, _arg, _flags)) { \
 				if (_rws_pos_en) { \
-					_rws_buffer[_rws_pos_idx++] = arg_idx - 1; \
+					_rws_buffer[_rws_pos_idx++] = \
+						(arg_idx - 1) | _rws_arg_flag; \
 					_rws_buffer[_rws_pos_idx++] = _loc; \
 				} \
 			} else { \
@@ -705,7 +740,7 @@ do { \
 				} \
 			} \
 		} else if (_rws_pos_en) { \
-			_rws_buffer[_rws_pos_idx++] = arg_idx - 1; \
+			_rws_buffer[_rws_pos_idx++] = (arg_idx - 1) | _rws_arg_flag; \
 			_rws_buffer[_rws_pos_idx++] = (uint8_t)(_idx / sizeof(int)); \
 		} \
 	} \
@@ -793,6 +828,8 @@ do { \
 	bool _ros_pos_en = (_flags) & CBPRINTF_PACKAGE_ADD_RO_STR_POS; \
 	bool _rws_pos_en = (_flags) & CBPRINTF_PACKAGE_ADD_RW_STR_POS; \
 	bool _cros_en = (_flags) & CBPRINTF_PACKAGE_CONST_CHAR_RO; \
+	uint8_t _rws_arg_flag = ((_flags) & CBPRINTF_PACKAGE_PCHAR_ARGS_ARE_STR) ? \
+				Z_CBPRINTF_RW_STR_ARG_IS_STR : 0; \
 	uint8_t *_pbuf = (buf); \
 	uint8_t _rws_pos_idx = 0; \
 	uint8_t _ros_pos_idx = 0; \
@@ -136,6 +136,31 @@ static ALWAYS_INLINE void mpsc_push(struct mpsc *q, struct mpsc_node *n)
 	arch_irq_unlock(key);
 }
 
+/**
+ * @brief Push a list of nodes at once
+ *
+ * The nodes from @p first to @p last must already be linked together through
+ * their next pointers. They are made visible to the consumer together and stay
+ * contiguous in the queue, with no node of another producer in between.
+ *
+ * @param q Queue to push the nodes to
+ * @param first First node of the list
+ * @param last Last node of the list
+ */
+static ALWAYS_INLINE void mpsc_push_list(struct mpsc *q, struct mpsc_node *first,
+					 struct mpsc_node *last)
+{
+	struct mpsc_node *prev;
+	int key;
+
+	mpsc_ptr_set(last->next, NULL);
+
+	key = arch_irq_lock();
+	prev = (struct mpsc_node *)mpsc_ptr_set_get(q->head, last);
+	mpsc_ptr_set(prev->next, first);
+	arch_irq_unlock(key);
+}
+
 /**
  * @brief Pop a node off of the list
  *
@@ -99,18 +99,20 @@ struct k_p4wq_initparam {
 };
 
 /**
- * @brief Statically initialize a P4 Work Queue
+ * @brief Statically initialize a P4 Work Queue with flags
  *
- * Statically defines a struct k_p4wq object with the specified number
- * of threads which will be initialized at boot and ready for use on
- * entry to main().
+ * Same like K_P4WQ_DEFINE_WITH_DONE_HANDLER but with flags. With
+ * K_P4WQ_DELAYED_START or K_P4WQ_USER_CPU_MASK the threads are not
+ * started at boot, each is started with k_p4wq_enable_static_thread().
+ * The threads are available as the array _p4threads_<name>.
  *
  * @param name Symbol name of the struct k_p4wq that will be defined
  * @param n_threads Number of threads in the work queue pool
  * @param stack_sz Requested stack size of each thread, in bytes
+ * @param flg Flags
  * @param dn_handler Function pointer to handler of type k_p4wq_done_handler_t
  */
-#define K_P4WQ_DEFINE_WITH_DONE_HANDLER(name, n_threads, stack_sz, dn_handler)			\
+#define K_P4WQ_DEFINE_WITH_FLAGS(name, n_threads, stack_sz, flg, dn_handler) \
 	static K_THREAD_STACK_ARRAY_DEFINE(_p4stacks_##name,		\
 					   n_threads, stack_sz);	\
 	static struct k_thread _p4threads_##name[n_threads];		\
@@ -122,10 +124,25 @@ struct k_p4wq_initparam {
 		.threads = _p4threads_##name,				\
 		.stacks = &(_p4stacks_##name[0][0]),			\
 		.queue = &name,						\
-		.flags = 0,						\
-		.done_handler = dn_handler,			\
+		.flags = flg,						\
+		.done_handler = dn_handler,				\
 	}
 
+/**
+ * @brief Statically initialize a P4 Work Queue
+ *
+ * Statically defines a struct k_p4wq object with the specified number
+ * of threads which will be initialized at boot and ready for use on
+ * entry to main().
+ *
+ * @param name Symbol name of the struct k_p4wq that will be defined
+ * @param n_threads Number of threads in the work queue pool
+ * @param stack_sz Requested stack size of each thread, in bytes
+ * @param dn_handler Function pointer to handler of type k_p4wq_done_handler_t
+ */
+#define K_P4WQ_DEFINE_WITH_DONE_HANDLER(name, n_threads, stack_sz, dn_handler)			\
+	K_P4WQ_DEFINE_WITH_FLAGS(name, n_threads, stack_sz, 0, dn_handler)
+
 /**
  * @brief Statically initialize a P4 Work Queue
  *
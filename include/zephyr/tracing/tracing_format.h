@@ -82,6 +82,15 @@ void tracing_format_raw_data(uint8_t *data, uint32_t length);
  */
 void tracing_format_data(tracing_data_t *tracing_data_array, uint32_t count);
 
+/**
+ * @brief Stop tracing and output buffered data.
+ *
+ * With @kconfig{CONFIG_TRACING_OVERFLOW_OVERWRITE} this outputs the latest
+ * events kept by the flight recorder. Tracing can be enabled again with a
+ * host command.
+ */
+void tracing_flush(void);
+
 /** @} */ /* end of subsys_tracing_format_apis */
 
 #ifdef __cplusplus
@@ -69,6 +69,47 @@ struct zbus_channel_data {
 	/** Number of times data has been published to this channel */
 	uint32_t publish_count;
 #endif /* CONFIG_ZBUS_CHANNEL_PUBLISH_STATS */
+
+#if defined(CONFIG_ZBUS_ZERO_COPY) || defined(__DOXYGEN__)
+	/** Index of the message buffer holding the latest message. Only used by zero-copy
+	 * channels.
+	 */
+	atomic_t zc_current;
+
+	/** Reference count of each message buffer. NULL for regular channels. */
+	atomic_t *zc_refs;
+
+	/** Number of message buffers. Zero for regular channels. */
+	uint8_t zc_buf_count;
+
+	/** Priority of the publisher holding a loaned buffer, restored on commit. */
+	int zc_loan_prio;
+#endif /* CONFIG_ZBUS_ZERO_COPY */
+
+#if defined(CONFIG_ZBUS_ASYNC_DISPATCH) || defined(__DOXYGEN__)
+	/** Dispatcher work item publishing the queued messages. */
+	struct k_work async_work;
+
+	/** Messages published asynchronously and not dispatched yet, in publish order. */
+	sys_slist_t async_msgs;
+
+	/** Channel owning this data, set when asynchronous dispatch is first enabled. */
+	const struct zbus_channel *async_chan;
+
+	/** Number of messages in the async_msgs list. */
+	uint16_t async_pending;
+
+	/** Index of the dispatcher work queue serving the channel. */
+	uint8_t async_queue;
+
+	/** Publishing only queues the message for the dispatcher. */
+	bool async;
+#endif /* CONFIG_ZBUS_ASYNC_DISPATCH */
+
+#if defined(CONFIG_ZBUS_ASYNC_DISPATCH_METRICS) || defined(__DOXYGEN__)
+	/** Number of messages dispatched asynchronously. */
+	uint32_t async_count;
+#endif /* CONFIG_ZBUS_ASYNC_DISPATCH_METRICS */
 };
 
 /**
@@ -270,7 +311,7 @@ struct zbus_channel_observation {
 #define _ZBUS_MESSAGE_NAME(_name) _CONCAT(_zbus_message_, _name)
 
 /* clang-format off */
-#define _ZBUS_CHAN_DEFINE(_name, _id, _type, _validator, _user_data)                               \
+#define _ZBUS_CHAN_DEFINE(_name, _id, _type, _validator, _user_data, _data_init)                   \
 	static struct zbus_channel_data _CONCAT(_zbus_chan_data_, _name) = {                       \
 		.observers_start_idx = -1,                                                         \
 		.observers_end_idx = -1,                                                           \
@@ -280,6 +321,7 @@ struct zbus_channel_observation {
 		 IF_ENABLED(CONFIG_ZBUS_RUNTIME_OBSERVERS,                                         \
 			   (.observers = SYS_SLIST_STATIC_INIT(                                    \
 				&_CONCAT(_zbus_chan_data_, _name).observers),))                    \
+		__DEBRACKET _data_init                                                             \
 	};                                                                                         \
 	static K_MUTEX_DEFINE(_CONCAT(_zbus_mutex_, _name));                                       \
 	_ZBUS_CPP_EXTERN const STRUCT_SECTION_ITERABLE(zbus_channel, _name) = {                    \
@@ -383,7 +425,7 @@ struct zbus_channel_observation {
  */
 #define ZBUS_CHAN_DEFINE(_name, _type, _validator, _user_data, _observers, _init_val)              \
 	static _type _ZBUS_MESSAGE_NAME(_name) = _init_val;                                        \
-	_ZBUS_CHAN_DEFINE(_name, ZBUS_CHAN_ID_INVALID, _type, _validator, _user_data);             \
+	_ZBUS_CHAN_DEFINE(_name, ZBUS_CHAN_ID_INVALID, _type, _validator, _user_data, ());         \
 	/* Extern declaration of observers */                                                      \
 	ZBUS_OBS_DECLARE(_observers);                                                              \
 	/* Create all channel observations from observers list */                                  \
@@ -407,12 +449,53 @@ struct zbus_channel_observation {
  */
 #define ZBUS_CHAN_DEFINE_WITH_ID(_name, _id, _type, _validator, _user_data, _observers, _init_val) \
 	static _type _ZBUS_MESSAGE_NAME(_name) = _init_val;                                        \
-	_ZBUS_CHAN_DEFINE(_name, _id, _type, _validator, _user_data);                              \
+	_ZBUS_CHAN_DEFINE(_name, _id, _type, _validator, _user_data, ());                          \
 	/* Extern declaration of observers */                                                      \
 	ZBUS_OBS_DECLARE(_observers);                                                              \
 	/* Create all channel observations from observers list */                                  \
 	FOR_EACH_FIXED_ARG_NONEMPTY_TERM(_ZBUS_CHAN_OBSERVATION, (;), _name, _observers)
 
+#if defined(CONFIG_ZBUS_ZERO_COPY) || defined(__DOXYGEN__)
+
+/**
+ * @brief Zbus zero-copy channel definition.
+ *
+ * This macro defines a channel which keeps @p _buf_count reference counted copies of its
+ * message. Readers get the latest message in place with zbus_chan_borrow() without taking the
+ * channel lock, so they never block the publishers nor each other. Publishers fill one of the
+ * buffers no reader holds, either through zbus_chan_pub() or in place with zbus_chan_loan()
+ * and zbus_chan_commit(), and then make it the latest message.
+ *
+ * A publish fails with -ENOBUFS when every buffer but the latest one is still borrowed, so
+ * @p _buf_count should be at least the number of concurrent borrowers plus two.
+ *
+ * @param _name The channel's name.
+ * @param _type The Message type. It must be a struct or union.
+ * @param _validator The validator function.
+ * @param _user_data A pointer to the user data.
+ * @param _buf_count Number of message buffers, at least 2.
+ *
+ * @see struct zbus_channel
+ * @param _observers The observers list. The sequence indicates the priority of the observer. The
+ * first the highest priority.
+ * @param _init_val The message initialization.
+ */
+#define ZBUS_CHAN_DEFINE_ZERO_COPY(_name, _type, _validator, _user_data, _buf_count, _observers,   \
+				   _init_val)                                                      \
+	BUILD_ASSERT((_buf_count) >= 2 && (_buf_count) <= UINT8_MAX,                               \
+		     "A zero-copy channel needs between 2 and 255 buffers");                       \
+	static _type _ZBUS_MESSAGE_NAME(_name)[_buf_count] = {_init_val};                          \
+	static atomic_t _CONCAT(_zbus_zc_refs_, _name)[_buf_count];                                \
+	_ZBUS_CHAN_DEFINE(_name, ZBUS_CHAN_ID_INVALID, _type, _validator, _user_data,              \
+			  (.zc_refs = _CONCAT(_zbus_zc_refs_, _name),                              \
+			   .zc_buf_count = (_buf_count),));                                        \
+	/* Extern declaration of observers */                                                      \
+	ZBUS_OBS_DECLARE(_observers);                                                              \
+	/* Create all channel observations from observers list */                                  \
+	FOR_EACH_FIXED_ARG_NONEMPTY_TERM(_ZBUS_CHAN_OBSERVATION, (;), _name, _observers)
+
+#endif /* CONFIG_ZBUS_ZERO_COPY */
+
 /**
  * @brief Initialize a message.
  *
@@ -567,6 +650,10 @@ struct zbus_channel_observation {
  * observers could not receive the notification.
  * @retval -EBUSY The channel is busy.
  * @retval -EAGAIN Waiting period timed out.
+ * @retval -ENOMEM There is no room left to queue the message of an asynchronously dispatched
+ * channel.
+ * @retval -ENOBUFS Every buffer of a zero-copy channel other than the latest message is
+ * borrowed.
  * @retval -EFAULT A parameter is incorrect, the notification could not be sent to one or more
  * observer, or the function context is invalid (inside an ISR). The function only returns this
  * value when the @kconfig{CONFIG_ZBUS_ASSERT_MOCK} is enabled.
@@ -610,6 +697,8 @@ int zbus_chan_read(const struct zbus_channel *chan, void *msg, k_timeout_t timeo
  * @retval 0 Channel claimed.
  * @retval -EBUSY The channel is busy.
  * @retval -EAGAIN Waiting period timed out.
+ * @retval -ENOTSUP The channel is a zero-copy channel, use zbus_chan_loan() or
+ * zbus_chan_borrow() instead.
  * @retval -EFAULT A parameter is incorrect, or the function context is invalid (inside an ISR). The
  * function only returns this value when the @kconfig{CONFIG_ZBUS_ASSERT_MOCK} is enabled.
  */
@@ -651,6 +740,184 @@ int zbus_chan_finish(const struct zbus_channel *chan);
  */
 int zbus_chan_notify(const struct zbus_channel *chan, k_timeout_t timeout);
 
+#if defined(CONFIG_ZBUS_ZERO_COPY) || defined(__DOXYGEN__)
+
+/**
+ * @brief Check if a channel is a zero-copy channel.
+ *
+ * @param chan The channel's reference.
+ *
+ * @return true if the channel was defined with ZBUS_CHAN_DEFINE_ZERO_COPY().
+ */
+static inline bool zbus_chan_is_zero_copy(const struct zbus_channel *chan)
+{
+	__ASSERT(chan != NULL, "chan is required");
+
+	return chan->data->zc_buf_count != 0;
+}
+
+/**
+ * @brief Borrow the latest message of a zero-copy channel.
+ *
+ * This routine gives a reference to the latest message published to the channel without
+ * copying it and without taking the channel lock. The message does not change until it is
+ * given back with zbus_chan_release(), even if newer messages are published in the meantime.
+ * It can be called from ISRs.
+ *
+ * @param[in] chan The channel's reference.
+ * @param[out] msg The borrowed message.
+ *
+ * @retval 0 Message borrowed.
+ * @retval -ENOTSUP The channel is not a zero-copy channel.
+ * @retval -EFAULT A parameter is incorrect. The function only returns this value when the
+ * @kconfig{CONFIG_ZBUS_ASSERT_MOCK} is enabled.
+ */
+int zbus_chan_borrow(const struct zbus_channel *chan, const void **msg);
+
+/**
+ * @brief Give back a message borrowed from a zero-copy channel.
+ *
+ * @param chan The channel's reference.
+ * @param msg The message returned by zbus_chan_borrow().
+ *
+ * @retval 0 Message released.
+ * @retval -EINVAL @p msg is not a message buffer of the channel.
+ * @retval -ENOTSUP The channel is not a zero-copy channel.
+ * @retval -EFAULT A parameter is incorrect. The function only returns this value when the
+ * @kconfig{CONFIG_ZBUS_ASSERT_MOCK} is enabled.
+ */
+int zbus_chan_release(const struct zbus_channel *chan, const void *msg);
+
+/**
+ * @brief Loan a free message buffer of a zero-copy channel.
+ *
+ * This routine locks the channel for publishing and gives a message buffer that no reader holds.
+ * The new message is written to it in place and published with zbus_chan_commit(), or dropped
+ * with zbus_chan_loan_cancel(). Readers still access the previous message in the meantime.
+ * The buffer initially holds an older message of the channel.
+ *
+ * @param[in] chan The channel's reference.
+ * @param[out] msg The loaned message buffer.
+ * @param[in] timeout Waiting period to lock the channel,
+ *                or one of the special values K_NO_WAIT and K_FOREVER.
+ *
+ * @retval 0 Buffer loaned, the channel stays locked until it is committed or canceled.
+ * @retval -ENOBUFS All the buffers are borrowed.
+ * @retval -ENOTSUP The channel is not a zero-copy channel.
+ * @retval -EBUSY The channel is busy.
+ * @retval -EAGAIN Waiting period timed out.
+ * @retval -EFAULT A parameter is incorrect, or the function context is invalid (inside an ISR).
+ * The function only returns this value when the @kconfig{CONFIG_ZBUS_ASSERT_MOCK} is enabled.
+ */
+int zbus_chan_loan(const struct zbus_channel *chan, void **msg, k_timeout_t timeout);
+
+/**
+ * @brief Publish a message buffer loaned from a zero-copy channel.
+ *
+ * This routine makes the loaned buffer the latest message of the channel, notifies the
+ * observers and unlocks the channel.
+ *
+ * @param chan The channel's reference.
+ * @param msg The buffer returned by zbus_chan_loan().
+ * @param timeout Waiting period to notify the observers,
+ *                or one of the special values K_NO_WAIT and K_FOREVER.
+ *
+ * @retval 0 Channel published.
+ * @retval -ENOMSG The message is invalid based on the validator function or some of the
+ * observers could not receive the notification.
+ * @retval -EINVAL @p msg is not a message buffer of the channel.
+ * @retval -EFAULT A parameter is incorrect, or the notification could not be sent to one or more
+ * observer. The function only returns this value when the @kconfig{CONFIG_ZBUS_ASSERT_MOCK} is
+ * enabled.
+ */
+int zbus_chan_commit(const struct zbus_channel *chan, void *msg, k_timeout_t timeout);
+
+/**
+ * @brief Drop a message buffer loaned from a zero-copy channel.
+ *
+ * This routine unlocks the channel without publishing the loaned buffer.
+ *
+ * @param chan The channel's reference.
+ * @param msg The buffer returned by zbus_chan_loan().
+ *
+ * @retval 0 Loan canceled.
+ * @retval -EINVAL @p msg is not a message buffer of the channel.
+ * @retval -EFAULT A parameter is incorrect. The function only returns this value when the
+ * @kconfig{CONFIG_ZBUS_ASSERT_MOCK} is enabled.
+ */
+int zbus_chan_loan_cancel(const struct zbus_channel *chan, void *msg);
+
+#endif /* CONFIG_ZBUS_ZERO_COPY */
+
+#if defined(CONFIG_ZBUS_ASYNC_DISPATCH) || defined(__DOXYGEN__)
+
+/**
+ * @brief Enable or disable the asynchronous dispatch of a channel.
+ *
+ * With asynchronous dispatch, zbus_chan_pub() validates the message and only queues a copy of
+ * it, without taking the channel lock. A dispatcher work queue then publishes the queued
+ * messages to the channel and notifies the observers from its own thread, so a slow listener
+ * no longer delays the publishers. All the messages of a channel go through the same
+ * dispatcher, one at a time, in the order they were published. Messages still queued when the
+ * dispatch is disabled are published before any later message. zbus_chan_notify(),
+ * zbus_chan_claim() and zbus_chan_read() are not affected.
+ *
+ * @param chan The channel's reference.
+ * @param enabled Whether to dispatch the messages asynchronously.
+ *
+ * @retval 0 Dispatch mode changed.
+ * @retval -EINVAL The channel is zbus_async_metrics_chan, which is published by the
+ * dispatcher itself.
+ * @retval -EAGAIN The dispatcher work queues are not started yet, zbus starts them during
+ * the initialization of the channels.
+ * @retval -EFAULT A parameter is incorrect. The function only returns this value when the
+ * @kconfig{CONFIG_ZBUS_ASSERT_MOCK} is enabled.
+ */
+int zbus_chan_set_async_dispatch(const struct zbus_channel *chan, bool enabled);
+
+/**
+ * @brief Check if a channel is dispatched asynchronously.
+ *
+ * @param chan The channel's reference.
+ *
+ * @return true if zbus_chan_set_async_dispatch() enabled the asynchronous dispatch.
+ */
+static inline bool zbus_chan_is_async_dispatch(const struct zbus_channel *chan)
+{
+	__ASSERT(chan != NULL, "chan is required");
+
+	return chan->data->async;
+}
+
+#endif /* CONFIG_ZBUS_ASYNC_DISPATCH */
+
+#if defined(CONFIG_ZBUS_ASYNC_DISPATCH_METRICS) || defined(__DOXYGEN__)
+
+/**
+ * @brief Message of the zbus_async_metrics_chan channel.
+ *
+ * The dispatcher publishes one after each asynchronously dispatched message. Observers are
+ * added to the channel like to any other, at runtime with zbus_chan_add_obs().
+ */
+struct zbus_async_metrics {
+	/** Channel the message was dispatched to. */
+	const struct zbus_channel *chan;
+	/** Time from zbus_chan_pub() until the dispatcher started publishing, in microseconds. */
+	uint32_t latency_us;
+	/** Time the dispatcher took to publish and notify the observers, in microseconds. */
+	uint32_t dispatch_us;
+	/** Number of messages dispatched to the channel so far. */
+	uint32_t count;
+	/** Number of messages of the channel still queued. */
+	uint16_t pending;
+	/** Result of the publish, as zbus_chan_pub() would return it. */
+	int err;
+};
+
+ZBUS_CHAN_DECLARE(zbus_async_metrics_chan);
+
+#endif /* CONFIG_ZBUS_ASYNC_DISPATCH_METRICS */
+
 #if defined(CONFIG_ZBUS_CHANNEL_NAME) || defined(__DOXYGEN__)
 
 /**
@@ -691,7 +958,8 @@ const struct zbus_channel *zbus_chan_from_id(uint32_t channel_id);
  * This routine returns the reference of a channel message.
  *
  * @warning This function must only be used directly for already locked channels. This
- * can be done inside a listener for the receiving channel or after claim a channel.
+ * can be done inside a listener for the receiving channel or after claim a channel. The
+ * message of a zero-copy channel may be borrowed by readers and must not be modified.
  *
  * @param chan The channel's reference.
  *
@@ -701,6 +969,13 @@ static inline void *zbus_chan_msg(const struct zbus_channel *chan)
 {
 	__ASSERT(chan != NULL, "chan is required");
 
+#if defined(CONFIG_ZBUS_ZERO_COPY)
+	if (chan->data->zc_buf_count != 0) {
+		return (uint8_t *)chan->message +
+		       atomic_get(&chan->data->zc_current) * chan->message_size;
+	}
+#endif /* CONFIG_ZBUS_ZERO_COPY */
+
 	return chan->message;
 }
 
@@ -722,7 +997,7 @@ static inline const void *zbus_chan_const_msg(const struct zbus_channel *chan)
 {
 	__ASSERT(chan != NULL, "chan is required");
 
-	return chan->message;
+	return zbus_chan_msg(chan);
 }
 
 /**
@@ -5,6 +5,7 @@
  */
 #include <zephyr/kernel.h>
 #include <ksched.h>
+#include <timeout_q.h>
 #include <zephyr/spinlock.h>
 
 extern struct k_spinlock _sched_spinlock;
@@ -16,6 +17,20 @@ BUILD_ASSERT(CONFIG_MP_MAX_NUM_CPUS <= 16, "Too many CPUs for mask word");
 # endif /* CONFIG_SMP */
 
 
+#ifdef CONFIG_TIMEOUT_QUEUE_PER_CPU
+/* Keep a pending thread's timeout on a CPU the thread may run on */
+static void timeout_follow_mask(struct k_thread *thread)
+{
+	uint32_t mask = thread->base.cpu_mask & BIT_MASK(arch_num_cpus());
+	struct _timeout *to = &thread->base.timeout;
+
+	if ((mask != 0U) && !z_is_inactive_timeout(to) &&
+	    ((mask & BIT(to->cpu)) == 0U)) {
+		z_migrate_timeout(to, find_lsb_set(mask) - 1);
+	}
+}
+#endif /* CONFIG_TIMEOUT_QUEUE_PER_CPU */
+
 static int cpu_mask_mod(k_tid_t thread, uint32_t enable_mask, uint32_t disable_mask)
 {
 	int ret = 0;
@@ -29,6 +44,9 @@ static int cpu_mask_mod(k_tid_t thread, uint32_t enable_mask, uint32_t disable_m
 		if (z_is_thread_prevented_from_running(thread)) {
 			thread->base.cpu_mask |= enable_mask;
 			thread->base.cpu_mask  &= ~disable_mask;
+#ifdef CONFIG_TIMEOUT_QUEUE_PER_CPU
+			timeout_follow_mask(thread);
+#endif /* CONFIG_TIMEOUT_QUEUE_PER_CPU */
 		} else {
 			ret = -EINVAL;
 		}
@@ -21,10 +21,12 @@
 #ifdef CONFIG_SMP
 void flag_ipi(uint32_t ipi_mask);
 void signal_pending_ipi(void);
+void flush_pending_ipi(void);
 atomic_val_t ipi_mask_create(struct k_thread *thread);
 #else
 #define flag_ipi(ipi_mask) do { } while (false)
 #define signal_pending_ipi() do { } while (false)
+#define flush_pending_ipi() do { } while (false)
 #endif /* CONFIG_SMP */
 
 
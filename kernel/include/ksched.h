@@ -65,6 +65,9 @@ void *z_get_next_switch_handle(void *interrupted);
 
 void z_time_slice(void);
 void z_reset_time_slice(struct k_thread *curr);
+void z_sched_cbs_switch(struct k_thread *old_thread, struct k_thread *new_thread);
+void z_sched_cbs_switched_in(void);
+void z_sched_cbs_enforce(void);
 void z_sched_ipi(void);
 void z_sched_start(struct k_thread *thread);
 void z_ready_thread(struct k_thread *thread);
@@ -123,6 +123,10 @@ static ALWAYS_INLINE unsigned int do_swap(unsigned int key,
 	if (new_thread != old_thread) {
 		z_sched_usage_switch(new_thread);
 
+#ifdef CONFIG_SCHED_DEADLINE_CBS
+		z_sched_cbs_switch(old_thread, new_thread);
+#endif /* CONFIG_SCHED_DEADLINE_CBS */
+
 #ifdef CONFIG_SMP
 		new_thread->base.cpu = arch_curr_cpu()->id;
 
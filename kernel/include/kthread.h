@@ -97,6 +97,12 @@ static inline bool z_is_thread_prevented_from_running(struct k_thread *thread)
 {
 	uint8_t state = thread->base.thread_state;
 
+#ifdef CONFIG_SCHED_DEADLINE_CBS
+	if (thread->base.cbs.throttled) {
+		return true;
+	}
+#endif /* CONFIG_SCHED_DEADLINE_CBS */
+
 	return (state & (_THREAD_PENDING | _THREAD_SLEEPING | _THREAD_DEAD |
 			 _THREAD_DUMMY | _THREAD_SUSPENDED)) != 0U;
 }
@@ -76,6 +76,14 @@ int32_t z_get_next_timeout_expiry(void);
 
 k_ticks_t z_timeout_remaining(const struct _timeout *timeout);
 
+#ifdef CONFIG_TIMEOUT_QUEUE_PER_CPU
+/* Move an active timeout to the queue of @a cpu, keeping its expiry */
+void z_migrate_timeout(struct _timeout *to, unsigned int cpu);
+
+/* Process the expired timeouts queued on the calling CPU */
+void z_timeout_cpu_announce(void);
+#endif /* CONFIG_TIMEOUT_QUEUE_PER_CPU */
+
 #else
 
 /* Stubs when !CONFIG_SYS_CLOCK_EXISTS */
@@ -4,9 +4,11 @@
  */
 
 #include <zephyr/kernel.h>
+#include <zephyr/kernel/smp.h>
 #include <kswap.h>
 #include <ksched.h>
 #include <ipi.h>
+#include <timeout_q.h>
 
 #ifdef CONFIG_TRACE_SCHED_IPI
 extern void z_trace_sched_ipi(void);
@@ -66,7 +68,7 @@ atomic_val_t ipi_mask_create(struct k_thread *thread)
 	return (atomic_val_t)ipi_mask;
 }
 
-void signal_pending_ipi(void)
+void flush_pending_ipi(void)
 {
 	/* Synchronization note: you might think we need to lock these
 	 * two steps, but an IPI is idempotent.  It's OK if we do it
@@ -91,6 +93,122 @@ void signal_pending_ipi(void)
 #endif /* CONFIG_SCHED_IPI_SUPPORTED */
 }
 
+void signal_pending_ipi(void)
+{
+	/* When coalescing, IPIs flagged from interrupt context are left
+	 * pending and sent in a single batch by flush_pending_ipi() as
+	 * the interrupt exits through z_get_next_switch_handle().
+	 */
+	if (IS_ENABLED(CONFIG_IPI_COALESCE) && arch_is_in_isr()) {
+		return;
+	}
+
+	flush_pending_ipi();
+}
+
+#ifdef CONFIG_SCHED_IPI_WORK
+static struct k_spinlock ipi_work_lock;
+
+void k_ipi_work_init(struct k_ipi_work *work)
+{
+	atomic_clear(&work->pending);
+}
+
+int k_ipi_work_add(struct k_ipi_work *work, uint32_t cpu_bitmask,
+		   k_ipi_func_t func)
+{
+	k_spinlock_key_t key;
+	uint32_t targets;
+
+	key = k_spin_lock(&ipi_work_lock);
+
+	targets = cpu_bitmask & BIT_MASK(arch_num_cpus()) &
+		  ~BIT(_current_cpu->id);
+	if (targets == 0U) {
+		k_spin_unlock(&ipi_work_lock, key);
+		return -EINVAL;
+	}
+
+	if (atomic_get(&work->pending) != 0) {
+		k_spin_unlock(&ipi_work_lock, key);
+		return -EBUSY;
+	}
+
+	work->func = func;
+	atomic_set(&work->pending, (atomic_val_t)targets);
+
+	for (uint32_t i = 0; i < arch_num_cpus(); i++) {
+		if ((targets & BIT(i)) != 0U) {
+			sys_slist_append(&_kernel.cpus[i].ipi_workq,
+					 &work->node[i]);
+		}
+	}
+
+	flag_ipi(targets);
+
+	k_spin_unlock(&ipi_work_lock, key);
+
+	return 0;
+}
+
+void k_ipi_work_signal(void)
+{
+	flush_pending_ipi();
+}
+
+int k_ipi_work_wait(struct k_ipi_work *work, k_timeout_t timeout)
+{
+	k_timepoint_t end = sys_timepoint_calc(timeout);
+
+	/* Clearing its bit in the pending mask is the last access a
+	 * target CPU makes to the item, so poll the mask: signalling a
+	 * kernel object after the clear would let the caller free the
+	 * item while that CPU still uses it.
+	 */
+	while (atomic_get(&work->pending) != 0) {
+		if (K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
+			return -EBUSY;
+		}
+
+		if (sys_timepoint_expired(end)) {
+			return -EAGAIN;
+		}
+
+		if (!k_is_in_isr()) {
+			k_yield();
+		}
+	}
+
+	return 0;
+}
+
+/* Run the cross-CPU function calls queued for this CPU. Called from
+ * the scheduling IPI handler.
+ */
+static void ipi_work_process(void)
+{
+	uint32_t id = _current_cpu->id;
+	sys_slist_t *list = &_current_cpu->ipi_workq;
+	struct k_ipi_work *work;
+	k_spinlock_key_t key;
+	sys_snode_t *node;
+
+	key = k_spin_lock(&ipi_work_lock);
+	while ((node = sys_slist_get(list)) != NULL) {
+		k_spin_unlock(&ipi_work_lock, key);
+
+		work = CONTAINER_OF(node - id, struct k_ipi_work, node[0]);
+		work->func(work);
+
+		/* Last access: the item may be reused or freed after this */
+		(void)atomic_and(&work->pending, ~BIT(id));
+
+		key = k_spin_lock(&ipi_work_lock);
+	}
+	k_spin_unlock(&ipi_work_lock, key);
+}
+#endif /* CONFIG_SCHED_IPI_WORK */
+
 void z_sched_ipi(void)
 {
 	/* NOTE: When adding code to this, make sure this is called
@@ -100,6 +218,18 @@ void z_sched_ipi(void)
 	z_trace_sched_ipi();
 #endif /* CONFIG_TRACE_SCHED_IPI */
 
+#ifdef CONFIG_SCHED_IPI_WORK
+	ipi_work_process();
+#endif /* CONFIG_SCHED_IPI_WORK */
+
+#ifdef CONFIG_TIMEOUT_QUEUE_PER_CPU
+	z_timeout_cpu_announce();
+#endif /* CONFIG_TIMEOUT_QUEUE_PER_CPU */
+
+#ifdef CONFIG_SCHED_DEADLINE_CBS
+	z_sched_cbs_enforce();
+#endif /* CONFIG_SCHED_DEADLINE_CBS */
+
 #ifdef CONFIG_TIMESLICING
 	if (thread_is_sliceable(_current)) {
 		z_time_slice();
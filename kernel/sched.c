@@ -38,6 +38,10 @@ __incoherent struct k_thread _thread_dummy;
 static ALWAYS_INLINE void update_cache(int preempt_ok);
 static ALWAYS_INLINE void halt_thread(struct k_thread *thread, uint8_t new_state);
 static void add_to_waitq_locked(struct k_thread *thread, _wait_q_t *wait_q);
+#ifdef CONFIG_SCHED_DEADLINE_CBS
+static void cbs_wakeup(struct k_thread *thread);
+static void cbs_release(struct k_thread *thread);
+#endif /* CONFIG_SCHED_DEADLINE_CBS */
 
 
 BUILD_ASSERT(CONFIG_NUM_COOP_PRIORITIES >= CONFIG_NUM_METAIRQ_PRIORITIES,
@@ -347,6 +351,9 @@ static void ready_thread(struct k_thread *thread)
 	if (!z_is_thread_queued(thread) && z_is_thread_ready(thread)) {
 		SYS_PORT_TRACING_OBJ_FUNC(k_thread, sched_ready, thread);
 
+#ifdef CONFIG_SCHED_DEADLINE_CBS
+		cbs_wakeup(thread);
+#endif /* CONFIG_SCHED_DEADLINE_CBS */
 		queue_thread(thread);
 		update_cache(0);
 
@@ -870,6 +877,9 @@ void *z_get_next_switch_handle(void *interrupted)
 		if (old_thread != new_thread) {
 			uint8_t  cpu_id;
 
+#ifdef CONFIG_SCHED_DEADLINE_CBS
+			z_sched_cbs_switch(old_thread, new_thread);
+#endif /* CONFIG_SCHED_DEADLINE_CBS */
 			update_metairq_preempt(new_thread);
 			z_sched_switch_spin(new_thread);
 			arch_cohere_stacks(old_thread, interrupted, new_thread);
@@ -915,10 +925,17 @@ void *z_get_next_switch_handle(void *interrupted)
 			new_thread->switch_handle = NULL;
 		}
 	}
-	signal_pending_ipi();
+	flush_pending_ipi();
 	return ret;
 #else
 	z_sched_usage_switch(_kernel.ready_q.cache);
+#ifdef CONFIG_SCHED_DEADLINE_CBS
+	if (_current != _kernel.ready_q.cache) {
+		K_SPINLOCK(&_sched_spinlock) {
+			z_sched_cbs_switch(_current, _kernel.ready_q.cache);
+		}
+	}
+#endif /* CONFIG_SCHED_DEADLINE_CBS */
 	_current->switch_handle = interrupted;
 	set_current(_kernel.ready_q.cache);
 	return _current->switch_handle;
@@ -1028,6 +1045,278 @@ static inline void z_vrfy_k_thread_deadline_set(k_tid_t tid, int deadline)
 }
 #include <zephyr/syscalls/k_thread_deadline_set_mrsh.c>
 #endif /* CONFIG_USERSPACE */
+
+#ifdef CONFIG_SCHED_DEADLINE_CBS
+/* Budget accounting of the reservation running on each CPU */
+struct cbs_cpu {
+	/* Thread being charged, or NULL */
+	struct k_thread *thread;
+	uint32_t start;
+	struct _timeout budget_timeout;
+	bool expired;
+};
+
+static struct cbs_cpu cbs_cpus[CONFIG_MP_MAX_NUM_CPUS];
+
+/* Sum of budget/period over all reservations, in parts per million */
+static uint32_t cbs_utilization;
+
+#define CBS_UTIL_SCALE 1000000U
+#define CBS_UTIL_MAX   (CONFIG_SCHED_DEADLINE_CBS_MAX_UTILIZATION * (CBS_UTIL_SCALE / 100U))
+
+static inline bool thread_has_cbs(struct k_thread *thread)
+{
+	return thread->base.cbs.budget != 0U;
+}
+
+static uint32_t cbs_util(uint32_t budget, uint32_t period)
+{
+	return (period == 0U) ? 0U :
+		(uint32_t)(((uint64_t)budget * CBS_UTIL_SCALE) / period);
+}
+
+static inline k_timeout_t cbs_cyc_timeout(int32_t cycles)
+{
+	return K_TICKS(k_cyc_to_ticks_ceil32(MAX(cycles, 0)));
+}
+
+/* The prio_deadline field changes the sorting order, so requeue the
+ * thread around the update if needed.
+ */
+static void cbs_deadline_set(struct k_thread *thread, int32_t deadline)
+{
+	if (z_is_thread_queued(thread)) {
+		dequeue_thread(thread);
+		thread->base.prio_deadline = deadline;
+		queue_thread(thread);
+	} else {
+		thread->base.prio_deadline = deadline;
+	}
+}
+
+static void cbs_budget_expired(struct _timeout *timeout)
+{
+	struct cbs_cpu *c = CONTAINER_OF(timeout, struct cbs_cpu, budget_timeout);
+	int cpu = ARRAY_INDEX(cbs_cpus, c);
+
+	c->expired = true;
+
+	/* Like timeslice expiry, the owning CPU enforces the budget */
+	if (cpu != _current_cpu->id) {
+		flag_ipi(IPI_CPU_MASK(cpu));
+	}
+}
+
+static void cbs_charge(struct cbs_cpu *c)
+{
+	if (c->thread != NULL) {
+		c->thread->base.cbs.remaining -= (int32_t)(k_cycle_get_32() - c->start);
+		c->thread = NULL;
+		z_abort_timeout(&c->budget_timeout);
+	}
+}
+
+static void cbs_start(struct cbs_cpu *c, struct k_thread *thread)
+{
+	if (!thread_has_cbs(thread) || thread->base.cbs.throttled) {
+		return;
+	}
+
+	c->thread = thread;
+	c->start = k_cycle_get_32();
+	c->expired = false;
+	z_add_timeout(&c->budget_timeout, cbs_budget_expired,
+		      cbs_cyc_timeout(thread->base.cbs.remaining));
+}
+
+/* Must be called with _sched_spinlock held */
+void z_sched_cbs_switch(struct k_thread *old_thread, struct k_thread *new_thread)
+{
+	struct cbs_cpu *c = &cbs_cpus[_current_cpu->id];
+
+	ARG_UNUSED(old_thread);
+
+	cbs_charge(c);
+	cbs_start(c, new_thread);
+}
+
+#ifndef CONFIG_USE_SWITCH
+/* Called from the arch_swap() paths once _current is the incoming thread */
+void z_sched_cbs_switched_in(void)
+{
+	K_SPINLOCK(&_sched_spinlock) {
+		struct cbs_cpu *c = &cbs_cpus[_current_cpu->id];
+
+		if (c->thread != _current) {
+			cbs_charge(c);
+			cbs_start(c, _current);
+		}
+	}
+}
+#endif /* !CONFIG_USE_SWITCH */
+
+static void cbs_replenish(struct _timeout *timeout)
+{
+	struct k_thread *thread = CONTAINER_OF(timeout, struct k_thread,
+					       base.cbs.replenish);
+
+	K_SPINLOCK(&_sched_spinlock) {
+		if (thread->base.cbs.throttled) {
+			thread->base.cbs.remaining = thread->base.cbs.budget;
+			thread->base.prio_deadline += thread->base.cbs.period;
+			thread->base.cbs.throttled = false;
+			ready_thread(thread);
+		}
+	}
+}
+
+static void cbs_exhausted(struct cbs_cpu *c, struct k_thread *thread)
+{
+	uint32_t now = k_cycle_get_32();
+	int32_t left = (int32_t)(thread->base.prio_deadline - now);
+
+	if (left <= 0) {
+		/* Deadline already missed: restart the server from now */
+		thread->base.cbs.remaining = thread->base.cbs.budget;
+		cbs_deadline_set(thread, now + thread->base.cbs.period);
+		cbs_start(c, thread);
+		update_cache(thread == _current);
+		return;
+	}
+
+	thread->base.cbs.throttled = true;
+	if (z_is_thread_queued(thread)) {
+		dequeue_thread(thread);
+	}
+	update_cache(thread == _current);
+	z_add_timeout(&thread->base.cbs.replenish, cbs_replenish,
+		      cbs_cyc_timeout(left));
+}
+
+/* Called out of each timer interrupt and scheduling IPI */
+void z_sched_cbs_enforce(void)
+{
+	K_SPINLOCK(&_sched_spinlock) {
+		struct cbs_cpu *c = &cbs_cpus[_current_cpu->id];
+		struct k_thread *thread = c->thread;
+
+		if (c->expired && (thread != NULL)) {
+			c->expired = false;
+			cbs_charge(c);
+			if (thread->base.cbs.remaining > 0) {
+				/* Tick rounding fired the timeout early */
+				cbs_start(c, thread);
+			} else {
+				cbs_exhausted(c, thread);
+			}
+		}
+	}
+}
+
+/* CBS wakeup rule: keep the current budget and deadline only if that
+ * does not exceed the reserved bandwidth, i.e. if
+ * remaining / (deadline - now) <= budget / period.
+ */
+static void cbs_wakeup(struct k_thread *thread)
+{
+	struct _thread_cbs *cbs = &thread->base.cbs;
+	uint32_t now = k_cycle_get_32();
+	int32_t left;
+
+	if (!thread_has_cbs(thread)) {
+		return;
+	}
+
+	left = (int32_t)(thread->base.prio_deadline - now);
+	if ((left <= 0) ||
+	    ((uint64_t)MAX(cbs->remaining, 0) * cbs->period >
+	     (uint64_t)left * cbs->budget)) {
+		cbs->remaining = cbs->budget;
+		thread->base.prio_deadline = now + cbs->period;
+	}
+}
+
+static void cbs_release(struct k_thread *thread)
+{
+	if (!thread_has_cbs(thread)) {
+		return;
+	}
+
+	for (unsigned int i = 0; i < arch_num_cpus(); i++) {
+		if (cbs_cpus[i].thread == thread) {
+			cbs_cpus[i].thread = NULL;
+			z_abort_timeout(&cbs_cpus[i].budget_timeout);
+		}
+	}
+
+	z_abort_timeout(&thread->base.cbs.replenish);
+	cbs_utilization -= cbs_util(thread->base.cbs.budget,
+				    thread->base.cbs.period);
+	thread->base.cbs.budget = 0U;
+	thread->base.cbs.throttled = false;
+}
+
+int z_impl_k_thread_cbs_set(k_tid_t thread, uint32_t budget_us, uint32_t period_us)
+{
+	uint32_t budget = k_us_to_cyc_ceil32(budget_us);
+	uint32_t period = k_us_to_cyc_ceil32(period_us);
+	uint32_t util;
+	int ret = 0;
+
+	if ((budget_us != 0U) && ((period_us == 0U) || (budget_us > period_us) ||
+				  (period > (uint32_t)INT_MAX))) {
+		return -EINVAL;
+	}
+
+	util = (budget_us == 0U) ? 0U : cbs_util(budget, period);
+
+	K_SPINLOCK(&_sched_spinlock) {
+		uint32_t old_util = cbs_util(thread->base.cbs.budget,
+					     thread->base.cbs.period);
+		bool was_throttled = thread->base.cbs.throttled;
+
+		/* A dead thread would never give its reservation back */
+		if (z_is_thread_state_set(thread, _THREAD_DEAD)) {
+			ret = -EINVAL;
+			K_SPINLOCK_BREAK;
+		}
+
+		if ((cbs_utilization - old_util + util) > CBS_UTIL_MAX) {
+			ret = -EBUSY;
+			K_SPINLOCK_BREAK;
+		}
+
+		cbs_release(thread);
+		if (util != 0U) {
+			cbs_utilization += util;
+			thread->base.cbs.budget = budget;
+			thread->base.cbs.period = period;
+			thread->base.cbs.remaining = budget;
+			cbs_deadline_set(thread, k_cycle_get_32() + period);
+			if (thread == _current) {
+				cbs_start(&cbs_cpus[_current_cpu->id], thread);
+			}
+		}
+
+		if (was_throttled) {
+			ready_thread(thread);
+		}
+	}
+
+	return ret;
+}
+
+#ifdef CONFIG_USERSPACE
+static inline int z_vrfy_k_thread_cbs_set(k_tid_t thread, uint32_t budget_us,
+					  uint32_t period_us)
+{
+	K_OOPS(K_SYSCALL_OBJ(thread, K_OBJ_THREAD));
+
+	return z_impl_k_thread_cbs_set(thread, budget_us, period_us);
+}
+#include <zephyr/syscalls/k_thread_cbs_set_mrsh.c>
+#endif /* CONFIG_USERSPACE */
+#endif /* CONFIG_SCHED_DEADLINE_CBS */
 #endif /* CONFIG_SCHED_DEADLINE */
 
 void z_impl_k_reschedule(void)
@@ -1249,6 +1538,9 @@ static ALWAYS_INLINE void halt_thread(struct k_thread *thread, uint8_t new_state
 				unpend_thread_no_timeout(thread);
 			}
 			z_abort_thread_timeout(thread);
+#ifdef CONFIG_SCHED_DEADLINE_CBS
+			cbs_release(thread);
+#endif /* CONFIG_SCHED_DEADLINE_CBS */
 			unpend_all(&thread->join_queue);
 
 			/* Edge case: aborting _current from within an
@@ -631,6 +631,11 @@ char *z_setup_new_thread(struct k_thread *new_thread,
 #ifdef CONFIG_SCHED_DEADLINE
 	new_thread->base.prio_deadline = 0;
 #endif /* CONFIG_SCHED_DEADLINE */
+#ifdef CONFIG_SCHED_DEADLINE_CBS
+	new_thread->base.cbs.budget = 0U;
+	new_thread->base.cbs.throttled = false;
+	z_init_timeout(&new_thread->base.cbs.replenish);
+#endif /* CONFIG_SCHED_DEADLINE_CBS */
 	new_thread->resource_pool = _current->resource_pool;
 
 #ifdef CONFIG_SMP
@@ -920,6 +925,10 @@ void z_thread_mark_switched_in(void)
 	z_sched_usage_start(_current);
 #endif /* CONFIG_SCHED_THREAD_USAGE && !CONFIG_USE_SWITCH */
 
+#if defined(CONFIG_SCHED_DEADLINE_CBS) && !defined(CONFIG_USE_SWITCH)
+	z_sched_cbs_switched_in();
+#endif /* CONFIG_SCHED_DEADLINE_CBS && !CONFIG_USE_SWITCH */
+
 #ifdef CONFIG_TRACING
 	SYS_PORT_TRACING_FUNC(k_thread, switched_in);
 #endif /* CONFIG_TRACING */
@@ -8,13 +8,45 @@
 #include <zephyr/spinlock.h>
 #include <ksched.h>
 #include <timeout_q.h>
+#include <ipi.h>
 #include <zephyr/internal/syscall_handler.h>
 #include <zephyr/drivers/timer/system_timer.h>
 #include <zephyr/sys_clock.h>
 
 static uint64_t curr_tick;
 
+#ifdef CONFIG_TIMEOUT_QUEUE_PER_CPU
+/*
+ * One delta list per CPU. Timeouts are armed on the queue of the CPU
+ * that adds them and expire there. The deltas of a queue are relative
+ * to its own tick, which lags curr_tick until the queue is caught up,
+ * either by its CPU processing expired timeouts or by the announcing
+ * CPU when nothing in the queue has expired yet.
+ */
+struct timeout_q {
+	sys_dlist_t list;
+	struct k_spinlock lock;
+	uint64_t tick;
+	bool announcing;
+	/* Set when the queue holds expired timeouts for its CPU to run */
+	atomic_t expired;
+};
+
+#define TIMEOUT_Q_INIT(i, _) { .list = SYS_DLIST_STATIC_INIT(&timeout_qs[i].list) }
+
+static struct timeout_q timeout_qs[CONFIG_MP_MAX_NUM_CPUS] = {
+	LISTIFY(CONFIG_MP_MAX_NUM_CPUS, TIMEOUT_Q_INIT, (,))
+};
+
+/*
+ * Serializes reprogramming of the system timer. Lock order is
+ * timer_lock, then queue locks (in ascending CPU order), then
+ * timeout_lock.
+ */
+static struct k_spinlock timer_lock;
+#else
 static sys_dlist_t timeout_list = SYS_DLIST_STATIC_INIT(&timeout_list);
+#endif /* CONFIG_TIMEOUT_QUEUE_PER_CPU */
 
 /*
  * The timeout code shall take no locks other than its own (timeout_lock), nor
@@ -25,8 +57,10 @@ static struct k_spinlock timeout_lock;
 #define MAX_WAIT (IS_ENABLED(CONFIG_SYSTEM_CLOCK_SLOPPY_IDLE) \
 		  ? K_TICKS_FOREVER : INT_MAX)
 
+#ifndef CONFIG_TIMEOUT_QUEUE_PER_CPU
 /* Ticks left to process in the currently-executing sys_clock_announce() */
 static int announce_remaining;
+#endif /* !CONFIG_TIMEOUT_QUEUE_PER_CPU */
 
 #if defined(CONFIG_TIMER_READS_ITS_FREQUENCY_AT_RUNTIME)
 unsigned int z_clock_hw_cycles_per_sec = CONFIG_SYS_CLOCK_HW_CYCLES_PER_SEC;
@@ -40,29 +74,76 @@ static inline unsigned int z_vrfy_sys_clock_hw_cycles_per_sec_runtime_get(void)
 #endif /* CONFIG_USERSPACE */
 #endif /* CONFIG_TIMER_READS_ITS_FREQUENCY_AT_RUNTIME */
 
-static struct _timeout *first(void)
+static struct _timeout *first_in(sys_dlist_t *list)
 {
-	sys_dnode_t *t = sys_dlist_peek_head(&timeout_list);
+	sys_dnode_t *t = sys_dlist_peek_head(list);
 
 	return (t == NULL) ? NULL : CONTAINER_OF(t, struct _timeout, node);
 }
 
-static struct _timeout *next(struct _timeout *t)
+static struct _timeout *next_in(sys_dlist_t *list, struct _timeout *t)
 {
-	sys_dnode_t *n = sys_dlist_peek_next(&timeout_list, &t->node);
+	sys_dnode_t *n = sys_dlist_peek_next(list, &t->node);
 
 	return (n == NULL) ? NULL : CONTAINER_OF(n, struct _timeout, node);
 }
 
-static void remove_timeout(struct _timeout *t)
+static void remove_timeout_from(sys_dlist_t *list, struct _timeout *t)
 {
-	if (next(t) != NULL) {
-		next(t)->dticks += t->dticks;
+	if (next_in(list, t) != NULL) {
+		next_in(list, t)->dticks += t->dticks;
 	}
 
 	sys_dlist_remove(&t->node);
 }
 
+/* Insert @a to, whose dticks is relative to the list origin, into a
+ * delta list.
+ */
+static void insert_timeout(sys_dlist_t *list, struct _timeout *to)
+{
+	struct _timeout *t;
+
+	for (t = first_in(list); t != NULL; t = next_in(list, t)) {
+		if (t->dticks > to->dticks) {
+			t->dticks -= to->dticks;
+			sys_dlist_insert(&t->node, &to->node);
+			break;
+		}
+		to->dticks -= t->dticks;
+	}
+
+	if (t == NULL) {
+		sys_dlist_append(list, &to->node);
+	}
+}
+
+/* must be locked */
+static k_ticks_t timeout_rem_in(sys_dlist_t *list, const struct _timeout *timeout)
+{
+	k_ticks_t ticks = 0;
+
+	for (struct _timeout *t = first_in(list); t != NULL; t = next_in(list, t)) {
+		ticks += t->dticks;
+		if (timeout == t) {
+			break;
+		}
+	}
+
+	return ticks;
+}
+
+#ifndef CONFIG_TIMEOUT_QUEUE_PER_CPU
+static struct _timeout *first(void)
+{
+	return first_in(&timeout_list);
+}
+
+static void remove_timeout(struct _timeout *t)
+{
+	remove_timeout_from(&timeout_list, t);
+}
+
 static int32_t elapsed(void)
 {
 	/* While sys_clock_announce() is executing, new relative timeouts will be
@@ -115,7 +196,6 @@ k_ticks_t z_add_timeout(struct _timeout *to, _timeout_func_t fn, k_timeout_t tim
 	to->fn = fn;
 
 	K_SPINLOCK(&timeout_lock) {
-		struct _timeout *t;
 		int32_t ticks_elapsed;
 		bool has_elapsed = false;
 
@@ -131,18 +211,7 @@ k_ticks_t z_add_timeout(struct _timeout *to, _timeout_func_t fn, k_timeout_t tim
 			ticks = timeout.ticks;
 		}
 
-		for (t = first(); t != NULL; t = next(t)) {
-			if (t->dticks > to->dticks) {
-				t->dticks -= to->dticks;
-				sys_dlist_insert(&t->node, &to->node);
-				break;
-			}
-			to->dticks -= t->dticks;
-		}
-
-		if (t == NULL) {
-			sys_dlist_append(&timeout_list, &to->node);
-		}
+		insert_timeout(&timeout_list, to);
 
 		if (to == first() && announce_remaining == 0) {
 			if (!has_elapsed) {
@@ -178,28 +247,13 @@ int z_abort_timeout(struct _timeout *to)
 	return ret;
 }
 
-/* must be locked */
-static k_ticks_t timeout_rem(const struct _timeout *timeout)
-{
-	k_ticks_t ticks = 0;
-
-	for (struct _timeout *t = first(); t != NULL; t = next(t)) {
-		ticks += t->dticks;
-		if (timeout == t) {
-			break;
-		}
-	}
-
-	return ticks;
-}
-
 k_ticks_t z_timeout_remaining(const struct _timeout *timeout)
 {
 	k_ticks_t ticks = 0;
 
 	K_SPINLOCK(&timeout_lock) {
 		if (!z_is_inactive_timeout(timeout)) {
-			ticks = timeout_rem(timeout) - elapsed();
+			ticks = timeout_rem_in(&timeout_list, timeout) - elapsed();
 		}
 	}
 
@@ -213,7 +267,7 @@ k_ticks_t z_timeout_expires(const struct _timeout *timeout)
 	K_SPINLOCK(&timeout_lock) {
 		ticks = curr_tick;
 		if (!z_is_inactive_timeout(timeout)) {
-			ticks += timeout_rem(timeout);
+			ticks += timeout_rem_in(&timeout_list, timeout);
 		}
 	}
 
@@ -276,10 +330,400 @@ void sys_clock_announce(int32_t ticks)
 
 	k_spin_unlock(&timeout_lock, key);
 
+#ifdef CONFIG_SCHED_DEADLINE_CBS
+	z_sched_cbs_enforce();
+#endif /* CONFIG_SCHED_DEADLINE_CBS */
+
 #ifdef CONFIG_TIMESLICING
 	z_time_slice();
 #endif /* CONFIG_TIMESLICING */
 }
+#else /* CONFIG_TIMEOUT_QUEUE_PER_CPU */
+
+static int32_t elapsed(void)
+{
+	return sys_clock_elapsed();
+}
+
+static inline uint64_t announced_tick(void)
+{
+	uint64_t t = 0U;
+
+	K_SPINLOCK(&timeout_lock) {
+		t = curr_tick;
+	}
+	return t;
+}
+
+static inline uint64_t now_tick(void)
+{
+	uint64_t t = 0U;
+
+	K_SPINLOCK(&timeout_lock) {
+		t = curr_tick + elapsed();
+	}
+	return t;
+}
+
+/* Queue of the calling CPU. Any queue gives correct results, so it does
+ * not matter if the caller migrates right after this returns.
+ */
+static struct timeout_q *local_q(void)
+{
+	unsigned int key = arch_irq_lock();
+	struct timeout_q *q = &timeout_qs[arch_curr_cpu()->id];
+
+	arch_irq_unlock(key);
+
+	return q;
+}
+
+/* Lock the queue @a to is armed on, coping with concurrent migration */
+static struct timeout_q *timeout_q_lock(const struct _timeout *to,
+					k_spinlock_key_t *key)
+{
+	struct timeout_q *q;
+
+	for (;;) {
+		q = &timeout_qs[to->cpu];
+		*key = k_spin_lock(&q->lock);
+		if (&timeout_qs[to->cpu] == q) {
+			return q;
+		}
+		k_spin_unlock(&q->lock, *key);
+	}
+}
+
+/* Advance an idle queue to @a target without running anything.
+ * Returns false if the queue has expired timeouts that its CPU needs to
+ * process. Must be called with the queue locked.
+ */
+static bool timeout_q_catch_up(struct timeout_q *q, uint64_t target)
+{
+	struct _timeout *t = first_in(&q->list);
+	k_ticks_t lag = (k_ticks_t)(target - q->tick);
+
+	if (q->announcing) {
+		/* The running announce loop picks up new ticks itself */
+		return true;
+	}
+
+	if (t != NULL) {
+		if (t->dticks <= lag) {
+			return false;
+		}
+		t->dticks -= lag;
+	}
+	q->tick = target;
+
+	return true;
+}
+
+/* Absolute tick of the earliest timeout in any queue */
+static uint64_t next_expiry_tick(void)
+{
+	uint64_t next = UINT64_MAX;
+
+	for (unsigned int i = 0; i < arch_num_cpus(); i++) {
+		struct timeout_q *q = &timeout_qs[i];
+
+		K_SPINLOCK(&q->lock) {
+			struct _timeout *t = first_in(&q->list);
+
+			if (t != NULL) {
+				next = MIN(next, q->tick + t->dticks);
+			}
+		}
+	}
+
+	return next;
+}
+
+static int32_t next_timeout(void)
+{
+	uint64_t next = next_expiry_tick();
+	uint64_t now = now_tick();
+
+	if (next == UINT64_MAX) {
+		return MAX_WAIT;
+	}
+	if (next <= now) {
+		return 0;
+	}
+	if ((next - now) > (uint64_t)INT_MAX) {
+		return MAX_WAIT;
+	}
+
+	return (int32_t)(next - now);
+}
+
+static void update_timer(void)
+{
+	K_SPINLOCK(&timer_lock) {
+		sys_clock_set_timeout(next_timeout(), false);
+	}
+}
+
+k_ticks_t z_add_timeout(struct _timeout *to, _timeout_func_t fn, k_timeout_t timeout)
+{
+	struct timeout_q *q;
+	k_spinlock_key_t key;
+	k_ticks_t ticks = 0;
+	bool reprogram;
+
+	if (K_TIMEOUT_EQ(timeout, K_FOREVER)) {
+		return 0;
+	}
+
+#ifdef CONFIG_KERNEL_COHERENCE
+	__ASSERT_NO_MSG(arch_mem_coherent(to));
+#endif /* CONFIG_KERNEL_COHERENCE */
+
+	__ASSERT(!sys_dnode_is_linked(&to->node), "");
+	to->fn = fn;
+
+	q = local_q();
+	key = k_spin_lock(&q->lock);
+
+	if (!q->announcing) {
+		(void)timeout_q_catch_up(q, announced_tick());
+	}
+
+	if (Z_IS_TIMEOUT_RELATIVE(timeout)) {
+		/* Relative timeouts added from a callback of this queue are
+		 * scheduled from the tick of the timeout being processed.
+		 */
+		k_ticks_t ticks_elapsed = q->announcing ? 0 :
+					  (k_ticks_t)(now_tick() - q->tick);
+
+		to->dticks = timeout.ticks + 1 + ticks_elapsed;
+	} else {
+		k_ticks_t dticks = Z_TICK_ABS(timeout.ticks) - q->tick;
+
+		to->dticks = MAX(1, dticks);
+	}
+	ticks = q->tick + to->dticks;
+
+	to->cpu = (uint8_t)(q - timeout_qs);
+	insert_timeout(&q->list, to);
+	reprogram = (to == first_in(&q->list)) && !q->announcing;
+
+	k_spin_unlock(&q->lock, key);
+
+	if (reprogram) {
+		update_timer();
+	}
+
+	return Z_IS_TIMEOUT_RELATIVE(timeout) ? ticks : timeout.ticks;
+}
+
+int z_abort_timeout(struct _timeout *to)
+{
+	struct timeout_q *q;
+	k_spinlock_key_t key;
+	bool reprogram = false;
+	int ret = -EINVAL;
+
+	q = timeout_q_lock(to, &key);
+	if (sys_dnode_is_linked(&to->node)) {
+		reprogram = (to == first_in(&q->list)) && !q->announcing;
+		remove_timeout_from(&q->list, to);
+		to->dticks = TIMEOUT_DTICKS_ABORTED;
+		ret = 0;
+	}
+	k_spin_unlock(&q->lock, key);
+
+	if (reprogram) {
+		update_timer();
+	}
+
+	return ret;
+}
+
+void z_migrate_timeout(struct _timeout *to, unsigned int cpu)
+{
+	struct timeout_q *src, *dst = &timeout_qs[cpu];
+	k_spinlock_key_t key, key2;
+	uint64_t expiry;
+
+	src = timeout_q_lock(to, &key);
+	if ((src == dst) || !sys_dnode_is_linked(&to->node)) {
+		k_spin_unlock(&src->lock, key);
+		return;
+	}
+
+	/* Queue locks nest in ascending CPU order */
+	if (dst < src) {
+		k_spin_unlock(&src->lock, key);
+		key = k_spin_lock(&dst->lock);
+		key2 = k_spin_lock(&src->lock);
+		if (!sys_dnode_is_linked(&to->node) ||
+		    (&timeout_qs[to->cpu] != src)) {
+			/* Fired or moved while unlocked, leave it be */
+			k_spin_unlock(&src->lock, key2);
+			k_spin_unlock(&dst->lock, key);
+			return;
+		}
+	} else {
+		key2 = k_spin_lock(&dst->lock);
+	}
+
+	expiry = src->tick + timeout_rem_in(&src->list, to);
+	remove_timeout_from(&src->list, to);
+
+	to->dticks = MAX(1, (k_ticks_t)(expiry - dst->tick));
+	to->cpu = (uint8_t)cpu;
+	insert_timeout(&dst->list, to);
+
+	if (dst < src) {
+		k_spin_unlock(&src->lock, key2);
+		k_spin_unlock(&dst->lock, key);
+	} else {
+		k_spin_unlock(&dst->lock, key2);
+		k_spin_unlock(&src->lock, key);
+	}
+}
+
+k_ticks_t z_timeout_remaining(const struct _timeout *timeout)
+{
+	struct timeout_q *q;
+	k_spinlock_key_t key;
+	k_ticks_t ticks = 0;
+
+	q = timeout_q_lock(timeout, &key);
+	if (!z_is_inactive_timeout(timeout)) {
+		ticks = (k_ticks_t)(q->tick + timeout_rem_in(&q->list, timeout) -
+				    now_tick());
+	}
+	k_spin_unlock(&q->lock, key);
+
+	return ticks;
+}
+
+k_ticks_t z_timeout_expires(const struct _timeout *timeout)
+{
+	struct timeout_q *q;
+	k_spinlock_key_t key;
+	k_ticks_t ticks = 0;
+
+	q = timeout_q_lock(timeout, &key);
+	if (!z_is_inactive_timeout(timeout)) {
+		ticks = q->tick + timeout_rem_in(&q->list, timeout);
+	} else {
+		ticks = announced_tick();
+	}
+	k_spin_unlock(&q->lock, key);
+
+	return ticks;
+}
+
+int32_t z_get_next_timeout_expiry(void)
+{
+	return next_timeout();
+}
+
+/* Run the expired timeouts of @a q, catching its tick up with curr_tick */
+static void timeout_q_announce(struct timeout_q *q)
+{
+	k_spinlock_key_t key = k_spin_lock(&q->lock);
+	struct _timeout *t;
+	uint64_t target;
+
+	if (q->announcing) {
+		k_spin_unlock(&q->lock, key);
+		return;
+	}
+	q->announcing = true;
+
+	for (;;) {
+		/* Re-read so ticks announced meanwhile are processed too */
+		target = announced_tick();
+		t = first_in(&q->list);
+		if ((t == NULL) || (t->dticks > (k_ticks_t)(target - q->tick))) {
+			break;
+		}
+
+		q->tick += t->dticks;
+		t->dticks = 0;
+		remove_timeout_from(&q->list, t);
+
+		k_spin_unlock(&q->lock, key);
+		t->fn(t);
+		key = k_spin_lock(&q->lock);
+	}
+
+	if (t != NULL) {
+		t->dticks -= (k_ticks_t)(target - q->tick);
+	}
+	q->tick = target;
+	q->announcing = false;
+
+	k_spin_unlock(&q->lock, key);
+}
+
+void z_timeout_cpu_announce(void)
+{
+	struct timeout_q *q = local_q();
+
+	/* Scheduling IPIs are also sent for other reasons, only process
+	 * the queue when sys_clock_announce() flagged it.
+	 */
+	if (!atomic_clear(&q->expired)) {
+		return;
+	}
+
+	timeout_q_announce(q);
+	update_timer();
+}
+
+void sys_clock_announce(int32_t ticks)
+{
+	struct timeout_q *local = local_q();
+	uint32_t ipi_mask = 0U;
+	uint64_t target = 0U;
+
+	K_SPINLOCK(&timeout_lock) {
+		curr_tick += ticks;
+		target = curr_tick;
+	}
+
+	timeout_q_announce(local);
+
+	/* Queues of other CPUs with expired timeouts are processed by
+	 * their own CPU from the scheduling IPI, the others are simply
+	 * brought up to date here.
+	 */
+	for (unsigned int i = 0; i < arch_num_cpus(); i++) {
+		struct timeout_q *q = &timeout_qs[i];
+
+		if (q == local) {
+			continue;
+		}
+
+		K_SPINLOCK(&q->lock) {
+			if (!timeout_q_catch_up(q, target)) {
+				atomic_set(&q->expired, 1);
+				ipi_mask |= BIT(i);
+			}
+		}
+	}
+
+	if (ipi_mask != 0U) {
+		flag_ipi(ipi_mask);
+		signal_pending_ipi();
+	}
+
+	update_timer();
+
+#ifdef CONFIG_SCHED_DEADLINE_CBS
+	z_sched_cbs_enforce();
+#endif /* CONFIG_SCHED_DEADLINE_CBS */
+
+#ifdef CONFIG_TIMESLICING
+	z_time_slice();
+#endif /* CONFIG_TIMESLICING */
+}
+#endif /* CONFIG_TIMEOUT_QUEUE_PER_CPU */
 
 int64_t sys_clock_tick_get(void)
 {
@@ -354,6 +798,11 @@ k_timeout_t sys_timepoint_timeout(k_timepoint_t timepoint)
 void z_impl_sys_clock_tick_set(uint64_t tick)
 {
 	curr_tick = tick;
+#ifdef CONFIG_TIMEOUT_QUEUE_PER_CPU
+	for (unsigned int i = 0; i < ARRAY_SIZE(timeout_qs); i++) {
+		timeout_qs[i].tick = tick;
+	}
+#endif /* CONFIG_TIMEOUT_QUEUE_PER_CPU */
 }
 
 void z_vrfy_sys_clock_tick_set(uint64_t tick)
@@ -196,6 +196,10 @@ static void queue_flusher_locked(struct k_work_q *queue,
 	} else {
 		sys_slist_prepend(&queue->pending, &flusher->work.node);
 	}
+
+#ifdef CONFIG_WORKQUEUE_WORKERS
+	flusher->target = work;
+#endif
 }
 
 /* Try to remove a work item from the given queue.
@@ -213,6 +217,92 @@ static inline void queue_remove_locked(struct k_work_q *queue,
 	}
 }
 
+/* Test whether a thread is one of the threads animating a queue.
+ *
+ * Invoked with work lock held.
+ */
+static inline bool queue_is_worker_locked(const struct k_work_q *queue,
+					  const struct k_thread *thread)
+{
+	if (thread == &queue->thread) {
+		return true;
+	}
+
+#ifdef CONFIG_WORKQUEUE_WORKERS
+	for (unsigned int i = 0; i < queue->num_workers; i++) {
+		if (thread == queue->workers[i]) {
+			return true;
+		}
+	}
+#endif
+
+	return false;
+}
+
+#ifdef CONFIG_WORKQUEUE_WORKERS
+/* Test whether a pending item must be left for later.
+ *
+ * An item can't be started while another worker is running the same work
+ * item, which happens when the item is resubmitted from its handler or
+ * after it started running.  A flusher must likewise wait until the work
+ * it flushes is done.
+ *
+ * Invoked with work lock held.
+ */
+static inline bool work_blocked_locked(const struct k_work *work)
+{
+	if (work->handler == handle_flush) {
+		const struct z_work_flusher *flusher
+			= CONTAINER_OF(work, struct z_work_flusher, work);
+
+		work = flusher->target;
+	}
+
+	return flag_test(&work->flags, K_WORK_RUNNING_BIT);
+}
+#endif
+
+/* Remove the next work item that can be started from a queue.
+ *
+ * Invoked with work lock held.
+ *
+ * @param queue the queue to take work from.
+ *
+ * @return the node of the work item, or NULL if none can be started.
+ */
+static inline sys_snode_t *queue_get_locked(struct k_work_q *queue)
+{
+#ifdef CONFIG_WORKQUEUE_WORKERS
+	sys_snode_t *node;
+	sys_snode_t *prev = NULL;
+
+	SYS_SLIST_FOR_EACH_NODE(&queue->pending, node) {
+		if (!work_blocked_locked(CONTAINER_OF(node, struct k_work, node))) {
+			sys_slist_remove(&queue->pending, prev, node);
+			return node;
+		}
+		prev = node;
+	}
+
+	return NULL;
+#else
+	return sys_slist_get(&queue->pending);
+#endif
+}
+
+/* Test whether a queue has neither pending nor running work.
+ *
+ * Invoked with work lock held.
+ */
+static inline bool queue_idle_locked(const struct k_work_q *queue)
+{
+#ifdef CONFIG_WORKQUEUE_WORKERS
+	return sys_slist_is_empty(&queue->pending) && (queue->running == 0U);
+#else
+	return true;
+#endif
+}
+
 /* Potentially notify a queue that it needs to look for pending work.
  *
  * This may make the work queue thread ready, but as the lock is held it
@@ -262,7 +352,7 @@ static inline int queue_submit_locked(struct k_work_q *queue,
 	}
 
 	int ret;
-	bool chained = (_current == &queue->thread) && !k_is_in_isr();
+	bool chained = queue_is_worker_locked(queue, _current) && !k_is_in_isr();
 	bool draining = flag_test(&queue->flags, K_WORK_QUEUE_DRAIN_BIT);
 	bool plugged = flag_test(&queue->flags, K_WORK_QUEUE_PLUGGED_BIT);
 
@@ -618,12 +708,15 @@ static void work_queue_main(void *workq_ptr, void *p2, void *p3)
 		bool yield;
 
 		/* Check for and prepare any new work. */
-		node = sys_slist_get(&queue->pending);
+		node = queue_get_locked(queue);
 		if (node != NULL) {
 			/* Mark that there's some work active that's
 			 * not on the pending list.
 			 */
 			flag_set(&queue->flags, K_WORK_QUEUE_BUSY_BIT);
+#ifdef CONFIG_WORKQUEUE_WORKERS
+			queue->running++;
+#endif
 			work = CONTAINER_OF(node, struct k_work, node);
 			flag_set(&work->flags, K_WORK_RUNNING_BIT);
 			flag_clear(&work->flags, K_WORK_QUEUED_BIT);
@@ -641,6 +734,11 @@ static void work_queue_main(void *workq_ptr, void *p2, void *p3)
 			 * This means that if node is not NULL, then work will not be NULL.
 			 */
 			handler = work->handler;
+		} else if (!queue_idle_locked(queue)) {
+			/* Other workers still own the remaining work, and
+			 * look at the queue state again when they finish.
+			 */
+			;
 		} else if (flag_test_and_clear(&queue->flags,
 					       K_WORK_QUEUE_DRAIN_BIT)) {
 			/* Not busy and draining: move threads waiting for
@@ -656,6 +754,16 @@ static void work_queue_main(void *workq_ptr, void *p2, void *p3)
 		} else if (flag_test(&queue->flags, K_WORK_QUEUE_STOP_BIT)) {
 			/* User has requested that the queue stop. Clear the status flags and exit.
 			 */
+#ifdef CONFIG_WORKQUEUE_WORKERS
+			/* The last worker to leave clears the flags, the
+			 * others only pass the stop request on.
+			 */
+			if (--queue->live != 0U) {
+				(void)z_sched_wake_all(&queue->notifyq, 0, NULL);
+				k_spin_unlock(&lock, key);
+				return;
+			}
+#endif
 			flags_set(&queue->flags, 0);
 			k_spin_unlock(&lock, key);
 			return;
@@ -698,7 +806,13 @@ static void work_queue_main(void *workq_ptr, void *p2, void *p3)
 			finalize_cancel_locked(work);
 		}
 
+#ifdef CONFIG_WORKQUEUE_WORKERS
+		if (--queue->running == 0U) {
+			flag_clear(&queue->flags, K_WORK_QUEUE_BUSY_BIT);
+		}
+#else
 		flag_clear(&queue->flags, K_WORK_QUEUE_BUSY_BIT);
+#endif
 		yield = !flag_test(&queue->flags, K_WORK_QUEUE_NO_YIELD_BIT);
 		k_spin_unlock(&lock, key);
 
@@ -738,6 +852,11 @@ void k_work_queue_start(struct k_work_q *queue,
 	sys_slist_init(&queue->pending);
 	z_waitq_init(&queue->notifyq);
 	z_waitq_init(&queue->drainq);
+#ifdef CONFIG_WORKQUEUE_WORKERS
+	queue->num_workers = 0U;
+	queue->live = 1U;
+	queue->running = 0U;
+#endif
 
 	if ((cfg != NULL) && cfg->no_yield) {
 		flags |= K_WORK_QUEUE_NO_YIELD;
@@ -766,6 +885,61 @@ void k_work_queue_start(struct k_work_q *queue,
 	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_work_queue, start, queue);
 }
 
+#ifdef CONFIG_WORKQUEUE_WORKERS
+int k_work_queue_add_worker(struct k_work_q *queue, struct k_thread *thread,
+			    k_thread_stack_t *stack, size_t stack_size,
+			    int prio, int cpu)
+{
+	__ASSERT_NO_MSG(queue);
+	__ASSERT_NO_MSG(thread);
+	__ASSERT_NO_MSG(stack);
+
+	if ((cpu < -1) || (cpu >= (int)arch_num_cpus())) {
+		return -EINVAL;
+	}
+
+	if ((cpu >= 0) && !IS_ENABLED(CONFIG_SCHED_CPU_MASK)) {
+		return -ENOTSUP;
+	}
+
+	int ret = 0;
+	k_spinlock_key_t key = k_spin_lock(&lock);
+
+	if (!flag_test(&queue->flags, K_WORK_QUEUE_STARTED_BIT) ||
+	    flag_test(&queue->flags, K_WORK_QUEUE_STOP_BIT)) {
+		ret = -ENODEV;
+	} else if (queue->num_workers >= ARRAY_SIZE(queue->workers)) {
+		ret = -ENOMEM;
+	} else {
+		queue->workers[queue->num_workers] = thread;
+		queue->num_workers++;
+		queue->live++;
+	}
+
+	k_spin_unlock(&lock, key);
+
+	if (ret != 0) {
+		return ret;
+	}
+
+	(void)k_thread_create(thread, stack, stack_size,
+			      work_queue_main, queue, NULL, NULL,
+			      prio, 0, K_FOREVER);
+
+	thread->base.user_options |= queue->thread.base.user_options & K_ESSENTIAL;
+
+#ifdef CONFIG_SCHED_CPU_MASK
+	if (cpu >= 0) {
+		(void)k_thread_cpu_pin(thread, cpu);
+	}
+#endif
+
+	k_thread_start(thread);
+
+	return 0;
+}
+#endif /* CONFIG_WORKQUEUE_WORKERS */
+
 int k_work_queue_drain(struct k_work_q *queue,
 		       bool plug)
 {
@@ -818,6 +992,28 @@ int k_work_queue_unplug(struct k_work_q *queue)
 	return ret;
 }
 
+/* Wait for all threads of a stopping queue to exit.
+ *
+ * @retval 0 if all threads exited
+ * @retval -EAGAIN if the timeout elapsed first
+ */
+static int work_queue_join(struct k_work_q *queue, k_timeout_t timeout)
+{
+#ifdef CONFIG_WORKQUEUE_WORKERS
+	k_timepoint_t end = sys_timepoint_calc(timeout);
+
+	for (unsigned int i = 0; i < queue->num_workers; i++) {
+		if (k_thread_join(queue->workers[i], sys_timepoint_timeout(end)) != 0) {
+			return -EAGAIN;
+		}
+	}
+
+	timeout = sys_timepoint_timeout(end);
+#endif
+
+	return k_thread_join(&queue->thread, timeout);
+}
+
 int k_work_queue_stop(struct k_work_q *queue, k_timeout_t timeout)
 {
 	__ASSERT_NO_MSG(queue);
@@ -838,10 +1034,14 @@ int k_work_queue_stop(struct k_work_q *queue, k_timeout_t timeout)
 	}
 
 	flag_set(&queue->flags, K_WORK_QUEUE_STOP_BIT);
+#ifdef CONFIG_WORKQUEUE_WORKERS
+	(void)z_sched_wake_all(&queue->notifyq, 0, NULL);
+#else
 	notify_queue_locked(queue);
+#endif
 	k_spin_unlock(&lock, key);
 	SYS_PORT_TRACING_OBJ_FUNC_BLOCKING(k_work_queue, stop, queue, timeout);
-	if (k_thread_join(&queue->thread, timeout)) {
+	if (work_queue_join(queue, timeout)) {
 		key = k_spin_lock(&lock);
 		flag_clear(&queue->flags, K_WORK_QUEUE_STOP_BIT);
 		k_spin_unlock(&lock, key);
@@ -649,6 +649,9 @@ process_string:
 					 */
 					str_ptr_pos[s_idx] = s_ptr_idx;
 					str_ptr_arg[s_idx] = arg_idx;
+					if (flags & CBPRINTF_PACKAGE_PCHAR_ARGS_ARE_STR) {
+						str_ptr_arg[s_idx] |= Z_CBPRINTF_RW_STR_ARG_IS_STR;
+					}
 					if (is_ro) {
 						/* flag read-only string. */
 						str_ptr_pos[s_idx] |= STR_POS_RO_FLAG;
@@ -1003,7 +1006,8 @@ int cbprintf_package_convert(void *in_packaged,
 			int len;
 
 			if (IS_ENABLED(CONFIG_CBPRINTF_CONVERT_CHECK_PTR) &&
-			    fmt_present && is_ptr(fmt, arg_idx)) {
+			    fmt_present && !(arg_idx & Z_CBPRINTF_RW_STR_ARG_IS_STR) &&
+			    is_ptr(fmt, arg_idx)) {
 				LOG_WRN("(unsigned) char * used for %%p argument. "
 					"It's recommended to cast it to void * because "
 					"it may cause misbehavior in certain "
@@ -1082,7 +1086,8 @@ calculate_string_length:
 		bool is_ro = ptr_in_rodata(str);
 
 		if (IS_ENABLED(CONFIG_CBPRINTF_CONVERT_CHECK_PTR) &&
-		    fmt_present && is_ptr(fmt, arg_idx)) {
+		    fmt_present && !(arg_idx & Z_CBPRINTF_RW_STR_ARG_IS_STR) &&
+		    is_ptr(fmt, arg_idx)) {
 			continue;
 		}
 
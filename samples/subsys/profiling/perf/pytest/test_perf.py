@@ -30,9 +30,12 @@ def test_shell_perf(dut: DeviceAdapter, shell: Shell):
     length = int(match.group(1))
     lines = lines[1:]
     assert length != 0, '0 length'
-    assert length == len(lines), 'length dose not match with count of lines'
+    assert length <= len(lines), 'length dose not match with count of lines'
+    assert all(line.startswith('Perf thread') for line in lines[length:]), 'unexpected output'
 
     i = 0
     while i < length:
-        i += int(lines[i], 16) + 1
+        hdr = int(lines[i], 16)
+        # header word, the sampled thread if flagged, then the trace
+        i += (hdr & 0xFFFF) + (2 if hdr & (1 << 24) else 1)
         assert i <= length, 'one of the samples is not true to size'
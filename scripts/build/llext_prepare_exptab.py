@@ -16,11 +16,13 @@ exports table to allow usage of binary search algorithms at runtime.
 If CONFIG_LLEXT_EXPORT_BUILTINS_BY_SLID option is enabled, SLIDs
 of all exported functions are also injected in the export table by
 this script. (In this case, the preparation process is destructive)
+Otherwise, the table is sorted by symbol name.
 """
 
 import llext_slidlib
 
 from elftools.elf.elffile import ELFFile
+from elftools.elf.constants import SH_FLAGS
 from elftools.elf.sections import Section
 
 import argparse
@@ -217,26 +219,57 @@ class ZephyrElfExptabPreparator():
         return 0
 
     def _prepare_exptab_for_str_linking(self):
-        #TODO: sort the export table by symbol
-        #      name to allow binary search too
-        #
-        # Plan of action:
-        #   1) Locate in which section the names are located
-        #   2) Load the export table and resolve names
-        #   3) Sort the exports by name
-        #       WARN: THIS MUST USE THE SAME SORTING RULES
-        #       AS LLEXT CODE OR DICHOTOMIC SEARCH WILL BREAK
-        #       Using a custom sorting function might be required.
-        #   4) Write back the updated export table
-        #
-        # N.B.: reusing part of the code in _prepare_elf_for_slid_linking
-        # might be possible and desireable.
-        #
-        # As of writing, this function will never be called as this script
-        # is only called if CONFIG_LLEXT_EXPORT_BUILTINS_BY_SLID is enabled,
-        # which makes _prepare_exptab_for_slid_linking be called instead.
-        #
-        self.log.warn(f"_prepare_exptab_for_str_linking: do nothing")
+        """
+        IMPLEMENTATION NOTES:
+          The names of the exports are regular strings placed by the
+          compiler in some allocated section of the ELF: each name
+          pointer is translated to a file offset using the section
+          that contains it.
+
+          The export table is sorted by name in ASCENDING order of
+          the raw bytes, which matches the order of strcmp() used
+          by the binary search in 'subsys/llext/llext.c'.
+        """
+        def read_symbol_name(name_ptr):
+            for section in self.elf.iter_sections():
+                if section['sh_type'] == 'SHT_NOBITS' or \
+                   (section['sh_flags'] & SH_FLAGS.SHF_ALLOC) == 0:
+                    continue
+
+                start = section['sh_addr']
+                if start <= name_ptr < start + section['sh_size']:
+                    break
+            else:
+                return None
+
+            raw_name = b''
+            self.elf_fd.seek(section['sh_offset'] + name_ptr - start)
+
+            c = self.elf_fd.read(1)
+            while c not in (b'\0', b''):
+                raw_name += c
+                c = self.elf_fd.read(1)
+
+            return raw_name
+
+        #1) Load the export table
+        exports_list = []
+        for (name_ptr, export_address) in self.exptab_manipulator:
+            export_name = read_symbol_name(name_ptr)
+            if export_name is None:
+                self.log.error(f"name of export at 0x{export_address:X} "
+                               f"(0x{name_ptr:X}) not found in ELF")
+                return 1
+            exports_list.append((export_name, name_ptr, export_address))
+
+        #2) Sort the export table (order specified above)
+        exports_list.sort(key=lambda export: export[0])
+
+        #3) Write the updated export table to ELF
+        for i, (export_name, name_ptr, export_address) in enumerate(exports_list):
+            self.log.debug(f"{export_name.decode('utf-8')} -> 0x{export_address:X}")
+            self.exptab_manipulator[i] = (name_ptr, export_address)
+
         return 0
 
     def _set_prep_done_shdr_flag(self):
@@ -314,6 +347,8 @@ class ZephyrElfExptabPreparator():
         if res == 0: # Add the "prepared" flag to export table section
             self._set_prep_done_shdr_flag()
 
+        return res
+
     def prepare_elf(self):
         res = self._prepare_inner()
         self.elf_fd.close()
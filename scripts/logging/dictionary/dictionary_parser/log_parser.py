@@ -64,3 +64,11 @@ class LogParser(abc.ABC):
     def parse_log_data(self, logdata, debug=False):
         """Parse log data"""
         return None
+
+
+    def get_msg_len(self, logdata, offset):
+        """
+        Get the length of the message starting at offset, or None if
+        logdata does not hold the complete message yet
+        """
+        raise NotImplementedError("Streaming is not supported by this parser")
@@ -354,6 +354,38 @@ class LogParserV3(LogParser):
         return next_msg_offset
 
 
+    def get_msg_len(self, logdata, offset):
+        """
+        Get the length of the message starting at offset, or None if
+        logdata does not hold the complete message yet
+        """
+        start = offset
+
+        if offset + struct.calcsize(self.fmt_msg_type) > len(logdata):
+            return None
+
+        msg_type = struct.unpack_from(self.fmt_msg_type, logdata, offset)[0]
+        offset += struct.calcsize(self.fmt_msg_type)
+
+        if msg_type == MSG_TYPE_DROPPED:
+            offset += struct.calcsize(self.fmt_dropped_cnt)
+        elif msg_type == MSG_TYPE_NORMAL:
+            if offset + struct.calcsize(self.fmt_msg_hdr) > len(logdata):
+                return None
+
+            _, pkg_len, data_len, _ = struct.unpack_from(self.fmt_msg_hdr, logdata, offset)
+            offset += struct.calcsize(self.fmt_msg_hdr)
+            offset += struct.calcsize(self.fmt_msg_timestamp)
+            offset += pkg_len + data_len
+        else:
+            raise ValueError(f"Unknown message type: {msg_type}")
+
+        if offset > len(logdata):
+            return None
+
+        return offset - start
+
+
     def parse_log_data(self, logdata, debug=False):
         """Parse binary log data and print the encoded log messages"""
         offset = 0
@@ -0,0 +1,239 @@
+#!/usr/bin/env python3
+#
+# Copyright (c) 2025 The Zephyr Project Contributors
+#
+# SPDX-License-Identifier: Apache-2.0
+
+"""
+Log Parser for Dictionary-based Logging to file system
+
+This uses the JSON database file to decode the log files written by
+the file system backend with CONFIG_LOG_BACKEND_FS_BLOCKS and print
+the log messages. Either a single log file or the log directory can be
+given, in which case the files are decoded from the oldest to the newest.
+
+With --follow, files are tailed: records are printed as soon as the
+device writes them, and decoding moves on to the next file on rotation.
+"""
+
+import argparse
+import logging
+import os
+import re
+import struct
+import sys
+import time
+
+import dictionary_parser
+from dictionary_parser.log_database import LogDatabase
+
+LOGGER_FORMAT = "%(message)s"
+logger = logging.getLogger("parser")
+
+# Need to keep sync with struct log_fs_block_hdr in
+# subsys/logging/backends/log_backend_fs.c.
+#
+# struct log_fs_block_hdr {
+#     uint32_t magic;
+#     uint32_t seq;
+#     uint16_t used;
+#     uint16_t first;
+# } __packed;
+FMT_BLOCK_HDR = "IIHH"
+BLOCK_MAGIC = 0x4B424C5A
+BLOCK_NO_RECORD = 0xFFFF
+
+# Must match the numbering of the file system backend
+MAX_FILE_NUMERAL = 9999
+
+
+def parse_args():
+    """Parse command line arguments"""
+    argparser = argparse.ArgumentParser(allow_abbrev=False)
+
+    argparser.add_argument("dbfile", help="Dictionary Logging Database file")
+    argparser.add_argument("logpath", help="Log file or log directory")
+    argparser.add_argument("--prefix", default="log.",
+                           help="Log file name prefix (CONFIG_LOG_BACKEND_FS_FILE_PREFIX)")
+    argparser.add_argument("--block-size", type=int, default=512,
+                           help="Log block size (CONFIG_LOG_BACKEND_FS_BLOCK_SIZE)")
+    argparser.add_argument("--follow", action="store_true",
+                           help="Keep decoding records as they are written")
+    argparser.add_argument("--interval", type=float, default=1.0,
+                           help="Polling interval in seconds when following")
+    argparser.add_argument("--debug", action="store_true",
+                           help="Print extra debugging information")
+
+    return argparser.parse_args()
+
+
+def list_log_files(logpath, prefix):
+    """List log files from the oldest to the newest"""
+    if not os.path.isdir(logpath):
+        return [logpath]
+
+    pattern = re.compile(re.escape(prefix) + r"(\d{4})$")
+    nums = sorted(int(m.group(1)) for m in map(pattern.match, os.listdir(logpath)) if m)
+
+    # File numbers wrap around, the oldest file follows the largest gap
+    if len(nums) > 1:
+        gaps = [(nums[(i + 1) % len(nums)] - n) % (MAX_FILE_NUMERAL + 1)
+                for i, n in enumerate(nums)]
+        start = (gaps.index(max(gaps)) + 1) % len(nums)
+        nums = nums[start:] + nums[:start]
+
+    return [os.path.join(logpath, f"{prefix}{n:04d}") for n in nums]
+
+
+class BlockStream:
+    """Reassemble the record stream out of log blocks"""
+
+    def __init__(self, log_parser, block_size, little_endian):
+        self.log_parser = log_parser
+        self.block_size = block_size
+        self.fmt_hdr = ("<" if little_endian else ">") + FMT_BLOCK_HDR
+        self.payload_size = block_size - struct.calcsize(self.fmt_hdr)
+
+        self.path = None
+        self.block_idx = 0
+        self.consumed = 0
+        self.last_seq = None
+        self.synced = False
+        self.stream = bytearray()
+
+    def open(self, path):
+        """Continue decoding with the start of the given file"""
+        logger.debug("# Reading %s", path)
+        self.path = path
+        self.block_idx = 0
+        self.consumed = 0
+
+    def read(self):
+        """Append the payload written to the current file since the last call"""
+        try:
+            logfile = open(self.path, "rb")
+        except FileNotFoundError:
+            # Deleted by the device to make room for newer logs
+            return
+
+        with logfile:
+            logfile.seek(self.block_idx * self.block_size)
+
+            while True:
+                data = logfile.read(self.block_size)
+                if len(data) < self.block_size:
+                    return
+
+                magic, seq, used, first = struct.unpack_from(self.fmt_hdr, data)
+                if magic != BLOCK_MAGIC or used > self.payload_size:
+                    logger.debug("# No valid block at %s:%d", self.path, self.block_idx)
+                    return
+
+                payload = data[struct.calcsize(self.fmt_hdr):]
+
+                if self.consumed > 0 and seq != self.last_seq:
+                    # Partially read block was replaced, e.g. after a restart
+                    self.consumed = 0
+                    self.synced = False
+
+                if self.consumed == 0:
+                    if self.last_seq is not None and seq != (self.last_seq + 1) & 0xFFFFFFFF:
+                        logger.info("--- log blocks missing or device restarted ---")
+                        self.synced = False
+                    self.last_seq = seq
+
+                if self.synced:
+                    self.stream += payload[self.consumed:used]
+                elif first != BLOCK_NO_RECORD:
+                    # Records continued from a missing block can't be decoded
+                    self.stream = bytearray(payload[first:used])
+                    self.synced = True
+
+                if used < self.payload_size:
+                    # Block is still being filled
+                    self.consumed = used
+                    return
+
+                self.block_idx += 1
+                self.consumed = 0
+
+    def decode(self):
+        """Print the complete records of the stream"""
+        offset = 0
+
+        while True:
+            try:
+                msg_len = self.log_parser.get_msg_len(self.stream, offset)
+            except ValueError as e:
+                logger.error("ERROR: %s, skipping to next record start", e)
+                self.stream = bytearray()
+                self.synced = False
+                return
+
+            if msg_len is None:
+                break
+            offset += msg_len
+
+        if offset == 0:
+            return
+
+        if not self.log_parser.parse_log_data(bytes(self.stream[:offset])):
+            logger.error("ERROR: there were error(s) parsing log data")
+
+        del self.stream[:offset]
+
+
+def main():
+    """Main function of log parser"""
+    args = parse_args()
+
+    # Setup logging for parser
+    logging.basicConfig(format=LOGGER_FORMAT)
+    if args.debug:
+        logger.setLevel(logging.DEBUG)
+    else:
+        logger.setLevel(logging.INFO)
+
+    database = LogDatabase.read_json_database(args.dbfile)
+    if database is None:
+        logger.error("ERROR: Cannot open database file: %s, exiting...", args.dbfile)
+        sys.exit(1)
+
+    log_parser = dictionary_parser.get_parser(database)
+    if log_parser is None:
+        logger.error("ERROR: Cannot find a suitable parser matching database version!")
+        sys.exit(1)
+
+    stream = BlockStream(log_parser, args.block_size, database.is_tgt_little_endian())
+    done = []
+
+    try:
+        while True:
+            files = [f for f in list_log_files(args.logpath, args.prefix) if f not in done]
+
+            if stream.path is None and files:
+                stream.open(files[0])
+
+            while stream.path is not None:
+                stream.read()
+                stream.decode()
+
+                # Move on once the device started writing a newer file
+                newer = [f for f in files if f != stream.path]
+                if not newer:
+                    break
+
+                done.append(stream.path)
+                files = newer
+                stream.open(files[0])
+
+            if not args.follow:
+                break
+
+            time.sleep(args.interval)
+    except KeyboardInterrupt:
+        pass
+
+
+if __name__ == "__main__":
+    main()
@@ -12,54 +12,177 @@ This translate stack samples captured by perf subsystem into format
 used by flamegraph.pl. Translation uses .elf file to get function names
 from addresses
 
+Samples recorded with the sampled thread are attributed to it: the thread
+name, taken from the "Perf thread" lines of the perf output or from the ELF
+symbol of a statically defined thread, becomes the root frame of each stack.
+
 Usage:
-    ./script/perf/stackcollapse.py <file with perf printbuf output> <ELF file>
+    ./scripts/profiling/stackcollapse.py <file with perf printbuf output> <ELF file>
 """
 
+import argparse
+import bisect
+import binascii
 import re
-import sys
 import struct
-import binascii
-from functools import lru_cache
+import sys
+from collections import Counter
+
 from elftools.elf.elffile import ELFFile
 
+HDR_DEPTH_MASK = 0xFFFF
+HDR_CPU_SHIFT = 16
+HDR_CPU_MASK = 0xFF
+HDR_THREAD = 1 << 24
+
+# Leaf frames belonging to the sampling path rather than to the sampled code.
+# They are only present with backends that unwind from the sampling handler.
+DEFAULT_STRIP = (
+    r"arch_perf_current_stack_trace|perf_sample|perf_tracer|perf_ipi_sample|"
+    r"z_timer_expiration_handler|sys_clock_announce|.*irq_handler.*|"
+    r"posix_.*|np_.*|nsi_.*|nct_.*|z_sched_ipi|ipi_work_process"
+)
+
+
+class Symbolizer:
+    def __init__(self, elf):
+        funcs = []
+        objects = []
+        symtab = elf.get_section_by_name(".symtab")
+        for sym in symtab.iter_symbols():
+            size = sym.entry.st_size
+            if size == 0:
+                continue
+            start = sym.entry.st_value
+            if sym.entry.st_info.type == "STT_FUNC":
+                # Clear the Thumb bit of ARM function symbols
+                if elf.get_machine_arch() == "ARM":
+                    start &= ~1
+                funcs.append((start, start + size, sym.name))
+            elif sym.entry.st_info.type == "STT_OBJECT":
+                objects.append((start, start + size, sym.name))
+
+        funcs.sort()
+        objects.sort()
+        self.funcs = funcs
+        self.func_starts = [f[0] for f in funcs]
+        self.objects = objects
+        self.object_starts = [o[0] for o in objects]
+        self.cache = {}
+
+    @staticmethod
+    def _lookup(starts, table, addr):
+        i = bisect.bisect_right(starts, addr) - 1
+        if i >= 0 and table[i][0] <= addr < table[i][1]:
+            return table[i][2]
+        return None
+
+    def func(self, addr):
+        if addr not in self.cache:
+            name = self._lookup(self.func_starts, self.funcs, addr)
+            if name is None:
+                name = "nullptr" if addr == 0 else "[unknown]"
+            self.cache[addr] = name
+        return self.cache[addr]
+
+    def thread(self, addr, names):
+        if addr in names:
+            return names[addr]
+        name = self._lookup(self.object_starts, self.objects, addr)
+        return name if name is not None else f"thread_{addr:x}"
+
 
-@lru_cache(maxsize=None)
-def addr_to_sym(addr, elf):
-    symtab = elf.get_section_by_name(".symtab")
-    for sym in symtab.iter_symbols():
-        if sym.entry.st_info.type == "STT_FUNC" and sym.entry.st_value <= addr < sym.entry.st_value + sym.entry.st_size:
-            return sym.name
-    if addr == 0:
-        return "nullptr"
-    return "[unknown]"
+def parse_output(text):
+    lines = [line.strip() for line in text.splitlines()]
+    lines = [line for line in lines if line]
 
+    length = int(re.match(r"Perf buf length (\d+)", lines[0]).group(1))
+    words = lines[1 : 1 + length]
+    assert len(words) == length, "truncated perf output"
 
-def collapse(buf, elf):
+    names = {}
+    for line in lines[1 + length :]:
+        m = re.match(r"Perf thread ([0-9a-fA-F]+) (.*)", line)
+        if m:
+            names[int(m.group(1), 16)] = m.group(2)
+
+    return binascii.unhexlify("".join(words)), names
+
+
+def samples(buf):
+    """Yield (cpu, thread, addresses) for each sample, innermost first"""
     while buf:
-        count, = struct.unpack_from(">Q", buf)
+        (hdr,) = struct.unpack_from(">Q", buf)
+        count = hdr & HDR_DEPTH_MASK
         assert count > 0
-        addrs = struct.unpack_from(f">{count}Q", buf, 8)
+        cpu = (hdr >> HDR_CPU_SHIFT) & HDR_CPU_MASK
+        thread = None
+        offset = 8
+        if hdr & HDR_THREAD:
+            (thread,) = struct.unpack_from(">Q", buf, offset)
+            offset += 8
+        addrs = struct.unpack_from(f">{count}Q", buf, offset)
+        yield cpu, thread, addrs
+        buf = buf[offset + 8 * count :]
+
 
-        func_trace = reversed(list(map(lambda a: addr_to_sym(a, elf), addrs)))
-        prev_func = next(func_trace)
-        line = prev_func
+def collapse(buf, names, sym, args):
+    strip = re.compile(args.strip) if args.strip else None
+    folded = Counter()
+
+    for cpu, thread, addrs in samples(buf):
+        # Return addresses point past the call, look up the call itself
+        funcs = [sym.func(a if i == 0 else a - 1) for i, a in enumerate(addrs)]
+        while strip is not None and len(funcs) > 1 and strip.fullmatch(funcs[0]):
+            funcs.pop(0)
+
+        frames = []
         # merge dublicate functions
-        for func in func_trace:
-            if prev_func != func:
-                prev_func = func
-                line += ";" + func
+        for func in reversed(funcs):
+            if not frames or frames[-1] != func:
+                frames.append(func)
+
+        if thread is not None and not args.no_threads:
+            frames.insert(0, sym.thread(thread, names))
+        if args.per_cpu:
+            frames.insert(0, f"cpu{cpu}")
+
+        folded[";".join(frames)] += 1
+
+    return folded
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description=__doc__,
+        formatter_class=argparse.RawDescriptionHelpFormatter,
+        allow_abbrev=False,
+    )
+    parser.add_argument("perf_output", help="file with perf printbuf output")
+    parser.add_argument("elf", help="zephyr.elf the samples were taken from")
+    parser.add_argument(
+        "--no-threads", action="store_true", help="don't prefix stacks with the sampled thread"
+    )
+    parser.add_argument("--per-cpu", action="store_true", help="prefix stacks with the CPU")
+    parser.add_argument(
+        "--strip",
+        default=DEFAULT_STRIP,
+        help="regex of leaf functions to drop (default: sampling path functions)",
+    )
+    parser.add_argument(
+        "-o", "--output", type=argparse.FileType("w"), default=sys.stdout, help="output file"
+    )
+    args = parser.parse_args()
+
+    with open(args.elf, "rb") as f:
+        sym = Symbolizer(ELFFile(f))
+
+    with open(args.perf_output) as f:
+        buf, names = parse_output(f.read())
 
-        print(line, 1)
-        buf = buf[8 + 8 * count:]
+    for stack, count in sorted(collapse(buf, names, sym, args).items()):
+        print(stack, count, file=args.output)
 
 
 if __name__ == "__main__":
-    elf = ELFFile(open(sys.argv[2], "rb"))
-    with open(sys.argv[1], "r") as f:
-        inp = f.read()
-
-    lines = inp.splitlines()
-    assert int(re.match(r"Perf buf length (\d+)", lines[0]).group(1)) == len(lines) - 1
-    buf = binascii.unhexlify("".join(lines[1:]))
-    collapse(buf, elf)
+    main()
@@ -0,0 +1,425 @@
+/*
+ * Copyright (c) 2025 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * Block cache of disk sectors shared by all cached disks.
+ *
+ * Cached sectors are found with a hash table and kept in a list ordered by
+ * use, the least recently used one is at the tail and gets evicted first.
+ * Disk requests issued by the cache go through staging buffers of
+ * CONFIG_DISK_CACHE_RUN_SECTORS sectors, so misses are read together with
+ * the read-ahead and consecutive modified sectors are written back together.
+ */
+
+#include <errno.h>
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <zephyr/init.h>
+#include <zephyr/sys/dlist.h>
+#include <zephyr/sys/slist.h>
+#include <zephyr/sys/util.h>
+#include <zephyr/storage/disk_access.h>
+
+#include "disk_cache.h"
+
+#define LOG_LEVEL CONFIG_DISK_LOG_LEVEL
+#include <zephyr/logging/log.h>
+LOG_MODULE_DECLARE(disk);
+
+#define BLOCK_SIZE CONFIG_DISK_CACHE_SECTOR_SIZE
+#define RUN_SECTORS CONFIG_DISK_CACHE_RUN_SECTORS
+#define BUF_ALIGN 32
+
+BUILD_ASSERT(RUN_SECTORS <= CONFIG_DISK_CACHE_BLOCKS,
+	     "Read-ahead must not evict sectors of the same request");
+
+struct disk_cache_block {
+	/* Node in the use ordered list, most recently used first */
+	sys_dnode_t lru_node;
+	/* Node in the hash table bucket */
+	sys_snode_t hash_node;
+	/* Disk of the cached sector, NULL if block is free */
+	struct disk_info *disk;
+	uint32_t sector;
+	bool dirty;
+};
+
+static struct disk_cache_block blocks[CONFIG_DISK_CACHE_BLOCKS];
+static uint8_t block_data[CONFIG_DISK_CACHE_BLOCKS][BLOCK_SIZE] __aligned(BUF_ALIGN);
+static uint8_t run_buf[RUN_SECTORS * BLOCK_SIZE] __aligned(BUF_ALIGN);
+/* Separate buffer as blocks are written back while a read is staged in run_buf. */
+static uint8_t write_back_buf[RUN_SECTORS * BLOCK_SIZE] __aligned(BUF_ALIGN);
+static sys_slist_t hash_table[CONFIG_DISK_CACHE_BLOCKS];
+static sys_dlist_t lru_list = SYS_DLIST_STATIC_INIT(&lru_list);
+static K_MUTEX_DEFINE(cache_lock);
+
+#ifdef CONFIG_DISK_CACHE_STATS
+static struct disk_cache_stats cache_stats;
+#define STATS_ADD(field, n) (cache_stats.field += (n))
+#else
+#define STATS_ADD(field, n)
+#endif
+
+static inline uint8_t *block_data_get(struct disk_cache_block *blk)
+{
+	return block_data[blk - blocks];
+}
+
+static inline sys_slist_t *hash_bucket(struct disk_info *disk, uint32_t sector)
+{
+	uint32_t hash = sector ^ (uint32_t)((uintptr_t)disk >> 4);
+
+	return &hash_table[hash % ARRAY_SIZE(hash_table)];
+}
+
+static struct disk_cache_block *block_find(struct disk_info *disk, uint32_t sector)
+{
+	struct disk_cache_block *blk;
+
+	SYS_SLIST_FOR_EACH_CONTAINER(hash_bucket(disk, sector), blk, hash_node) {
+		if ((blk->disk == disk) && (blk->sector == sector)) {
+			return blk;
+		}
+	}
+
+	return NULL;
+}
+
+static void block_touch(struct disk_cache_block *blk)
+{
+	sys_dlist_remove(&blk->lru_node);
+	sys_dlist_prepend(&lru_list, &blk->lru_node);
+}
+
+static void block_free(struct disk_cache_block *blk)
+{
+	sys_slist_find_and_remove(hash_bucket(blk->disk, blk->sector), &blk->hash_node);
+	blk->disk = NULL;
+	blk->dirty = false;
+
+	/* Free blocks are reused first. */
+	sys_dlist_remove(&blk->lru_node);
+	sys_dlist_append(&lru_list, &blk->lru_node);
+}
+
+/* Write back the run of consecutive modified sectors containing the block. */
+static int block_write_back(struct disk_cache_block *blk)
+{
+	struct disk_info *disk = blk->disk;
+	struct disk_cache_block *run[RUN_SECTORS];
+	uint32_t start = blk->sector;
+	uint32_t count;
+	int rc;
+
+	while ((start > 0) && ((blk->sector - start + 1) < RUN_SECTORS)) {
+		struct disk_cache_block *prev = block_find(disk, start - 1);
+
+		if ((prev == NULL) || !prev->dirty) {
+			break;
+		}
+		start--;
+	}
+
+	for (count = 0; count < RUN_SECTORS; count++) {
+		run[count] = block_find(disk, start + count);
+		if ((run[count] == NULL) || !run[count]->dirty) {
+			break;
+		}
+		memcpy(&write_back_buf[count * BLOCK_SIZE], block_data_get(run[count]),
+		       BLOCK_SIZE);
+	}
+
+	rc = disk->ops->write(disk, write_back_buf, start, count);
+	if (rc != 0) {
+		LOG_ERR("Write back of %u sectors at %u failed (%d)", count, start, rc);
+		return rc;
+	}
+
+	for (uint32_t i = 0; i < count; i++) {
+		run[i]->dirty = false;
+	}
+
+	STATS_ADD(write_backs, 1);
+	STATS_ADD(write_back_sectors, count);
+
+	return 0;
+}
+
+/* Get a block for a sector which is not cached, evicting the least recently used one. */
+static struct disk_cache_block *block_alloc(struct disk_info *disk, uint32_t sector, int *rc)
+{
+	struct disk_cache_block *blk =
+		CONTAINER_OF(sys_dlist_peek_tail(&lru_list), struct disk_cache_block, lru_node);
+
+	if (blk->disk != NULL) {
+		if (blk->dirty) {
+			*rc = block_write_back(blk);
+			if (*rc != 0) {
+				return NULL;
+			}
+		}
+
+		sys_slist_find_and_remove(hash_bucket(blk->disk, blk->sector), &blk->hash_node);
+		STATS_ADD(evictions, 1);
+	}
+
+	blk->disk = disk;
+	blk->sector = sector;
+	blk->dirty = false;
+	sys_slist_prepend(hash_bucket(disk, sector), &blk->hash_node);
+	block_touch(blk);
+
+	return blk;
+}
+
+/* Read a run of sectors which are not cached. */
+static int read_miss(struct disk_info *disk, uint8_t *data_buf, uint32_t sector,
+		     uint32_t count, bool sequential)
+{
+	uint32_t fill = count;
+	int rc;
+
+	STATS_ADD(read_misses, count);
+
+	if (count > RUN_SECTORS) {
+		return disk->ops->read(disk, data_buf, sector, count);
+	}
+
+	if (IS_ENABLED(CONFIG_DISK_CACHE_READ_AHEAD) && sequential) {
+		fill = MAX(count, MIN(RUN_SECTORS, disk->cache_sector_count - sector));
+	}
+
+	rc = disk->ops->read(disk, run_buf, sector, fill);
+	if (rc != 0) {
+		return rc;
+	}
+
+	memcpy(data_buf, run_buf, count * BLOCK_SIZE);
+
+	for (uint32_t i = 0; i < fill; i++) {
+		struct disk_cache_block *blk;
+
+		/* Cached copy of a sector read ahead may be newer than the disk. */
+		if ((i >= count) && (block_find(disk, sector + i) != NULL)) {
+			continue;
+		}
+
+		blk = block_alloc(disk, sector + i, &rc);
+		if (blk == NULL) {
+			/* Requested data was read, write back error is reported on sync. */
+			break;
+		}
+
+		memcpy(block_data_get(blk), &run_buf[i * BLOCK_SIZE], BLOCK_SIZE);
+		if (i >= count) {
+			STATS_ADD(read_ahead, 1);
+		}
+	}
+
+	return 0;
+}
+
+int disk_cache_read(struct disk_info *disk, uint8_t *data_buf,
+		    uint32_t start_sector, uint32_t num_sector)
+{
+	uint32_t end_sector = start_sector + num_sector;
+	uint32_t sector = start_sector;
+	bool sequential;
+	int rc = 0;
+
+	if (disk->cache_sector_count == 0U) {
+		return disk->ops->read(disk, data_buf, start_sector, num_sector);
+	}
+
+	if ((start_sector >= disk->cache_sector_count) ||
+	    (num_sector > disk->cache_sector_count - start_sector)) {
+		return -EINVAL;
+	}
+
+	k_mutex_lock(&cache_lock, K_FOREVER);
+
+	sequential = (start_sector == disk->cache_next_sector);
+	disk->cache_next_sector = end_sector;
+
+	while ((sector < end_sector) && (rc == 0)) {
+		struct disk_cache_block *blk = block_find(disk, sector);
+		uint32_t miss_end;
+
+		if (blk != NULL) {
+			memcpy(&data_buf[(sector - start_sector) * BLOCK_SIZE],
+			       block_data_get(blk), BLOCK_SIZE);
+			block_touch(blk);
+			STATS_ADD(read_hits, 1);
+			sector++;
+			continue;
+		}
+
+		miss_end = sector + 1;
+		while ((miss_end < end_sector) && (block_find(disk, miss_end) == NULL)) {
+			miss_end++;
+		}
+
+		rc = read_miss(disk, &data_buf[(sector - start_sector) * BLOCK_SIZE],
+			       sector, miss_end - sector, sequential);
+		sector = miss_end;
+	}
+
+	k_mutex_unlock(&cache_lock);
+
+	return rc;
+}
+
+int disk_cache_write(struct disk_info *disk, const uint8_t *data_buf,
+		     uint32_t start_sector, uint32_t num_sector)
+{
+	int rc = 0;
+
+	if (disk->cache_sector_count == 0U) {
+		return disk->ops->write(disk, data_buf, start_sector, num_sector);
+	}
+
+	if ((start_sector >= disk->cache_sector_count) ||
+	    (num_sector > disk->cache_sector_count - start_sector)) {
+		return -EINVAL;
+	}
+
+	k_mutex_lock(&cache_lock, K_FOREVER);
+
+	if (!IS_ENABLED(CONFIG_DISK_CACHE_WRITE_BACK) || (num_sector > RUN_SECTORS)) {
+		rc = disk->ops->write(disk, data_buf, start_sector, num_sector);
+
+		/* Cached copies are up to date with the disk now. */
+		for (uint32_t i = 0; (rc == 0) && (i < num_sector); i++) {
+			struct disk_cache_block *blk = block_find(disk, start_sector + i);
+
+			if (blk != NULL) {
+				memcpy(block_data_get(blk), &data_buf[i * BLOCK_SIZE], BLOCK_SIZE);
+				blk->dirty = false;
+				STATS_ADD(write_hits, 1);
+			} else {
+				STATS_ADD(write_misses, 1);
+			}
+		}
+	} else {
+		for (uint32_t i = 0; i < num_sector; i++) {
+			struct disk_cache_block *blk = block_find(disk, start_sector + i);
+
+			if (blk != NULL) {
+				block_touch(blk);
+				STATS_ADD(write_hits, 1);
+			} else {
+				blk = block_alloc(disk, start_sector + i, &rc);
+				if (blk == NULL) {
+					break;
+				}
+				STATS_ADD(write_misses, 1);
+			}
+
+			memcpy(block_data_get(blk), &data_buf[i * BLOCK_SIZE], BLOCK_SIZE);
+			blk->dirty = true;
+		}
+	}
+
+	k_mutex_unlock(&cache_lock);
+
+	return rc;
+}
+
+int disk_cache_flush(struct disk_info *disk)
+{
+	int rc = 0;
+
+	if (!IS_ENABLED(CONFIG_DISK_CACHE_WRITE_BACK) || (disk->cache_sector_count == 0U)) {
+		return 0;
+	}
+
+	k_mutex_lock(&cache_lock, K_FOREVER);
+
+	for (size_t i = 0; (i < ARRAY_SIZE(blocks)) && (rc == 0); i++) {
+		if ((blocks[i].disk == disk) && blocks[i].dirty) {
+			rc = block_write_back(&blocks[i]);
+		}
+	}
+
+	k_mutex_unlock(&cache_lock);
+
+	return rc;
+}
+
+void disk_cache_attach(struct disk_info *disk)
+{
+	uint32_t sector_size = 0U;
+	uint32_t sector_count = 0U;
+
+	disk->cache_sector_count = 0U;
+	disk->cache_next_sector = UINT32_MAX;
+
+	if ((disk->ops->ioctl == NULL) ||
+	    (disk->ops->ioctl(disk, DISK_IOCTL_GET_SECTOR_SIZE, &sector_size) != 0) ||
+	    (disk->ops->ioctl(disk, DISK_IOCTL_GET_SECTOR_COUNT, &sector_count) != 0)) {
+		LOG_DBG("Disk %s not cached, unknown geometry", disk->name);
+		return;
+	}
+
+	if (sector_size != BLOCK_SIZE) {
+		LOG_DBG("Disk %s not cached, sector size %u", disk->name, sector_size);
+		return;
+	}
+
+	disk->cache_sector_count = sector_count;
+}
+
+int disk_cache_detach(struct disk_info *disk)
+{
+	int rc;
+
+	if (disk->cache_sector_count == 0U) {
+		return 0;
+	}
+
+	rc = disk_cache_flush(disk);
+
+	k_mutex_lock(&cache_lock, K_FOREVER);
+
+	for (size_t i = 0; i < ARRAY_SIZE(blocks); i++) {
+		if (blocks[i].disk == disk) {
+			block_free(&blocks[i]);
+		}
+	}
+
+	disk->cache_sector_count = 0U;
+
+	k_mutex_unlock(&cache_lock);
+
+	return rc;
+}
+
+#ifdef CONFIG_DISK_CACHE_STATS
+void disk_access_cache_stats_get(struct disk_cache_stats *stats)
+{
+	k_mutex_lock(&cache_lock, K_FOREVER);
+	*stats = cache_stats;
+	k_mutex_unlock(&cache_lock);
+}
+
+void disk_access_cache_stats_reset(void)
+{
+	k_mutex_lock(&cache_lock, K_FOREVER);
+	memset(&cache_stats, 0, sizeof(cache_stats));
+	k_mutex_unlock(&cache_lock);
+}
+#endif
+
+static int disk_cache_init(void)
+{
+	for (size_t i = 0; i < ARRAY_SIZE(blocks); i++) {
+		sys_dlist_append(&lru_list, &blocks[i].lru_node);
+	}
+
+	return 0;
+}
+
+SYS_INIT(disk_cache_init, PRE_KERNEL_1, 0);
@@ -0,0 +1,27 @@
+/*
+ * Copyright (c) 2025 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef ZEPHYR_SUBSYS_DISK_DISK_CACHE_H_
+#define ZEPHYR_SUBSYS_DISK_DISK_CACHE_H_
+
+#include <zephyr/drivers/disk.h>
+
+/* Start caching an initialized disk if its sector size matches the cache. */
+void disk_cache_attach(struct disk_info *disk);
+
+/* Write back modified sectors of the disk and stop caching it. */
+int disk_cache_detach(struct disk_info *disk);
+
+int disk_cache_read(struct disk_info *disk, uint8_t *data_buf,
+		    uint32_t start_sector, uint32_t num_sector);
+
+int disk_cache_write(struct disk_info *disk, const uint8_t *data_buf,
+		     uint32_t start_sector, uint32_t num_sector);
+
+/* Write back modified sectors of the disk. */
+int disk_cache_flush(struct disk_info *disk);
+
+#endif /* ZEPHYR_SUBSYS_DISK_DISK_CACHE_H_ */
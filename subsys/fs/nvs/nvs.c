@@ -6,6 +6,7 @@
  */
 
 #include <zephyr/drivers/flash.h>
+#include <zephyr/init.h>
 #include <string.h>
 #include <errno.h>
 #include <inttypes.h>
@@ -141,6 +142,122 @@ end:
 	return rc;
 }
 
+#ifdef CONFIG_NVS_WRITE_COMBINE
+
+/* Write combining: data and ATEs are gathered in two buffers which are each
+ * programmed with a single flash write. Data grows upwards from wc_data_addr,
+ * ATEs grow downwards and end at the end of wc_ate. Data is always programmed
+ * before the ATEs, an ATE must not be valid before the data it points to.
+ */
+static int nvs_wc_flush(struct nvs_fs *fs)
+{
+	int rc;
+
+	rc = nvs_flash_al_wrt(fs, fs->wc_data_addr, fs->wc_data, fs->wc_data_len);
+	if (rc) {
+		goto err;
+	}
+	fs->wc_data_len = 0U;
+
+	rc = nvs_flash_al_wrt(fs, fs->wc_ate_addr,
+			       &fs->wc_ate[sizeof(fs->wc_ate) - fs->wc_ate_len],
+			       fs->wc_ate_len);
+	if (rc) {
+		goto err;
+	}
+	fs->wc_ate_len = 0U;
+
+	return 0;
+
+err:
+	/* The flash may be partially programmed, neither retrying nor dropping
+	 * the pending entries is safe. nvs_mount() rebuilds the state from flash.
+	 */
+	LOG_ERR("Write combining flush failed: %d", rc);
+	fs->ready = false;
+	return rc;
+}
+
+static int nvs_wc_data_wrt(struct nvs_fs *fs, uint32_t addr, const void *data,
+			   size_t len)
+{
+	size_t al_len = nvs_al_size(fs, len);
+	int rc;
+
+	if (!len) {
+		return 0;
+	}
+
+	if (fs->wc_data_len &&
+	    ((addr != fs->wc_data_addr + fs->wc_data_len) ||
+	     (fs->wc_data_len + al_len > sizeof(fs->wc_data)))) {
+		rc = nvs_wc_flush(fs);
+		if (rc) {
+			return rc;
+		}
+	}
+
+	if (al_len > sizeof(fs->wc_data)) {
+		/* Too large to be combined, pending ATEs can follow it */
+		return nvs_flash_al_wrt(fs, addr, data, len);
+	}
+
+	if (!fs->wc_data_len) {
+		fs->wc_data_addr = addr;
+	}
+
+	memcpy(&fs->wc_data[fs->wc_data_len], data, len);
+	(void)memset(&fs->wc_data[fs->wc_data_len + len],
+		     fs->flash_parameters->erase_value, al_len - len);
+	fs->wc_data_len += al_len;
+
+	return 0;
+}
+
+static int nvs_wc_ate_wrt(struct nvs_fs *fs, uint32_t addr,
+			  const struct nvs_ate *entry)
+{
+	size_t al_len = nvs_al_size(fs, sizeof(struct nvs_ate));
+	uint8_t *dst;
+	int rc;
+
+	if (fs->wc_ate_len &&
+	    ((addr + al_len != fs->wc_ate_addr) ||
+	     (fs->wc_ate_len + al_len > sizeof(fs->wc_ate)))) {
+		rc = nvs_wc_flush(fs);
+		if (rc) {
+			return rc;
+		}
+	}
+
+	fs->wc_ate_addr = addr;
+	fs->wc_ate_len += al_len;
+
+	dst = &fs->wc_ate[sizeof(fs->wc_ate) - fs->wc_ate_len];
+	memcpy(dst, entry, sizeof(struct nvs_ate));
+	(void)memset(dst + sizeof(struct nvs_ate), fs->flash_parameters->erase_value,
+		     al_len - sizeof(struct nvs_ate));
+
+	return 0;
+}
+
+/* copy the part of a write combining buffer overlapping a read */
+static void nvs_wc_rd(uint32_t addr, uint8_t *data, size_t len, uint32_t wc_addr,
+		      const uint8_t *wc, size_t wc_len)
+{
+	uint32_t start = MAX(addr, wc_addr);
+	uint32_t end = MIN(addr + len, wc_addr + wc_len);
+
+	if (start < end) {
+		memcpy(&data[start - addr], &wc[start - wc_addr], end - start);
+	}
+}
+
+BUILD_ASSERT(CONFIG_NVS_WRITE_COMBINE_SIZE >= NVS_BLOCK_SIZE,
+	     "Write combining buffer must hold an ATE of any write block size");
+
+#endif /* CONFIG_NVS_WRITE_COMBINE */
+
 /* basic flash read from nvs address */
 static int nvs_flash_rd(struct nvs_fs *fs, uint32_t addr, void *data,
 			 size_t len)
@@ -153,16 +270,41 @@ static int nvs_flash_rd(struct nvs_fs *fs, uint32_t addr, void *data,
 	offset += addr & ADDR_OFFS_MASK;
 
 	rc = flash_read(fs->flash_device, offset, data, len);
+
+#ifdef CONFIG_NVS_WRITE_COMBINE
+	if (!rc) {
+		nvs_wc_rd(addr, data, len, fs->wc_data_addr, fs->wc_data,
+			  fs->wc_data_len);
+		nvs_wc_rd(addr, data, len, fs->wc_ate_addr,
+			  &fs->wc_ate[sizeof(fs->wc_ate) - fs->wc_ate_len],
+			  fs->wc_ate_len);
+	}
+#endif
 	return rc;
 }
 
+/* data write to nvs address */
+static int nvs_flash_data_al_wrt(struct nvs_fs *fs, uint32_t addr, const void *data,
+				  size_t len)
+{
+#ifdef CONFIG_NVS_WRITE_COMBINE
+	return nvs_wc_data_wrt(fs, addr, data, len);
+#else
+	return nvs_flash_al_wrt(fs, addr, data, len);
+#endif
+}
+
 /* allocation entry write */
 static int nvs_flash_ate_wrt(struct nvs_fs *fs, const struct nvs_ate *entry)
 {
 	int rc;
 
+#ifdef CONFIG_NVS_WRITE_COMBINE
+	rc = nvs_wc_ate_wrt(fs, fs->ate_wra, entry);
+#else
 	rc = nvs_flash_al_wrt(fs, fs->ate_wra, entry,
 			       sizeof(struct nvs_ate));
+#endif
 #ifdef CONFIG_NVS_LOOKUP_CACHE
 	/* 0xFFFF is a special-purpose identifier. Exclude it from the cache */
 	if (entry->id != 0xFFFF) {
@@ -189,7 +331,7 @@ static int nvs_flash_data_wrt(struct nvs_fs *fs, const void *data, size_t len, b
 		 * the end of the unaligned data later
 		 */
 		aligned_len = len & ~(fs->flash_parameters->write_block_size - 1U);
-		rc = nvs_flash_al_wrt(fs, fs->data_wra, data8, aligned_len);
+		rc = nvs_flash_data_al_wrt(fs, fs->data_wra, data8, aligned_len);
 		fs->data_wra += aligned_len;
 		if (rc) {
 			return rc;
@@ -209,9 +351,9 @@ static int nvs_flash_data_wrt(struct nvs_fs *fs, const void *data, size_t len, b
 		memcpy(pbuf, &data_crc, sizeof(data_crc));
 		len += sizeof(data_crc);
 
-		rc = nvs_flash_al_wrt(fs, fs->data_wra, buf, len);
+		rc = nvs_flash_data_al_wrt(fs, fs->data_wra, buf, len);
 	} else {
-		rc = nvs_flash_al_wrt(fs, fs->data_wra, data, len);
+		rc = nvs_flash_data_al_wrt(fs, fs->data_wra, data, len);
 	}
 	fs->data_wra += nvs_al_size(fs, len);
 
@@ -333,6 +475,14 @@ static int nvs_flash_erase_sector(struct nvs_fs *fs, uint32_t addr)
 	int rc;
 	off_t offset;
 
+#ifdef CONFIG_NVS_WRITE_COMBINE
+	/* Data moved by gc must be in flash before its old copy is erased */
+	rc = nvs_wc_flush(fs);
+	if (rc) {
+		return rc;
+	}
+#endif
+
 	addr &= ADDR_SECT_MASK;
 
 	offset = fs->offset;
@@ -975,6 +1125,11 @@ end:
 
 		rc = nvs_add_gc_done_ate(fs);
 	}
+#ifdef CONFIG_NVS_WRITE_COMBINE
+	if (!rc) {
+		rc = nvs_wc_flush(fs);
+	}
+#endif
 	k_mutex_unlock(&fs->nvs_lock);
 	return rc;
 }
@@ -989,6 +1144,17 @@ int nvs_clear(struct nvs_fs *fs)
 		return -EACCES;
 	}
 
+#ifdef CONFIG_NVS_GC_ASYNC
+	struct k_work_sync sync;
+
+	(void)k_work_cancel_sync(&fs->gc_work, &sync);
+#endif
+#ifdef CONFIG_NVS_WRITE_COMBINE
+	/* Pending writes go to sectors about to be erased */
+	fs->wc_data_len = 0U;
+	fs->wc_ate_len = 0U;
+#endif
+
 	for (uint16_t i = 0; i < fs->sector_count; i++) {
 		addr = i << ADDR_SECT_SHIFT;
 		rc = nvs_flash_erase_sector(fs, addr);
@@ -1003,14 +1169,92 @@ int nvs_clear(struct nvs_fs *fs)
 	return 0;
 }
 
+#ifdef CONFIG_NVS_GC_ASYNC
+
+#define NVS_GC_ASYNC_NO_SECTOR UINT16_MAX
+
+static K_THREAD_STACK_DEFINE(nvs_gc_async_stack, CONFIG_NVS_GC_ASYNC_STACK_SIZE);
+static struct k_work_q nvs_gc_async_workq;
+
+/* The active sector is close to full and switching it in the background is
+ * worth it: a sector already left nearly full by gc would only move the same
+ * data again.
+ */
+static bool nvs_gc_async_needed(struct nvs_fs *fs)
+{
+	return ((fs->ate_wra - fs->data_wra) < CONFIG_NVS_GC_ASYNC_THRESHOLD) &&
+	       ((fs->ate_wra >> ADDR_SECT_SHIFT) != fs->gc_async_sector);
+}
+
+static void nvs_gc_async_handler(struct k_work *work)
+{
+	struct nvs_fs *fs = CONTAINER_OF(work, struct nvs_fs, gc_work);
+	int rc;
+
+	k_mutex_lock(&fs->nvs_lock, K_FOREVER);
+
+	if (!fs->ready || !nvs_gc_async_needed(fs)) {
+		goto end;
+	}
+
+	rc = nvs_sector_close(fs);
+	if (!rc) {
+		rc = nvs_gc(fs);
+	}
+	if (rc) {
+		LOG_ERR("Background gc failed: %d", rc);
+		goto end;
+	}
+
+	fs->gc_async_sector = NVS_GC_ASYNC_NO_SECTOR;
+	if (nvs_gc_async_needed(fs)) {
+		fs->gc_async_sector = fs->ate_wra >> ADDR_SECT_SHIFT;
+	}
+
+end:
+	k_mutex_unlock(&fs->nvs_lock);
+}
+
+static int nvs_gc_async_init(void)
+{
+	k_work_queue_start(&nvs_gc_async_workq, nvs_gc_async_stack,
+			   K_THREAD_STACK_SIZEOF(nvs_gc_async_stack),
+			   CONFIG_NVS_GC_ASYNC_PRIORITY, NULL);
+	k_thread_name_set(&nvs_gc_async_workq.thread, "nvs_gc");
+
+	return 0;
+}
+
+SYS_INIT(nvs_gc_async_init, POST_KERNEL, CONFIG_KERNEL_INIT_PRIORITY_DEFAULT);
+
+#endif /* CONFIG_NVS_GC_ASYNC */
+
 int nvs_mount(struct nvs_fs *fs)
 {
 	int rc;
 	struct flash_pages_info info;
 	size_t write_block_size;
 
+#ifdef CONFIG_NVS_GC_ASYNC
+	/* fs may not be initialized yet, so do not touch its work item: wait
+	 * for the queue to be idle instead, the work of a previous mount can
+	 * then be neither pending nor running when it is initialized again.
+	 */
+	(void)k_work_queue_drain(&nvs_gc_async_workq, false);
+#endif
+
 	k_mutex_init(&fs->nvs_lock);
 
+#ifdef CONFIG_NVS_WRITE_COMBINE
+	/* Writes not flushed before a remount are dropped */
+	fs->wc_data_len = 0U;
+	fs->wc_ate_len = 0U;
+#endif
+#ifdef CONFIG_NVS_GC_ASYNC
+	k_work_init(&fs->gc_work, nvs_gc_async_handler);
+	fs->gc_async_sector = NVS_GC_ASYNC_NO_SECTOR;
+#endif
+
 	fs->flash_parameters = flash_get_parameters(fs->flash_device);
 	if (fs->flash_parameters == NULL) {
 		LOG_ERR("Could not obtain flash parameters");
@@ -1188,6 +1432,12 @@ no_cached_entry:
 		gc_count++;
 	}
 	rc = len;
+
+#ifdef CONFIG_NVS_GC_ASYNC
+	if (nvs_gc_async_needed(fs)) {
+		(void)k_work_submit_to_queue(&nvs_gc_async_workq, &fs->gc_work);
+	}
+#endif
 end:
 	k_mutex_unlock(&fs->nvs_lock);
 	return rc;
@@ -1400,3 +1650,25 @@ end:
 	k_mutex_unlock(&fs->nvs_lock);
 	return ret;
 }
+
+int nvs_flush(struct nvs_fs *fs)
+{
+#ifdef CONFIG_NVS_WRITE_COMBINE
+	int rc;
+
+	if (!fs->ready) {
+		LOG_ERR("NVS not initialized");
+		return -EACCES;
+	}
+
+	k_mutex_lock(&fs->nvs_lock, K_FOREVER);
+	rc = nvs_wc_flush(fs);
+	k_mutex_unlock(&fs->nvs_lock);
+
+	return rc;
+#else
+	ARG_UNUSED(fs);
+
+	return 0;
+#endif
+}
@@ -9,6 +9,7 @@
 #include <string.h>
 #include <errno.h>
 #include <inttypes.h>
+#include <zephyr/init.h>
 #include <zephyr/fs/zms.h>
 #include <zephyr/sys/crc.h>
 #include "zms_priv.h"
@@ -24,9 +25,7 @@ static int zms_get_sector_header(struct zms_fs *fs, uint64_t addr, struct zms_at
 static int zms_ate_valid_different_sector(struct zms_fs *fs, const struct zms_ate *entry,
 					  uint8_t cycle_cnt);
 
-#ifdef CONFIG_ZMS_LOOKUP_CACHE
-
-static inline size_t zms_lookup_cache_pos(uint32_t id)
+static inline uint32_t zms_id_hash(uint32_t id)
 {
 	uint32_t hash;
 
@@ -38,7 +37,14 @@ static inline size_t zms_lookup_cache_pos(uint32_t id)
 	hash *= 0x846ca68bU;
 	hash ^= hash >> 16;
 
-	return hash % CONFIG_ZMS_LOOKUP_CACHE_SIZE;
+	return hash;
+}
+
+#ifdef CONFIG_ZMS_LOOKUP_CACHE
+
+static inline size_t zms_lookup_cache_pos(uint32_t id)
+{
+	return zms_id_hash(id) % CONFIG_ZMS_LOOKUP_CACHE_SIZE;
 }
 
 static int zms_lookup_cache_rebuild(struct zms_fs *fs)
@@ -107,6 +113,172 @@ static void zms_lookup_cache_invalidate(struct zms_fs *fs, uint32_t sector)
 
 #endif /* CONFIG_ZMS_LOOKUP_CACHE */
 
+#ifdef CONFIG_ZMS_LOOKUP_INDEX
+
+/* The lookup index is a linear probing hash table holding the address of the
+ * latest ATE of every ID in the storage. A free slot has no address and one
+ * slot is always kept free to end the probes. When more IDs are stored than
+ * the index can hold, it is marked invalid and lookups walk the ATEs until the
+ * next mount.
+ */
+#define ZMS_LOOKUP_INDEX_MASK (CONFIG_ZMS_LOOKUP_INDEX_SIZE - 1U)
+
+BUILD_ASSERT(IS_POWER_OF_TWO(CONFIG_ZMS_LOOKUP_INDEX_SIZE),
+	     "ZMS lookup index size must be a power of 2");
+
+static uint32_t zms_lookup_index_pos(struct zms_fs *fs, uint32_t id)
+{
+	uint32_t pos = zms_id_hash(id) & ZMS_LOOKUP_INDEX_MASK;
+
+	while ((fs->lookup_index[pos].addr != ZMS_LOOKUP_CACHE_NO_ADDR) &&
+	       (fs->lookup_index[pos].id != id)) {
+		pos = (pos + 1U) & ZMS_LOOKUP_INDEX_MASK;
+	}
+
+	return pos;
+}
+
+static inline uint64_t zms_lookup_index_find(struct zms_fs *fs, uint32_t id)
+{
+	return fs->lookup_index[zms_lookup_index_pos(fs, id)].addr;
+}
+
+static void zms_lookup_index_set(struct zms_fs *fs, uint32_t id, uint64_t addr)
+{
+	struct zms_lookup_index_entry *entry = &fs->lookup_index[zms_lookup_index_pos(fs, id)];
+
+	if (entry->addr == ZMS_LOOKUP_CACHE_NO_ADDR) {
+		if (fs->lookup_index_count == ZMS_LOOKUP_INDEX_MASK) {
+			LOG_WRN("Lookup index full, falling back to ATE walks");
+			fs->lookup_index_valid = false;
+			return;
+		}
+		entry->id = id;
+		fs->lookup_index_count++;
+	}
+
+	entry->addr = addr;
+}
+
+/* Free a slot, moving back the entries of the probe sequence so that no free
+ * slot is left between them and their home slot.
+ */
+static void zms_lookup_index_remove(struct zms_fs *fs, uint32_t pos)
+{
+	uint32_t next = pos;
+	uint32_t home;
+
+	while (true) {
+		next = (next + 1U) & ZMS_LOOKUP_INDEX_MASK;
+		if (fs->lookup_index[next].addr == ZMS_LOOKUP_CACHE_NO_ADDR) {
+			break;
+		}
+
+		home = zms_id_hash(fs->lookup_index[next].id) & ZMS_LOOKUP_INDEX_MASK;
+		if (((next - home) & ZMS_LOOKUP_INDEX_MASK) >= ((next - pos) & ZMS_LOOKUP_INDEX_MASK)) {
+			fs->lookup_index[pos] = fs->lookup_index[next];
+			pos = next;
+		}
+	}
+
+	fs->lookup_index[pos].addr = ZMS_LOOKUP_CACHE_NO_ADDR;
+	fs->lookup_index_count--;
+}
+
+static void zms_lookup_index_invalidate(struct zms_fs *fs, uint32_t sector)
+{
+	uint32_t pos = 0U;
+
+	while (pos < CONFIG_ZMS_LOOKUP_INDEX_SIZE) {
+		uint64_t addr = fs->lookup_index[pos].addr;
+
+		if ((addr != ZMS_LOOKUP_CACHE_NO_ADDR) && (SECTOR_NUM(addr) == sector)) {
+			/* Check again the entry moved to this slot */
+			zms_lookup_index_remove(fs, pos);
+			continue;
+		}
+		pos++;
+	}
+}
+
+static int zms_lookup_index_rebuild(struct zms_fs *fs)
+{
+	int rc;
+	int previous_sector_num = ZMS_INVALID_SECTOR_NUM;
+	uint64_t addr;
+	uint64_t ate_addr;
+	uint8_t current_cycle;
+	struct zms_ate ate;
+
+	for (uint32_t i = 0; i < CONFIG_ZMS_LOOKUP_INDEX_SIZE; i++) {
+		fs->lookup_index[i].addr = ZMS_LOOKUP_CACHE_NO_ADDR;
+	}
+	fs->lookup_index_count = 0U;
+	fs->lookup_index_valid = true;
+
+	addr = fs->ate_wra;
+
+	/* The first valid ATE found for an ID walking backwards is the latest one */
+	while (fs->lookup_index_valid) {
+		ate_addr = addr;
+		rc = zms_prev_ate(fs, &addr, &ate);
+		if (rc) {
+			fs->lookup_index_valid = false;
+			return rc;
+		}
+
+		if ((ate.id != ZMS_HEAD_ID) &&
+		    (zms_lookup_index_find(fs, ate.id) == ZMS_LOOKUP_CACHE_NO_ADDR)) {
+			/* read the ate cycle only when we change the sector
+			 * or if it is the first read
+			 */
+			if (SECTOR_NUM(ate_addr) != previous_sector_num) {
+				rc = zms_get_sector_cycle(fs, ate_addr, &current_cycle);
+				if (rc == -ENOENT) {
+					/* sector never used */
+					current_cycle = 0;
+				} else if (rc) {
+					/* bad flash read */
+					fs->lookup_index_valid = false;
+					return rc;
+				}
+			}
+			previous_sector_num = SECTOR_NUM(ate_addr);
+
+			if (zms_ate_valid_different_sector(fs, &ate, current_cycle)) {
+				zms_lookup_index_set(fs, ate.id, ate_addr);
+			}
+		}
+
+		if (addr == fs->ate_wra) {
+			break;
+		}
+	}
+
+	LOG_DBG("Lookup index holds %u IDs", fs->lookup_index_count);
+
+	return 0;
+}
+
+#endif /* CONFIG_ZMS_LOOKUP_INDEX */
+
+/* Address from where to search the latest ATE of an ID, ZMS_LOOKUP_CACHE_NO_ADDR
+ * when the ID is known not to be stored.
+ */
+static uint64_t zms_lookup_addr(struct zms_fs *fs, uint32_t id)
+{
+#ifdef CONFIG_ZMS_LOOKUP_INDEX
+	if (fs->lookup_index_valid) {
+		return zms_lookup_index_find(fs, id);
+	}
+#endif
+#ifdef CONFIG_ZMS_LOOKUP_CACHE
+	return fs->lookup_cache[zms_lookup_cache_pos(id)];
+#else
+	return fs->ate_wra;
+#endif
+}
+
 /* Helper to compute offset given the address */
 static inline off_t zms_addr_to_offset(struct zms_fs *fs, uint64_t addr)
 {
@@ -190,14 +362,135 @@ end:
 	return rc;
 }
 
+#ifdef CONFIG_ZMS_WRITE_COMBINE
+
+BUILD_ASSERT(CONFIG_ZMS_WRITE_COMBINE_SIZE >= ZMS_BLOCK_SIZE,
+	     "Write combining buffer must hold an ATE of any write block size");
+
+/* Write combining: data and ATEs are gathered in two buffers which are each
+ * written with a single flash write. Data grows upwards from wc_data_addr,
+ * ATEs grow downwards and end at the end of wc_ate. Data is always written
+ * before the ATEs, an ATE must not be valid before the data it points to.
+ */
+static int zms_wc_flush(struct zms_fs *fs)
+{
+	int rc;
+
+	rc = zms_flash_al_wrt(fs, fs->wc_data_addr, fs->wc_data, fs->wc_data_len);
+	if (rc) {
+		goto err;
+	}
+	fs->wc_data_len = 0U;
+
+	rc = zms_flash_al_wrt(fs, fs->wc_ate_addr, &fs->wc_ate[sizeof(fs->wc_ate) - fs->wc_ate_len],
+			      fs->wc_ate_len);
+	if (rc) {
+		goto err;
+	}
+	fs->wc_ate_len = 0U;
+
+	return 0;
+
+err:
+	/* The storage may be partially written, neither retrying nor dropping the pending
+	 * entries is safe. zms_mount() rebuilds the state from the storage.
+	 */
+	LOG_ERR("Write combining flush failed, returned = %d", rc);
+	fs->ready = false;
+	return rc;
+}
+
+static int zms_wc_data_wrt(struct zms_fs *fs, uint64_t addr, const void *data, size_t len)
+{
+	size_t al_len = zms_al_size(fs, len);
+	int rc;
+
+	if (!len) {
+		return 0;
+	}
+
+	if (fs->wc_data_len && ((addr != fs->wc_data_addr + fs->wc_data_len) ||
+				(fs->wc_data_len + al_len > sizeof(fs->wc_data)))) {
+		rc = zms_wc_flush(fs);
+		if (rc) {
+			return rc;
+		}
+	}
+
+	if (al_len > sizeof(fs->wc_data)) {
+		/* Too large to be combined, pending ATEs can follow it */
+		return zms_flash_al_wrt(fs, addr, data, len);
+	}
+
+	if (!fs->wc_data_len) {
+		fs->wc_data_addr = addr;
+	}
+
+	memcpy(&fs->wc_data[fs->wc_data_len], data, len);
+	(void)memset(&fs->wc_data[fs->wc_data_len + len], fs->flash_parameters->erase_value,
+		     al_len - len);
+	fs->wc_data_len += al_len;
+
+	return 0;
+}
+
+static int zms_wc_ate_wrt(struct zms_fs *fs, uint64_t addr, const struct zms_ate *entry)
+{
+	uint8_t *dst;
+	int rc;
+
+	if (fs->wc_ate_len && ((addr + fs->ate_size != fs->wc_ate_addr) ||
+			       (fs->wc_ate_len + fs->ate_size > sizeof(fs->wc_ate)))) {
+		rc = zms_wc_flush(fs);
+		if (rc) {
+			return rc;
+		}
+	}
+
+	fs->wc_ate_addr = addr;
+	fs->wc_ate_len += fs->ate_size;
+
+	dst = &fs->wc_ate[sizeof(fs->wc_ate) - fs->wc_ate_len];
+	memcpy(dst, entry, sizeof(struct zms_ate));
+	(void)memset(dst + sizeof(struct zms_ate), fs->flash_parameters->erase_value,
+		     fs->ate_size - sizeof(struct zms_ate));
+
+	return 0;
+}
+
+/* copy the part of a write combining buffer overlapping a read */
+static void zms_wc_rd(uint64_t addr, uint8_t *data, size_t len, uint64_t wc_addr,
+		      const uint8_t *wc, size_t wc_len)
+{
+	uint64_t start = MAX(addr, wc_addr);
+	uint64_t end = MIN(addr + len, wc_addr + wc_len);
+
+	if (start < end) {
+		memcpy(&data[start - addr], &wc[start - wc_addr], end - start);
+	}
+}
+
+#endif /* CONFIG_ZMS_WRITE_COMBINE */
+
 /* basic flash read from zms address */
 static int zms_flash_rd(struct zms_fs *fs, uint64_t addr, void *data, size_t len)
 {
 	off_t offset;
+	int rc;
 
 	offset = zms_addr_to_offset(fs, addr);
 
-	return flash_read(fs->flash_device, offset, data, len);
+	rc = flash_read(fs->flash_device, offset, data, len);
+
+#ifdef CONFIG_ZMS_WRITE_COMBINE
+	if (!rc) {
+		zms_wc_rd(addr, data, len, fs->wc_data_addr, fs->wc_data, fs->wc_data_len);
+		zms_wc_rd(addr, data, len, fs->wc_ate_addr,
+			  &fs->wc_ate[sizeof(fs->wc_ate) - fs->wc_ate_len], fs->wc_ate_len);
+	}
+#endif
+
+	return rc;
 }
 
 /* allocation entry write */
@@ -205,7 +498,11 @@ static int zms_flash_ate_wrt(struct zms_fs *fs, const struct zms_ate *entry)
 {
 	int rc;
 
+#ifdef CONFIG_ZMS_WRITE_COMBINE
+	rc = zms_wc_ate_wrt(fs, fs->ate_wra, entry);
+#else
 	rc = zms_flash_al_wrt(fs, fs->ate_wra, entry, sizeof(struct zms_ate));
+#endif
 	if (rc) {
 		goto end;
 	}
@@ -214,6 +511,11 @@ static int zms_flash_ate_wrt(struct zms_fs *fs, const struct zms_ate *entry)
 	if (entry->id != ZMS_HEAD_ID) {
 		fs->lookup_cache[zms_lookup_cache_pos(entry->id)] = fs->ate_wra;
 	}
+#endif
+#ifdef CONFIG_ZMS_LOOKUP_INDEX
+	if ((entry->id != ZMS_HEAD_ID) && fs->lookup_index_valid) {
+		zms_lookup_index_set(fs, entry->id, fs->ate_wra);
+	}
 #endif
 	fs->ate_wra -= zms_al_size(fs, sizeof(struct zms_ate));
 end:
@@ -225,7 +527,11 @@ static int zms_flash_data_wrt(struct zms_fs *fs, const void *data, size_t len)
 {
 	int rc;
 
+#ifdef CONFIG_ZMS_WRITE_COMBINE
+	rc = zms_wc_data_wrt(fs, fs->data_wra, data, len);
+#else
 	rc = zms_flash_al_wrt(fs, fs->data_wra, data, len);
+#endif
 	if (rc < 0) {
 		return rc;
 	}
@@ -335,6 +641,14 @@ static int zms_flash_erase_sector(struct zms_fs *fs, uint64_t addr)
 	bool ebw_required =
 		flash_params_get_erase_cap(fs->flash_parameters) & FLASH_ERASE_C_EXPLICIT;
 
+#ifdef CONFIG_ZMS_WRITE_COMBINE
+	/* Data moved by gc must be in the storage before its old copy is erased */
+	rc = zms_wc_flush(fs);
+	if (rc) {
+		return rc;
+	}
+#endif
+
 	if (!ebw_required) {
 		/* Do nothing for devices that do not have erase capability */
 		return 0;
@@ -348,6 +662,9 @@ static int zms_flash_erase_sector(struct zms_fs *fs, uint64_t addr)
 
 #ifdef CONFIG_ZMS_LOOKUP_CACHE
 	zms_lookup_cache_invalidate(fs, SECTOR_NUM(addr));
+#endif
+#ifdef CONFIG_ZMS_LOOKUP_INDEX
+	zms_lookup_index_invalidate(fs, SECTOR_NUM(addr));
 #endif
 	rc = flash_erase(fs->flash_device, offset, fs->sector_size);
 
@@ -989,15 +1306,11 @@ static int zms_gc(struct zms_fs *fs)
 			continue;
 		}
 
-#ifdef CONFIG_ZMS_LOOKUP_CACHE
-		wlk_addr = fs->lookup_cache[zms_lookup_cache_pos(gc_ate.id)];
+		wlk_addr = zms_lookup_addr(fs, gc_ate.id);
 
 		if (wlk_addr == ZMS_LOOKUP_CACHE_NO_ADDR) {
 			wlk_addr = fs->ate_wra;
 		}
-#else
-		wlk_addr = fs->ate_wra;
-#endif
 
 		/* Initialize the wlk_prev_addr as if no previous ID will be found */
 		wlk_prev_addr = gc_prev_addr;
@@ -1061,6 +1374,9 @@ gc_done:
 
 #ifdef CONFIG_ZMS_LOOKUP_CACHE
 	zms_lookup_cache_invalidate(fs, sec_addr >> ADDR_SECT_SHIFT);
+#endif
+#ifdef CONFIG_ZMS_LOOKUP_INDEX
+	zms_lookup_index_invalidate(fs, sec_addr >> ADDR_SECT_SHIFT);
 #endif
 	rc = zms_add_empty_ate(fs, sec_addr);
 
@@ -1077,7 +1393,18 @@ int zms_clear(struct zms_fs *fs)
 		return -EACCES;
 	}
 
+#ifdef CONFIG_ZMS_GC_ASYNC
+	struct k_work_sync sync;
+
+	(void)k_work_cancel_sync(&fs->gc_work, &sync);
+#endif
+
 	k_mutex_lock(&fs->zms_lock, K_FOREVER);
+#ifdef CONFIG_ZMS_WRITE_COMBINE
+	/* Pending writes go to sectors about to be erased */
+	fs->wc_data_len = 0U;
+	fs->wc_ate_len = 0U;
+#endif
 	for (uint32_t i = 0; i < fs->sector_count; i++) {
 		addr = (uint64_t)i << ADDR_SECT_SHIFT;
 		rc = zms_flash_erase_sector(fs, addr);
@@ -1348,6 +1675,11 @@ end:
 	if (!rc) {
 		rc = zms_lookup_cache_rebuild(fs);
 	}
+#endif
+#ifdef CONFIG_ZMS_LOOKUP_INDEX
+	if (!rc) {
+		rc = zms_lookup_index_rebuild(fs);
+	}
 #endif
 	/* If the sector is empty add a gc done ate to avoid having insufficient
 	 * space when doing gc.
@@ -1355,19 +1687,105 @@ end:
 	if ((!rc) && (SECTOR_OFFSET(fs->ate_wra) == (fs->sector_size - 3 * fs->ate_size))) {
 		rc = zms_add_gc_done_ate(fs);
 	}
+#ifdef CONFIG_ZMS_WRITE_COMBINE
+	if (!rc) {
+		rc = zms_wc_flush(fs);
+	}
+#endif
 	k_mutex_unlock(&fs->zms_lock);
 
 	return rc;
 }
 
+#ifdef CONFIG_ZMS_GC_ASYNC
+
+#define ZMS_GC_ASYNC_NO_SECTOR UINT32_MAX
+
+static K_THREAD_STACK_DEFINE(zms_gc_async_stack, CONFIG_ZMS_GC_ASYNC_STACK_SIZE);
+static struct k_work_q zms_gc_async_workq;
+
+/* The active sector is close to full and switching it in the background is worth it:
+ * a sector already left nearly full by gc would only move the same data again.
+ */
+static bool zms_gc_async_needed(struct zms_fs *fs)
+{
+	return ((fs->ate_wra - fs->data_wra) < CONFIG_ZMS_GC_ASYNC_THRESHOLD) &&
+	       (SECTOR_NUM(fs->ate_wra) != fs->gc_async_sector);
+}
+
+static void zms_gc_async_handler(struct k_work *work)
+{
+	struct zms_fs *fs = CONTAINER_OF(work, struct zms_fs, gc_work);
+	int rc;
+
+	k_mutex_lock(&fs->zms_lock, K_FOREVER);
+
+	if (!fs->ready || !zms_gc_async_needed(fs)) {
+		goto end;
+	}
+
+	rc = zms_sector_close(fs);
+	if (!rc) {
+		rc = zms_gc(fs);
+	}
+	if (rc) {
+		LOG_ERR("Background garbage collection failed, returned = %d", rc);
+		goto end;
+	}
+
+	fs->gc_async_sector = ZMS_GC_ASYNC_NO_SECTOR;
+	if (zms_gc_async_needed(fs)) {
+		fs->gc_async_sector = SECTOR_NUM(fs->ate_wra);
+	}
+
+end:
+	k_mutex_unlock(&fs->zms_lock);
+}
+
+static int zms_gc_async_init(void)
+{
+	k_work_queue_start(&zms_gc_async_workq, zms_gc_async_stack,
+			   K_THREAD_STACK_SIZEOF(zms_gc_async_stack), CONFIG_ZMS_GC_ASYNC_PRIORITY,
+			   NULL);
+	k_thread_name_set(&zms_gc_async_workq.thread, "zms_gc");
+
+	return 0;
+}
+
+SYS_INIT(zms_gc_async_init, POST_KERNEL, CONFIG_KERNEL_INIT_PRIORITY_DEFAULT);
+
+#endif /* CONFIG_ZMS_GC_ASYNC */
+
 int zms_mount(struct zms_fs *fs)
 {
 	int rc;
 	struct flash_pages_info info;
 	size_t write_block_size;
 
+#ifdef CONFIG_ZMS_GC_ASYNC
+	/* fs may not be initialized yet, so do not touch its work item: wait for the queue to
+	 * be idle instead, the work of a previous mount can then be neither pending nor running
+	 * when it is initialized again.
+	 */
+	(void)k_work_queue_drain(&zms_gc_async_workq, false);
+#endif
+
 	k_mutex_init(&fs->zms_lock);
 
+#ifdef CONFIG_ZMS_LOOKUP_INDEX
+	/* Until it is built, gc during init must walk the ATEs */
+	fs->lookup_index_valid = false;
+#endif
+#ifdef CONFIG_ZMS_WRITE_COMBINE
+	/* Writes not flushed before a remount are dropped */
+	fs->wc_data_len = 0U;
+	fs->wc_ate_len = 0U;
+#endif
+#ifdef CONFIG_ZMS_GC_ASYNC
+	k_work_init(&fs->gc_work, zms_gc_async_handler);
+	fs->gc_async_sector = ZMS_GC_ASYNC_NO_SECTOR;
+#endif
+
 	fs->flash_parameters = flash_get_parameters(fs->flash_device);
 	if (fs->flash_parameters == NULL) {
 		LOG_ERR("Could not obtain flash parameters");
@@ -1456,14 +1874,11 @@ ssize_t zms_write(struct zms_fs *fs, uint32_t id, const void *data, size_t len)
 	}
 
 	/* find latest entry with same id */
-#ifdef CONFIG_ZMS_LOOKUP_CACHE
-	wlk_addr = fs->lookup_cache[zms_lookup_cache_pos(id)];
-
+	wlk_addr = zms_lookup_addr(fs, id);
+#if defined(CONFIG_ZMS_LOOKUP_CACHE) || defined(CONFIG_ZMS_LOOKUP_INDEX)
 	if (wlk_addr == ZMS_LOOKUP_CACHE_NO_ADDR) {
 		goto no_cached_entry;
 	}
-#else
-	wlk_addr = fs->ate_wra;
 #endif
 	rd_addr = wlk_addr;
 
@@ -1513,7 +1928,7 @@ ssize_t zms_write(struct zms_fs *fs, uint32_t id, const void *data, size_t len)
 	}
 #endif
 
-#ifdef CONFIG_ZMS_LOOKUP_CACHE
+#if defined(CONFIG_ZMS_LOOKUP_CACHE) || defined(CONFIG_ZMS_LOOKUP_INDEX)
 no_cached_entry:
 #endif
 	/* calculate required space if the entry contains data */
@@ -1566,6 +1981,12 @@ no_cached_entry:
 		gc_count++;
 	}
 	rc = len;
+
+#ifdef CONFIG_ZMS_GC_ASYNC
+	if (zms_gc_async_needed(fs)) {
+		(void)k_work_submit_to_queue(&zms_gc_async_workq, &fs->gc_work);
+	}
+#endif
 end:
 	k_mutex_unlock(&fs->zms_lock);
 	return rc;
@@ -1596,15 +2017,29 @@ ssize_t zms_read_hist(struct zms_fs *fs, uint32_t id, void *data, size_t len, ui
 
 	cnt_his = 0U;
 
-#ifdef CONFIG_ZMS_LOOKUP_CACHE
-	wlk_addr = fs->lookup_cache[zms_lookup_cache_pos(id)];
-
+	wlk_addr = zms_lookup_addr(fs, id);
+#if defined(CONFIG_ZMS_LOOKUP_CACHE) || defined(CONFIG_ZMS_LOOKUP_INDEX)
 	if (wlk_addr == ZMS_LOOKUP_CACHE_NO_ADDR) {
 		rc = -ENOENT;
 		goto err;
 	}
-#else
-	wlk_addr = fs->ate_wra;
+#endif
+
+#ifdef CONFIG_ZMS_LOOKUP_INDEX
+	if (fs->lookup_index_valid && (cnt == 0U)) {
+		/* Indexed ATEs were validated when written or mounted, so the cycle
+		 * count of their sector does not need to be read again.
+		 */
+		rc = zms_flash_ate_rd(fs, wlk_addr, &wlk_ate);
+		if (rc) {
+			goto err;
+		}
+		if ((wlk_ate.id == id) && !zms_ate_crc8_check(&wlk_ate)) {
+			prev_found = 1;
+			rd_addr = wlk_addr;
+			goto found;
+		}
+	}
 #endif
 
 	while (cnt_his <= cnt) {
@@ -1634,6 +2069,9 @@ ssize_t zms_read_hist(struct zms_fs *fs, uint32_t id, void *data, size_t len, ui
 		}
 	}
 
+#ifdef CONFIG_ZMS_LOOKUP_INDEX
+found:
+#endif
 	if (((!prev_found) || (wlk_ate.id != id)) || (wlk_ate.len == 0U) || (cnt_his < cnt)) {
 		return -ENOENT;
 	}
@@ -1842,3 +2280,25 @@ end:
 	k_mutex_unlock(&fs->zms_lock);
 	return ret;
 }
+
+int zms_flush(struct zms_fs *fs)
+{
+#ifdef CONFIG_ZMS_WRITE_COMBINE
+	int rc;
+
+	if (!fs->ready) {
+		LOG_ERR("ZMS not initialized");
+		return -EACCES;
+	}
+
+	k_mutex_lock(&fs->zms_lock, K_FOREVER);
+	rc = zms_wc_flush(fs);
+	k_mutex_unlock(&fs->zms_lock);
+
+	return rc;
+#else
+	ARG_UNUSED(fs);
+
+	return 0;
+#endif
+}
@@ -11,6 +11,7 @@
 #include <zephyr/llext/llext.h>
 #include <zephyr/kernel.h>
 #include <zephyr/cache.h>
+#include <zephyr/sys/crc.h>
 
 #include <zephyr/logging/log.h>
 LOG_MODULE_REGISTER(llext, CONFIG_LLEXT_LOG_LEVEL);
@@ -127,46 +128,476 @@ int llext_iterate(int (*fn)(struct llext *ext, void *arg), void *arg)
 	return ret;
 }
 
-const void *llext_find_sym(const struct llext_symtable *sym_table, const char *sym_name)
+#ifdef CONFIG_LLEXT_SYMTAB_HASH
+
+/* FNV-1a hash of a symbol name */
+static uint32_t llext_sym_hash(const char *name)
 {
-	if (sym_table == NULL) {
-		/* Built-in symbol table */
+	uint32_t hash = 2166136261U;
+
+	while (*name != '\0') {
+		hash ^= (uint8_t)*name++;
+		hash *= 16777619U;
+	}
+
+	return hash;
+}
+
+static inline size_t llext_symtable_hash_size(const struct llext_symtable *sym_table)
+{
+	return NHPOT(2 * sym_table->sym_cnt);
+}
+
+int llext_symtable_hash(struct llext *ext, struct llext_symtable *sym_table)
+{
+	size_t mask;
+	size_t size;
+
+	sym_table->hash = NULL;
+	if (sym_table->sym_cnt == 0) {
+		return 0;
+	}
+
+	size = llext_symtable_hash_size(sym_table) * sizeof(sym_table->hash[0]);
+	sym_table->hash = llext_alloc(size);
+	if (!sym_table->hash) {
+		return -ENOMEM;
+	}
+	memset(sym_table->hash, 0, size);
+	ext->alloc_size += size;
+
+	mask = llext_symtable_hash_size(sym_table) - 1;
+	for (size_t i = 0; i < sym_table->sym_cnt; i++) {
+		size_t pos = llext_sym_hash(sym_table->syms[i].name) & mask;
+
+		while (sym_table->hash[pos] != 0) {
+			pos = (pos + 1) & mask;
+		}
+		sym_table->hash[pos] = i + 1;
+	}
+
+	return 0;
+}
+
+void llext_symtable_hash_free(struct llext *ext, struct llext_symtable *sym_table)
+{
+	if (sym_table->hash) {
+		ext->alloc_size -= llext_symtable_hash_size(sym_table) *
+				   sizeof(sym_table->hash[0]);
+		llext_free(sym_table->hash);
+		sym_table->hash = NULL;
+	}
+}
+
+static const void *llext_find_sym_hashed(const struct llext_symtable *sym_table,
+					 const char *sym_name)
+{
+	size_t mask = llext_symtable_hash_size(sym_table) - 1;
+	size_t pos = llext_sym_hash(sym_name) & mask;
+
+	/* The table is at most half full, so there is always an empty slot */
+	while (sym_table->hash[pos] != 0) {
+		const struct llext_symbol *sym = &sym_table->syms[sym_table->hash[pos] - 1];
+
+		if (strcmp(sym->name, sym_name) == 0) {
+			return sym->addr;
+		}
+		pos = (pos + 1) & mask;
+	}
+
+	return NULL;
+}
+
+#endif /* CONFIG_LLEXT_SYMTAB_HASH */
+
 #ifdef CONFIG_LLEXT_EXPORT_BUILTINS_BY_SLID
-		/* 'sym_name' is actually a SLID to search for */
-		uintptr_t slid = (uintptr_t)sym_name;
 
-		/* TODO: perform a binary search instead of linear.
-		 * Note that - as of writing - the llext_const_symbol_area
-		 * section is sorted in ascending SLID order.
-		 * (see scripts/build/llext_prepare_exptab.py)
-		 */
-		STRUCT_SECTION_FOREACH(llext_const_symbol, sym) {
-			if (slid == sym->slid) {
-				return sym->addr;
+/* The llext_const_symbol_area section is sorted in ascending SLID order
+ * (see scripts/build/llext_prepare_exptab.py).
+ */
+static const void *llext_find_builtin_sym(uintptr_t slid)
+{
+	const struct llext_const_symbol *syms;
+	size_t lo = 0;
+	size_t hi;
+
+	STRUCT_SECTION_GET(llext_const_symbol, 0, &syms);
+	STRUCT_SECTION_COUNT(llext_const_symbol, &hi);
+
+	while (lo < hi) {
+		size_t mid = lo + (hi - lo) / 2;
+
+		if (syms[mid].slid == slid) {
+			return syms[mid].addr;
+		} else if (syms[mid].slid < slid) {
+			lo = mid + 1;
+		} else {
+			hi = mid;
+		}
+	}
+
+	return NULL;
+}
+
+#elif defined(CONFIG_LLEXT_EXPORT_BUILTINS_SORTED)
+
+/* The llext_const_symbol_area section is sorted by name after the build (see
+ * scripts/build/llext_prepare_exptab.py). Check it once, so that a table left
+ * unsorted is still searched linearly.
+ */
+static bool llext_builtins_sorted(void)
+{
+	static enum {
+		BUILTINS_UNCHECKED,
+		BUILTINS_SORTED,
+		BUILTINS_UNSORTED,
+	} state;
+	const struct llext_const_symbol *syms;
+	size_t cnt;
+
+	if (state == BUILTINS_UNCHECKED) {
+		STRUCT_SECTION_GET(llext_const_symbol, 0, &syms);
+		STRUCT_SECTION_COUNT(llext_const_symbol, &cnt);
+
+		state = BUILTINS_SORTED;
+		for (size_t i = 1; i < cnt; i++) {
+			if (strcmp(syms[i - 1].name, syms[i].name) >= 0) {
+				LOG_WRN("Built-in symbol table not sorted, using linear search");
+				state = BUILTINS_UNSORTED;
+				break;
 			}
 		}
-#else
+	}
+
+	return state == BUILTINS_SORTED;
+}
+
+static const void *llext_find_builtin_sym(const char *sym_name)
+{
+	const struct llext_const_symbol *syms;
+	size_t lo = 0;
+	size_t hi;
+
+	if (!llext_builtins_sorted()) {
 		STRUCT_SECTION_FOREACH(llext_const_symbol, sym) {
 			if (strcmp(sym->name, sym_name) == 0) {
 				return sym->addr;
 			}
 		}
+		return NULL;
+	}
+
+	STRUCT_SECTION_GET(llext_const_symbol, 0, &syms);
+	STRUCT_SECTION_COUNT(llext_const_symbol, &hi);
+
+	while (lo < hi) {
+		size_t mid = lo + (hi - lo) / 2;
+		int cmp = strcmp(syms[mid].name, sym_name);
+
+		if (cmp == 0) {
+			return syms[mid].addr;
+		} else if (cmp < 0) {
+			lo = mid + 1;
+		} else {
+			hi = mid;
+		}
+	}
+
+	return NULL;
+}
+
+#else
+
+static const void *llext_find_builtin_sym(const char *sym_name)
+{
+	STRUCT_SECTION_FOREACH(llext_const_symbol, sym) {
+		if (strcmp(sym->name, sym_name) == 0) {
+			return sym->addr;
+		}
+	}
+
+	return NULL;
+}
+
 #endif
-	} else {
-		/* find symbols in module */
-		for (size_t i = 0; i < sym_table->sym_cnt; i++) {
-			if (strcmp(sym_table->syms[i].name, sym_name) == 0) {
-				return sym_table->syms[i].addr;
-			}
+
+const void *llext_find_sym(const struct llext_symtable *sym_table, const char *sym_name)
+{
+	if (sym_table == NULL) {
+		/* Built-in symbol table */
+#ifdef CONFIG_LLEXT_EXPORT_BUILTINS_BY_SLID
+		/* 'sym_name' is actually a SLID to search for */
+		return llext_find_builtin_sym((uintptr_t)sym_name);
+#else
+		return llext_find_builtin_sym(sym_name);
+#endif
+	}
+
+#ifdef CONFIG_LLEXT_SYMTAB_HASH
+	if (sym_table->hash) {
+		return llext_find_sym_hashed(sym_table, sym_name);
+	}
+#endif
+
+	/* find symbols in module */
+	for (size_t i = 0; i < sym_table->sym_cnt; i++) {
+		if (strcmp(sym_table->syms[i].name, sym_name) == 0) {
+			return sym_table->syms[i].addr;
 		}
 	}
 
 	return NULL;
 }
 
+static void llext_free_ext(struct llext *ext)
+{
+	if (ext->sect_hdrs_on_heap) {
+		llext_free(ext->sect_hdrs);
+	}
+
+	llext_free_regions(ext);
+#ifdef CONFIG_LLEXT_SYMTAB_HASH
+	llext_symtable_hash_free(ext, &ext->sym_tab);
+	llext_symtable_hash_free(ext, &ext->exp_tab);
+#endif
+	llext_free(ext->sym_tab.syms);
+	llext_free(ext->exp_tab.syms);
+#ifdef CONFIG_LLEXT_LOAD_CACHE
+	llext_free(ext->cache_data);
+#endif
+	llext_free(ext);
+}
+
+#ifdef CONFIG_LLEXT_LOAD_CACHE
+
+/*
+ * Unloaded extensions that are kept relocated in memory, oldest first. An
+ * extension is either in this list or in _llext_list, never in both, so the
+ * same list node is used. Protected by llext_lock.
+ */
+static sys_slist_t llext_cache_list = SYS_SLIST_STATIC_INIT(&llext_cache_list);
+static unsigned int llext_cache_cnt;
+
+/*
+ * The cache key is the CRC of the ELF file, up to the end of its last section
+ * or of the section header table, whichever comes last.
+ */
+static int llext_cache_key(struct llext_loader *ldr, uint32_t *key)
+{
+	uint8_t buf[64];
+	elf_ehdr_t ehdr;
+	elf_shdr_t shdr;
+	size_t end, pos;
+	int ret;
+
+	ret = llext_prepare(ldr);
+	if (ret != 0) {
+		return ret;
+	}
+
+	ret = llext_seek(ldr, 0);
+	if (ret == 0) {
+		ret = llext_read(ldr, &ehdr, sizeof(ehdr));
+	}
+	if (ret != 0) {
+		goto out;
+	}
+
+	if (ehdr.e_shentsize != sizeof(elf_shdr_t)) {
+		ret = -ENOEXEC;
+		goto out;
+	}
+
+	end = ehdr.e_shoff + ehdr.e_shnum * sizeof(elf_shdr_t);
+	for (unsigned int i = 0; i < ehdr.e_shnum; i++) {
+		ret = llext_seek(ldr, ehdr.e_shoff + i * sizeof(elf_shdr_t));
+		if (ret == 0) {
+			ret = llext_read(ldr, &shdr, sizeof(shdr));
+		}
+		if (ret != 0) {
+			goto out;
+		}
+
+		if (shdr.sh_type != SHT_NOBITS) {
+			end = MAX(end, shdr.sh_offset + shdr.sh_size);
+		}
+	}
+
+	ret = llext_seek(ldr, 0);
+	*key = 0;
+	for (pos = 0; ret == 0 && pos < end; pos += sizeof(buf)) {
+		size_t len = MIN(sizeof(buf), end - pos);
+
+		ret = llext_read(ldr, buf, len);
+		if (ret == 0) {
+			*key = crc32_ieee_update(*key, buf, len);
+		}
+	}
+
+out:
+	llext_finalize(ldr);
+	return ret;
+}
+
+/*
+ * Keep a copy of the initialized data of a freshly loaded extension, so it can
+ * be restored when the extension is reloaded from the cache. Extensions with
+ * any part still in the ELF buffer cannot be cached, as the buffer may be gone
+ * by the time they are reloaded.
+ */
+static void llext_cache_prepare(struct llext *ext, uint32_t key)
+{
+	size_t data_size = ext->mem_size[LLEXT_MEM_DATA];
+
+	for (int i = 0; i < LLEXT_MEM_COUNT; i++) {
+		if (ext->mem[i] != NULL && !ext->mem_on_heap[i]) {
+			LOG_DBG("%s: region %d is not on the heap, not caching", ext->name, i);
+			return;
+		}
+	}
+
+	if (ext->sect_hdrs != NULL && !ext->sect_hdrs_on_heap) {
+		LOG_DBG("%s: section headers are not on the heap, not caching", ext->name);
+		return;
+	}
+
+	if (data_size != 0) {
+		ext->cache_data = llext_alloc(data_size);
+		if (ext->cache_data == NULL) {
+			LOG_DBG("%s: no memory for a copy of the data, not caching", ext->name);
+			return;
+		}
+		memcpy(ext->cache_data, ext->mem[LLEXT_MEM_DATA], data_size);
+		ext->alloc_size += data_size;
+	}
+
+	ext->cache_key = key;
+	ext->cacheable = true;
+}
+
+static void llext_cache_evict(struct llext *ext)
+{
+	LOG_DBG("Evicting extension %s from the cache", ext->name);
+
+	/*
+	 * The dependencies were kept loaded while the extension was cached.
+	 * Unload them properly, as this may well be their last user.
+	 */
+	for (unsigned int i = 0; i < ARRAY_SIZE(ext->dependency) && ext->dependency[i]; i++) {
+		struct llext *dep = ext->dependency[i];
+
+		llext_unload(&dep);
+	}
+
+	llext_free_ext(ext);
+}
+
+static void llext_cache_evict_all(void)
+{
+	sys_snode_t *node;
+
+	/* Evicting an extension may add its dependencies to the cache */
+	while ((node = sys_slist_get(&llext_cache_list)) != NULL) {
+		llext_cache_cnt--;
+		llext_cache_evict(CONTAINER_OF(node, struct llext, _llext_list));
+	}
+}
+
+static void llext_cache_put(struct llext *ext)
+{
+	sys_snode_t *node;
+
+	while (llext_cache_cnt >= CONFIG_LLEXT_LOAD_CACHE_SIZE) {
+		node = sys_slist_get(&llext_cache_list);
+		llext_cache_cnt--;
+		llext_cache_evict(CONTAINER_OF(node, struct llext, _llext_list));
+	}
+
+	sys_slist_append(&llext_cache_list, &ext->_llext_list);
+	llext_cache_cnt++;
+}
+
+/*
+ * Take the cached extension with the given name out of the cache. Its data is
+ * restored to the state right after relocation, so the extension is ready to
+ * be brought up again. An extension cached from a different ELF file is freed.
+ */
+static struct llext *llext_cache_take(const char *name, uint32_t key)
+{
+	struct llext *ext;
+
+	SYS_SLIST_FOR_EACH_CONTAINER(&llext_cache_list, ext, _llext_list) {
+		if (strncmp(ext->name, name, sizeof(ext->name)) == 0) {
+			break;
+		}
+	}
+
+	if (ext == NULL) {
+		return NULL;
+	}
+
+	sys_slist_find_and_remove(&llext_cache_list, &ext->_llext_list);
+	llext_cache_cnt--;
+
+	if (ext->cache_key != key) {
+		llext_cache_evict(ext);
+		return NULL;
+	}
+
+	if (ext->mem_size[LLEXT_MEM_DATA] != 0) {
+		memcpy(ext->mem[LLEXT_MEM_DATA], ext->cache_data, ext->mem_size[LLEXT_MEM_DATA]);
+		sys_cache_data_flush_range(ext->mem[LLEXT_MEM_DATA],
+					   ext->mem_size[LLEXT_MEM_DATA]);
+	}
+
+	if (ext->mem_size[LLEXT_MEM_BSS] != 0) {
+		memset(ext->mem[LLEXT_MEM_BSS], 0, ext->mem_size[LLEXT_MEM_BSS]);
+		sys_cache_data_flush_range(ext->mem[LLEXT_MEM_BSS],
+					   ext->mem_size[LLEXT_MEM_BSS]);
+	}
+
+	return ext;
+}
+
+#endif /* CONFIG_LLEXT_LOAD_CACHE */
+
+void llext_cache_flush(void)
+{
+#ifdef CONFIG_LLEXT_LOAD_CACHE
+	k_mutex_lock(&llext_lock, K_FOREVER);
+	llext_cache_evict_all();
+	k_mutex_unlock(&llext_lock);
+#endif
+}
+
+static int llext_load_new(struct llext_loader *ldr, struct llext **ext,
+			  const struct llext_load_param *ldr_parm)
+{
+	int ret;
+
+	*ext = llext_alloc(sizeof(struct llext));
+	if (*ext == NULL) {
+		LOG_ERR("Not enough memory for extension metadata");
+		return -ENOMEM;
+	}
+
+	ret = do_llext_load(ldr, *ext, ldr_parm);
+	if (ret < 0) {
+		llext_free(*ext);
+		*ext = NULL;
+	}
+
+	return ret;
+}
+
 int llext_load(struct llext_loader *ldr, const char *name, struct llext **ext,
 	       const struct llext_load_param *ldr_parm)
 {
+#ifdef CONFIG_LLEXT_LOAD_CACHE
+	/* Inspection data refers to the loader, which is not kept in the cache */
+	bool cache = ldr_parm != NULL && ldr_parm->cache && !ldr_parm->keep_section_info;
+	uint32_t cache_key;
+#endif
 	int ret;
 
 	*ext = llext_by_name(name);
@@ -179,17 +610,32 @@ int llext_load(struct llext_loader *ldr, const char *name, struct llext **ext,
 		goto out;
 	}
 
-	*ext = llext_alloc(sizeof(struct llext));
-	if (*ext == NULL) {
-		LOG_ERR("Not enough memory for extension metadata");
-		ret = -ENOMEM;
-		goto out;
+#ifdef CONFIG_LLEXT_LOAD_CACHE
+	if (cache) {
+		cache = llext_cache_key(ldr, &cache_key) == 0;
 	}
 
-	ret = do_llext_load(ldr, *ext, ldr_parm);
+	if (cache) {
+		*ext = llext_cache_take(name, cache_key);
+		if (*ext != NULL) {
+			(*ext)->use_count++;
+			sys_slist_append(&_llext_list, &(*ext)->_llext_list);
+			LOG_INF("Loaded extension %s from cache", (*ext)->name);
+			ret = 0;
+			goto out;
+		}
+	}
+#endif
+
+	ret = llext_load_new(ldr, ext, ldr_parm);
+#ifdef CONFIG_LLEXT_LOAD_CACHE
+	if (ret == -ENOMEM && llext_cache_cnt != 0) {
+		/* Make room by dropping the cache and try again */
+		llext_cache_evict_all();
+		ret = llext_load_new(ldr, ext, ldr_parm);
+	}
+#endif
 	if (ret < 0) {
-		llext_free(*ext);
-		*ext = NULL;
 		goto out;
 	}
 
@@ -198,6 +644,12 @@ int llext_load(struct llext_loader *ldr, const char *name, struct llext **ext,
 	(*ext)->name[LLEXT_MAX_NAME_LEN] = '\0';
 	(*ext)->use_count++;
 
+#ifdef CONFIG_LLEXT_LOAD_CACHE
+	if (cache) {
+		llext_cache_prepare(*ext, cache_key);
+	}
+#endif
+
 	sys_slist_append(&_llext_list, &(*ext)->_llext_list);
 	LOG_INF("Loaded extension %s", (*ext)->name);
 
@@ -232,19 +684,22 @@ int llext_unload(struct llext **ext)
 	/* FIXME: protect the global list */
 	sys_slist_find_and_remove(&_llext_list, &tmp->_llext_list);
 
+#ifdef CONFIG_LLEXT_LOAD_CACHE
+	if (tmp->cacheable) {
+		/* Dependencies stay loaded, the cached image is linked against them */
+		llext_cache_put(tmp);
+		*ext = NULL;
+		k_mutex_unlock(&llext_lock);
+		return 0;
+	}
+#endif
+
 	llext_dependency_remove_all(tmp);
 
 	*ext = NULL;
 	k_mutex_unlock(&llext_lock);
 
-	if (tmp->sect_hdrs_on_heap) {
-		llext_free(tmp->sect_hdrs);
-	}
-
-	llext_free_regions(tmp);
-	llext_free(tmp->sym_tab.syms);
-	llext_free(tmp->exp_tab.syms);
-	llext_free(tmp);
+	llext_free_ext(tmp);
 
 	return 0;
 }
@@ -62,6 +62,24 @@ ssize_t llext_file_offset(struct llext_loader *ldr, uintptr_t offset)
 	return -ENOEXEC;
 }
 
+/*
+ * Find the region containing a virtual address of a shared ELF file.
+ */
+static enum llext_mem llext_vma_region(struct llext_loader *ldr, uintptr_t addr)
+{
+	enum llext_mem i;
+
+	for (i = 0; i < LLEXT_MEM_COUNT; i++) {
+		if ((ldr->sects[i].sh_flags & SHF_ALLOC) &&
+		    ldr->sects[i].sh_addr <= addr &&
+		    ldr->sects[i].sh_addr + ldr->sects[i].sh_size > addr) {
+			break;
+		}
+	}
+
+	return i;
+}
+
 /*
  * We increment use-count every time a new dependent is added, and have to
  * decrement it again, when one is removed. Ideally we should be able to add
@@ -309,39 +327,47 @@ static void llext_link_plt(struct llext_loader *ldr, struct llext *ext, elf_shdr
 
 		const char *name = llext_symbol_name(ldr, ext, &sym);
 
-		/*
-		 * Both r_offset and sh_addr are addresses for which the extension
-		 * has been built.
-		 *
-		 * NOTE: The calculations below assumes offsets from the
-		 * beginning of the .text section in the ELF file can be
-		 * applied to the memory location of mem[LLEXT_MEM_TEXT].
-		 *
-		 * This is valid only for LLEXT_STORAGE_WRITABLE loaders
-		 * since the buffer will be directly modified.
-		 */
-		if (ldr->storage != LLEXT_STORAGE_WRITABLE) {
-			LOG_ERR("PLT: cannot link read-only ELF file");
-			continue;
-		}
-
-		uint8_t *rel_addr = (uint8_t *)ext->mem[LLEXT_MEM_TEXT] -
-			ldr->sects[LLEXT_MEM_TEXT].sh_offset;
+		uint8_t *rel_addr;
+		enum llext_mem mem_idx;
 
 		if (tgt) {
 			/* Relocatable / partially linked ELF. */
-			rel_addr += rela.r_offset + tgt->sh_offset;
+			mem_idx = ldr->sect_map[shdr->sh_info].mem_idx;
+			rel_addr = (uint8_t *)llext_loaded_sect_ptr(ldr, ext, shdr->sh_info);
+			if (!rel_addr) {
+				/* Detached section, relocated in the ELF buffer */
+				rel_addr = llext_peek(ldr, tgt->sh_offset);
+			}
+			if (!rel_addr) {
+				LOG_ERR("PLT: no data for section %u, trying to continue",
+					shdr->sh_info);
+				continue;
+			}
+			rel_addr += rela.r_offset;
 		} else {
-			/* Shared / dynamically linked ELF */
-			ssize_t offset = llext_file_offset(ldr, rela.r_offset);
-
-			if (offset < 0) {
+			/*
+			 * Shared / dynamically linked ELF: r_offset is the address
+			 * for which the extension has been built. Patch the region
+			 * containing it wherever it was placed, so that only the
+			 * relocated regions (e.g. .data and the GOT of position
+			 * independent code) need to be copied from read-only
+			 * storage.
+			 */
+			mem_idx = llext_vma_region(ldr, rela.r_offset);
+			if (mem_idx == LLEXT_MEM_COUNT || !ext->mem[mem_idx]) {
 				LOG_ERR("Offset %#zx not found in ELF, trying to continue",
 					(size_t)rela.r_offset);
 				continue;
 			}
+			rel_addr = (uint8_t *)ext->mem[mem_idx] +
+				   (rela.r_offset - ldr->sects[mem_idx].sh_addr);
+		}
 
-			rel_addr += offset;
+		if (ldr->storage != LLEXT_STORAGE_WRITABLE &&
+		    (mem_idx == LLEXT_MEM_COUNT || !ext->mem_on_heap[mem_idx])) {
+			LOG_ERR("PLT: cannot relocate read-only ELF data at %#zx",
+				(size_t)rela.r_offset);
+			continue;
 		}
 
 		uint32_t stb = ELF_ST_BIND(sym.st_info);
@@ -219,6 +219,51 @@ static int llext_find_tables(struct llext_loader *ldr, struct llext *ext)
 	((REGION_BOT(x, f) <= REGION_BOT(y, f) && REGION_TOP(x, f) >= REGION_BOT(y, f)) || \
 	 (REGION_BOT(y, f) <= REGION_BOT(x, f) && REGION_TOP(y, f) >= REGION_BOT(x, f)))
 
+/*
+ * Relocations of shared ELF files address the location to patch by its
+ * virtual address, and sh_info of the dynamic relocation sections does not
+ * name a target section. Mark the regions that contain the relocated
+ * locations, so that the other read-only regions, such as the text of
+ * position independent code, can be used in place.
+ */
+static int llext_mark_dyn_reloc_targets(struct llext_loader *ldr, const elf_shdr_t *shdr)
+{
+	elf_rel_t rel;
+	size_t pos;
+	int ret;
+
+	if (shdr->sh_entsize < sizeof(rel)) {
+		return -ENOEXEC;
+	}
+
+	for (pos = shdr->sh_offset; pos < shdr->sh_offset + shdr->sh_size;
+	     pos += shdr->sh_entsize) {
+		ret = llext_seek(ldr, pos);
+		if (ret != 0) {
+			return ret;
+		}
+
+		/* r_offset comes first in both REL and RELA entries */
+		ret = llext_read(ldr, &rel, sizeof(rel));
+		if (ret != 0) {
+			return ret;
+		}
+
+		for (enum llext_mem i = 0; i < LLEXT_MEM_COUNT; i++) {
+			elf_shdr_t *region = ldr->sects + i;
+
+			if ((region->sh_flags & SHF_ALLOC) && region->sh_size &&
+			    REGION_BOT(region, sh_addr) <= rel.r_offset &&
+			    REGION_TOP(region, sh_addr) >= rel.r_offset) {
+				region->sh_flags |= SHF_LLEXT_HAS_RELOCS;
+				break;
+			}
+		}
+	}
+
+	return 0;
+}
+
 /*
  * Loops through all defined ELF sections and collapses those with similar
  * usage flags into LLEXT "regions", taking alignment constraints into account.
@@ -500,7 +545,14 @@ static int llext_map_sections(struct llext_loader *ldr, struct llext *ext,
 		elf_shdr_t *shdr = ext->sect_hdrs + i;
 		enum llext_mem mem_idx = ldr->sect_map[i].mem_idx;
 
-		if (shdr->sh_type == SHT_REL || shdr->sh_type == SHT_RELA) {
+		if ((shdr->sh_type == SHT_REL || shdr->sh_type == SHT_RELA) &&
+		    ldr->hdr.e_type == ET_DYN) {
+			int ret = llext_mark_dyn_reloc_targets(ldr, shdr);
+
+			if (ret != 0) {
+				return ret;
+			}
+		} else if (shdr->sh_type == SHT_REL || shdr->sh_type == SHT_RELA) {
 			enum llext_mem target_region = ldr->sect_map[shdr->sh_info].mem_idx;
 
 			if (target_region != LLEXT_MEM_COUNT) {
@@ -804,6 +856,14 @@ int do_llext_load(struct llext_loader *ldr, struct llext *ext,
 		goto out;
 	}
 
+#ifdef CONFIG_LLEXT_SYMTAB_HASH
+	ret = llext_symtable_hash(ext, &ext->sym_tab);
+	if (ret != 0) {
+		LOG_ERR("Failed to hash symbol table, ret %d", ret);
+		goto out;
+	}
+#endif
+
 	if (ldr_parm->relocate_local) {
 		LOG_DBG("Linking ELF...");
 		ret = llext_link(ldr, ext, ldr_parm);
@@ -819,6 +879,14 @@ int do_llext_load(struct llext_loader *ldr, struct llext *ext,
 		goto out;
 	}
 
+#ifdef CONFIG_LLEXT_SYMTAB_HASH
+	ret = llext_symtable_hash(ext, &ext->exp_tab);
+	if (ret != 0) {
+		LOG_ERR("Failed to hash exported symbols, ret %d", ret);
+		goto out;
+	}
+#endif
+
 	if (!ldr_parm->pre_located) {
 		llext_adjust_mmu_permissions(ext);
 	}
@@ -838,6 +906,9 @@ out:
 	 * is enabled and no error is detected.
 	 */
 	if (!(IS_ENABLED(CONFIG_LLEXT_LOG_LEVEL_DBG) && ret == 0)) {
+#ifdef CONFIG_LLEXT_SYMTAB_HASH
+		llext_symtable_hash_free(ext, &ext->sym_tab);
+#endif
 		llext_free(ext->sym_tab.syms);
 		ext->sym_tab.sym_cnt = 0;
 		ext->sym_tab.syms = NULL;
@@ -851,6 +922,9 @@ out:
 		 * such as regions and exported symbols.
 		 */
 		llext_free_regions(ext);
+#ifdef CONFIG_LLEXT_SYMTAB_HASH
+		llext_symtable_hash_free(ext, &ext->exp_tab);
+#endif
 		llext_free(ext->exp_tab.syms);
 		ext->exp_tab.sym_cnt = 0;
 		ext->exp_tab.syms = NULL;
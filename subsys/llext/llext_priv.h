@@ -43,6 +43,15 @@ static inline void llext_free(void *ptr)
 	k_heap_free(&llext_heap, ptr);
 }
 
+/*
+ * Symbol tables (llext.c)
+ */
+
+#ifdef CONFIG_LLEXT_SYMTAB_HASH
+int llext_symtable_hash(struct llext *ext, struct llext_symtable *sym_table);
+void llext_symtable_hash_free(struct llext *ext, struct llext_symtable *sym_table);
+#endif
+
 /*
  * ELF parsing (llext_load.c)
  */
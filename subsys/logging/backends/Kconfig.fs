@@ -66,4 +66,26 @@ config LOG_BACKEND_FS_FILES_LIMIT
 	  Limit of number of files with logs. It is also limited by
 	  size of file system partition.
 
+config LOG_BACKEND_FS_BLOCKS
+	bool "Write dictionary logs in blocks"
+	depends on LOG_BACKEND_FS_OUTPUT_DICTIONARY
+	help
+	  When enabled, dictionary log records are packed into blocks of
+	  LOG_BACKEND_FS_BLOCK_SIZE bytes in RAM and each block is written to
+	  the log file with a single aligned write, instead of several small
+	  writes per message. A block not yet full is also written out when
+	  the logging thread becomes idle, and rewritten in place once more
+	  records are added, so that the file can be decoded while it grows
+	  using scripts/logging/dictionary/log_parser_fs.py.
+
+config LOG_BACKEND_FS_BLOCK_SIZE
+	int "Log block size"
+	depends on LOG_BACKEND_FS_BLOCKS
+	default 512
+	range 64 32768
+	help
+	  Size of a log block in bytes, including its 12 bytes header. It is
+	  best set to a multiple of the program unit of the underlying storage
+	  and to a divisor of LOG_BACKEND_FS_FILE_SIZE.
+
 endif # LOG_BACKEND_FS
@@ -33,6 +33,46 @@ static int del_oldest_log(void);
 static int get_log_file_id(struct fs_dirent *ent);
 static uint32_t log_format_current = CONFIG_LOG_BACKEND_FS_OUTPUT_DEFAULT;
 
+#ifdef CONFIG_LOG_BACKEND_FS_BLOCKS
+/* Dictionary records are packed into blocks of CONFIG_LOG_BACKEND_FS_BLOCK_SIZE
+ * bytes, written at block aligned file offsets. Records may span blocks, the
+ * header tells where the first record starting in the block is, so that a
+ * reader can start decoding at any block.
+ *
+ * Keep in sync with scripts/logging/dictionary/log_parser_fs.py.
+ */
+#define BLOCK_MAGIC 0x4b424c5aU /* "ZLBK" */
+#define BLOCK_NO_RECORD 0xffffU
+
+struct log_fs_block_hdr {
+	uint32_t magic;
+	/* Incremented for each block written since boot */
+	uint32_t seq;
+	/* Number of payload bytes in use */
+	uint16_t used;
+	/* Payload offset of the first record starting in the block */
+	uint16_t first;
+} __packed;
+
+#define BLOCK_PAYLOAD_SIZE \
+	(CONFIG_LOG_BACKEND_FS_BLOCK_SIZE - sizeof(struct log_fs_block_hdr))
+
+static struct {
+	struct log_fs_block_hdr hdr;
+	uint8_t payload[BLOCK_PAYLOAD_SIZE];
+} __packed __aligned(4) block;
+
+BUILD_ASSERT(sizeof(block) == CONFIG_LOG_BACKEND_FS_BLOCK_SIZE);
+BUILD_ASSERT(CONFIG_LOG_BACKEND_FS_FILE_SIZE >= CONFIG_LOG_BACKEND_FS_BLOCK_SIZE,
+	     "Log file can't hold a single block");
+
+/* File offset of the current block once (partially) written, -1 before */
+static off_t block_off = -1;
+static uint32_t block_seq;
+static bool block_dirty;
+static bool record_start;
+#endif /* CONFIG_LOG_BACKEND_FS_BLOCKS */
+
 static int check_log_volume_available(void)
 {
 	int index = 0;
@@ -136,14 +176,13 @@ static int check_log_file_exist(int num)
 	return rc;
 }
 
-int write_log_to_file(uint8_t *data, size_t length, void *ctx)
+static bool log_file_ready(void)
 {
 	int rc;
-	struct fs_file_t *f = &fs_file;
 
 	if (backend_state == BACKEND_FS_NOT_INITIALIZED) {
 		if (check_log_volume_available()) {
-			return length;
+			return false;
 		}
 		rc = create_log_dir(CONFIG_LOG_BACKEND_FS_DIR);
 		if (!rc) {
@@ -152,7 +191,15 @@ int write_log_to_file(uint8_t *data, size_t length, void *ctx)
 		backend_state = (rc ? BACKEND_FS_CORRUPTED : BACKEND_FS_OK);
 	}
 
-	if (backend_state == BACKEND_FS_OK) {
+	return backend_state == BACKEND_FS_OK;
+}
+
+int write_log_to_file(uint8_t *data, size_t length, void *ctx)
+{
+	int rc;
+	struct fs_file_t *f = &fs_file;
+
+	if (log_file_ready()) {
 
 		/* Check if new data overwrites max file size.
 		 * If so, create new log file.
@@ -209,6 +256,128 @@ on_error:
 	return length;
 }
 
+#ifdef CONFIG_LOG_BACKEND_FS_BLOCKS
+static void block_reset(void)
+{
+	block.hdr.magic = BLOCK_MAGIC;
+	block.hdr.seq = block_seq++;
+	block.hdr.used = 0U;
+	block.hdr.first = BLOCK_NO_RECORD;
+	memset(block.payload, 0xff, sizeof(block.payload));
+	block_off = -1;
+	block_dirty = false;
+}
+
+/* Write the current block, in place if it was already partially written. */
+static int block_write(void)
+{
+	struct fs_file_t *f = &fs_file;
+	off_t size;
+	int rc;
+
+	if (!log_file_ready()) {
+		return -EIO;
+	}
+
+	if (block_off < 0) {
+		size = fs_tell(f);
+		if (size < 0) {
+			backend_state = BACKEND_FS_CORRUPTED;
+			return size;
+		}
+
+		/* Blocks stay aligned, a file not ending on a block boundary
+		 * (e.g. holding text logs) is not appended to.
+		 */
+		if (((size % CONFIG_LOG_BACKEND_FS_BLOCK_SIZE) != 0) ||
+		    ((size + CONFIG_LOG_BACKEND_FS_BLOCK_SIZE) > CONFIG_LOG_BACKEND_FS_FILE_SIZE)) {
+			rc = allocate_new_file(f);
+			if (rc < 0) {
+				backend_state = BACKEND_FS_CORRUPTED;
+				return rc;
+			}
+			size = 0;
+		}
+		block_off = size;
+	} else {
+		rc = fs_seek(f, block_off, FS_SEEK_SET);
+		if (rc < 0) {
+			backend_state = BACKEND_FS_CORRUPTED;
+			return rc;
+		}
+	}
+
+	rc = fs_write(f, &block, sizeof(block));
+	if (rc == sizeof(block)) {
+		block_dirty = false;
+		return 0;
+	}
+
+	if (rc >= 0) {
+		/* Out of space, the block is rewritten at the same offset
+		 * next time.
+		 */
+		if (IS_ENABLED(CONFIG_LOG_BACKEND_FS_OVERWRITE)) {
+			(void)del_oldest_log();
+		}
+		return -ENOSPC;
+	}
+
+	rc = check_log_file_exist(newest);
+	if (rc == 0) {
+		/* file was lost somehow, try to get a new one */
+		file_ctr--;
+		block_off = -1;
+		rc = allocate_new_file(f);
+	}
+
+	if (rc < 0) {
+		/* fs is corrupted */
+		backend_state = BACKEND_FS_CORRUPTED;
+		return rc;
+	}
+
+	return -EIO;
+}
+
+/* Output function packing dictionary records into blocks. */
+int write_log_block(uint8_t *data, size_t length, void *ctx)
+{
+	size_t done = 0;
+
+	ARG_UNUSED(ctx);
+
+	if (block.hdr.magic != BLOCK_MAGIC) {
+		block_reset();
+	}
+
+	while (done < length) {
+		size_t len;
+
+		if (block.hdr.used == BLOCK_PAYLOAD_SIZE) {
+			/* Data is dropped along with the block if writing fails */
+			(void)block_write();
+			block_reset();
+		}
+
+		if (record_start) {
+			if (block.hdr.first == BLOCK_NO_RECORD) {
+				block.hdr.first = block.hdr.used;
+			}
+			record_start = false;
+		}
+
+		len = MIN(length - done, BLOCK_PAYLOAD_SIZE - block.hdr.used);
+		memcpy(&block.payload[block.hdr.used], &data[done], len);
+		block.hdr.used += len;
+		done += len;
+		block_dirty = true;
+	}
+
+	return length;
+}
+#endif /* CONFIG_LOG_BACKEND_FS_BLOCKS */
+
 static int get_log_file_id(struct fs_dirent *ent)
 {
 	size_t len;
@@ -326,7 +495,20 @@ static int allocate_new_file(struct fs_file_t *file)
 
 		/* Is there space left in the newest file? */
 		get_log_path(fname, sizeof(fname), curr_file_num);
-		rc = fs_open(file, fname, FS_O_CREATE | FS_O_WRITE | FS_O_APPEND);
+		if (IS_ENABLED(CONFIG_LOG_BACKEND_FS_BLOCKS)) {
+			/* Partial blocks are rewritten in place, which appending
+			 * would not allow.
+			 */
+			rc = fs_open(file, fname, FS_O_CREATE | FS_O_WRITE);
+			if (rc == 0) {
+				rc = fs_seek(file, 0, FS_SEEK_END);
+				if (rc < 0) {
+					(void)fs_close(file);
+				}
+			}
+		} else {
+			rc = fs_open(file, fname, FS_O_CREATE | FS_O_WRITE | FS_O_APPEND);
+		}
 		if (rc < 0) {
 			goto out;
 		}
@@ -430,7 +612,9 @@ BUILD_ASSERT(!IS_ENABLED(CONFIG_LOG_MODE_IMMEDIATE),
 	     "Immediate logging is not supported by LOG FS backend.");
 
 static uint8_t __aligned(4) buf[MAX_FLASH_WRITE_SIZE];
-LOG_OUTPUT_DEFINE(log_output, write_log_to_file, buf, MAX_FLASH_WRITE_SIZE);
+LOG_OUTPUT_DEFINE(log_output,
+		  COND_CODE_1(CONFIG_LOG_BACKEND_FS_BLOCKS, (write_log_block), (write_log_to_file)),
+		  buf, MAX_FLASH_WRITE_SIZE);
 
 static void log_backend_fs_init(const struct log_backend *const backend)
 {
@@ -448,6 +632,10 @@ static void dropped(const struct log_backend *const backend, uint32_t cnt)
 {
 	ARG_UNUSED(backend);
 
+#ifdef CONFIG_LOG_BACKEND_FS_BLOCKS
+	record_start = true;
+#endif
+
 	if (IS_ENABLED(CONFIG_LOG_BACKEND_FS_OUTPUT_DICTIONARY)) {
 		log_dict_output_dropped_process(&log_output, cnt);
 	} else {
@@ -462,11 +650,20 @@ static void process(const struct log_backend *const backend,
 
 	log_format_func_t log_output_func = log_format_func_t_get(log_format_current);
 
+#ifdef CONFIG_LOG_BACKEND_FS_BLOCKS
+	record_start = true;
+#endif
+
 	log_output_func(&log_output, &msg->log, flags);
 }
 
 static int format_set(const struct log_backend *const backend, uint32_t log_type)
 {
+	/* Blocks only hold dictionary records */
+	if (IS_ENABLED(CONFIG_LOG_BACKEND_FS_BLOCKS) && (log_type != LOG_OUTPUT_DICT)) {
+		return -ENOTSUP;
+	}
+
 	log_format_current = log_type;
 	return 0;
 }
@@ -474,7 +671,15 @@ static int format_set(const struct log_backend *const backend, uint32_t log_type
 static void notify(const struct log_backend *const backend, enum log_backend_evt event,
 		   union log_backend_evt_arg *arg)
 {
+	log_backend_std_notify(&log_output, event);
+
 	if (event == LOG_BACKEND_EVT_PROCESS_THREAD_DONE) {
+#ifdef CONFIG_LOG_BACKEND_FS_BLOCKS
+		/* Make pending records visible to readers of the file */
+		if (block_dirty) {
+			(void)block_write();
+		}
+#endif
 		if (backend_state == BACKEND_FS_OK) {
 			int rc = fs_sync(&fs_file);
 
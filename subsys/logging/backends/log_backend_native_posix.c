@@ -45,7 +45,7 @@ static void preprint_char(int c)
 	}
 }
 
-static uint8_t buf[_STDOUT_BUF_SIZE];
+static uint8_t buf[COND_CODE_1(CONFIG_LOG_PROCESS_BATCH, (4096), (_STDOUT_BUF_SIZE))];
 
 static int char_out(uint8_t *data, size_t length, void *ctx)
 {
@@ -86,11 +86,21 @@ static int format_set(const struct log_backend *const backend, uint32_t log_type
 	return 0;
 }
 
+static void notify(const struct log_backend *const backend, enum log_backend_evt event,
+		   union log_backend_evt_arg *arg)
+{
+	ARG_UNUSED(backend);
+	ARG_UNUSED(arg);
+
+	log_backend_std_notify(&log_output_posix, event);
+}
+
 const struct log_backend_api log_backend_native_posix_api = {
 	.process = process,
 	.panic = panic,
 	.dropped = IS_ENABLED(CONFIG_LOG_MODE_IMMEDIATE) ? NULL : dropped,
 	.format_set = format_set,
+	.notify = IS_ENABLED(CONFIG_LOG_PROCESS_BATCH) ? notify : NULL,
 };
 
 LOG_BACKEND_DEFINE(log_backend_native_posix,
@@ -12,6 +12,7 @@ LOG_MODULE_REGISTER(log_backend_net, CONFIG_LOG_DEFAULT_LEVEL);
 #include <zephyr/logging/log_core.h>
 #include <zephyr/logging/log_output.h>
 #include <zephyr/logging/log_backend_net.h>
+#include <zephyr/logging/log_backend_std.h>
 #include <zephyr/net/hostname.h>
 #include <zephyr/net/net_if.h>
 #include <zephyr/net/socket.h>
@@ -86,7 +87,44 @@ fail:
 	return length;
 }
 
-LOG_OUTPUT_DEFINE(log_output_net, line_out, output_buf, sizeof(output_buf));
+#ifdef CONFIG_LOG_PROCESS_BATCH
+/* Send a batch of formatted messages. Each message stays a separate syslog
+ * message: a datagram of its own over UDP, an octet counted frame over TCP.
+ */
+static void lines_out(const struct log_output_iovec *iov, size_t iovcnt, void *output_ctx)
+{
+	struct log_backend_net_ctx *ctx = (struct log_backend_net_ctx *)output_ctx;
+
+	if ((ctx == NULL) || !ctx->is_tcp || !IS_ENABLED(CONFIG_NET_TCP)) {
+		for (size_t i = 0; i < iovcnt; i++) {
+			(void)line_out(iov[i].buf, iov[i].len, output_ctx);
+		}
+		return;
+	}
+
+	/* Octet counting prefixes of the whole batch go out in one call */
+	char len[CONFIG_LOG_PROCESS_BATCH_SIZE + 1][sizeof("123456789")];
+	struct iovec io_vector[2 * (CONFIG_LOG_PROCESS_BATCH_SIZE + 1)];
+	struct msghdr msg = { 0 };
+
+	__ASSERT_NO_MSG(iovcnt <= ARRAY_SIZE(len));
+
+	for (size_t i = 0; i < iovcnt; i++) {
+		(void)snprintk(len[i], sizeof(len[i]), "%zu ", iov[i].len);
+		io_vector[2 * i].iov_base = (void *)len[i];
+		io_vector[2 * i].iov_len = strlen(len[i]);
+		io_vector[2 * i + 1].iov_base = (void *)iov[i].buf;
+		io_vector[2 * i + 1].iov_len = iov[i].len;
+	}
+
+	msg.msg_iov = io_vector;
+	msg.msg_iovlen = 2 * iovcnt;
+
+	(void)zsock_sendmsg(ctx->sock, &msg, 0);
+}
+#endif
+
+LOG_OUTPUT_VEC_DEFINE(log_output_net, line_out, lines_out, output_buf, sizeof(output_buf));
 
 static int do_net_init(struct log_backend_net_ctx *ctx)
 {
@@ -337,11 +375,21 @@ static void panic(struct log_backend const *const backend)
 	panic_mode = true;
 }
 
+static void notify(const struct log_backend *const backend, enum log_backend_evt event,
+		   union log_backend_evt_arg *arg)
+{
+	ARG_UNUSED(backend);
+	ARG_UNUSED(arg);
+
+	log_backend_std_notify(&log_output_net, event);
+}
+
 const struct log_backend_api log_backend_net_api = {
 	.panic = panic,
 	.init = init_net,
 	.process = process,
 	.format_set = format_set,
+	.notify = IS_ENABLED(CONFIG_LOG_PROCESS_BATCH) ? notify : NULL,
 };
 
 /* Note that the backend can be activated only after we have networking
@@ -217,12 +217,23 @@ static void dropped(const struct log_backend *const backend, uint32_t cnt)
 	}
 }
 
+static void notify(const struct log_backend *const backend, enum log_backend_evt event,
+		   union log_backend_evt_arg *arg)
+{
+	const struct lbu_cb_ctx *ctx = backend->cb->ctx;
+
+	ARG_UNUSED(arg);
+
+	log_backend_std_notify(ctx->output, event);
+}
+
 const struct log_backend_api log_backend_uart_api = {
 	.process = process,
 	.panic = panic,
 	.init = log_backend_uart_init,
 	.dropped = IS_ENABLED(CONFIG_LOG_MODE_IMMEDIATE) ? NULL : dropped,
 	.format_set = format_set,
+	.notify = IS_ENABLED(CONFIG_LOG_PROCESS_BATCH) ? notify : NULL,
 };
 
 #define LBU_DEFINE(node_id, ...)                                                                   \
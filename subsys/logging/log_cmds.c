@@ -418,6 +418,15 @@ static int cmd_log_mem(const struct shell *sh, size_t argc, char **argv)
 	shell_print(sh, "\tCapacity: %u bytes", size);
 	shell_print(sh, "\tCurrently in use: %u bytes", used);
 
+	for (unsigned int i = 0; IS_ENABLED(CONFIG_LOG_BUFFER_PER_CPU) && (i < arch_num_cpus());
+	     i++) {
+		uint32_t dropped;
+
+		if (log_mem_get_cpu_dropped(i, &dropped) == 0) {
+			shell_print(sh, "\tDropped on CPU %u: %u messages", i, dropped);
+		}
+	}
+
 	err = log_mem_get_max_usage(&max);
 	if (err < 0) {
 		shell_print(sh, "Enable CONFIG_LOG_MEM_UTILIZATION to get maximum usage");
@@ -132,10 +132,29 @@ static uint32_t __aligned(Z_LOG_MSG_ALIGNMENT)
 static void z_log_notify_drop(const struct mpsc_pbuf_buffer *buffer,
 			      const union mpsc_pbuf_generic *item);
 
+#ifdef CONFIG_LOG_BUFFER_PER_CPU
+/* CPU 0 uses log_buffer, other CPUs have a buffer of their own so that
+ * producers running on different CPUs never contend on a buffer lock.
+ */
+#define LOG_CPU_BUFFERS (CONFIG_MP_MAX_NUM_CPUS - 1)
+
+static uint32_t __aligned(Z_LOG_MSG_ALIGNMENT)
+	cpu_buf32[LOG_CPU_BUFFERS][CONFIG_LOG_BUFFER_SIZE / sizeof(int)];
+static struct mpsc_pbuf_buffer cpu_log_buffer[LOG_CPU_BUFFERS];
+
+/* Message claimed from each CPU buffer, waiting to be the oldest one. */
+static union log_msg_generic *cpu_msg[CONFIG_MP_MAX_NUM_CPUS];
+static atomic_t cpu_dropped_cnt[CONFIG_MP_MAX_NUM_CPUS];
+
+static void cpu_notify_drop(const struct mpsc_pbuf_buffer *buffer,
+			    const union mpsc_pbuf_generic *item);
+#endif
+
 static const struct mpsc_pbuf_buffer_config mpsc_config = {
 	.buf = (uint32_t *)buf32,
 	.size = ARRAY_SIZE(buf32),
-	.notify_drop = z_log_notify_drop,
+	.notify_drop = COND_CODE_1(CONFIG_LOG_BUFFER_PER_CPU,
+				   (cpu_notify_drop), (z_log_notify_drop)),
 	.get_wlen = log_msg_generic_get_wlen,
 	.flags = (IS_ENABLED(CONFIG_LOG_MODE_OVERFLOW) ?
 		  MPSC_PBUF_MODE_OVERWRITE : 0) |
@@ -153,6 +172,11 @@ static char tag[CONFIG_LOG_TAG_MAX_LEN + 1] =
 	COND_CODE_0(CONFIG_LOG_TAG_MAX_LEN, ({}), (CONFIG_LOG_TAG_DEFAULT));
 
 static void msg_process(union log_msg_generic *msg);
+static void log_backend_notify_all(enum log_backend_evt event,
+				   union log_backend_evt_arg *arg);
+
+#define LOG_PROCESS_BATCH_SIZE \
+	COND_CODE_1(CONFIG_LOG_PROCESS_BATCH, (CONFIG_LOG_PROCESS_BATCH_SIZE), (1))
 
 static log_timestamp_t dummy_timestamp(void)
 {
@@ -570,9 +594,23 @@ bool z_impl_log_process(void)
 	msg = z_log_msg_claim(&backoff);
 
 	if (msg) {
-		msg_process(msg);
-		z_log_msg_free(msg);
-		atomic_dec(&buffered_cnt);
+		uint32_t cnt = 0;
+
+		if (IS_ENABLED(CONFIG_LOG_PROCESS_BATCH)) {
+			log_backend_notify_all(LOG_BACKEND_EVT_BATCH_START, NULL);
+		}
+
+		do {
+			msg_process(msg);
+			z_log_msg_free(msg);
+			atomic_dec(&buffered_cnt);
+			cnt++;
+		} while ((cnt < LOG_PROCESS_BATCH_SIZE) &&
+			 ((msg = z_log_msg_claim(&backoff)) != NULL));
+
+		if (IS_ENABLED(CONFIG_LOG_PROCESS_BATCH)) {
+			log_backend_notify_all(LOG_BACKEND_EVT_BATCH_END, NULL);
+		}
 	} else if (CONFIG_LOG_PROCESSING_LATENCY_US > 0 && !K_TIMEOUT_EQ(backoff, K_NO_WAIT)) {
 		/* If backoff is requested, it means that there are pending
 		 * messages but they are too new and processing shall back off
@@ -648,12 +686,104 @@ bool z_log_dropped_pending(void)
 	return dropped_cnt > 0;
 }
 
+#ifdef CONFIG_LOG_BUFFER_PER_CPU
+static struct mpsc_pbuf_buffer *cpu_buffer(unsigned int cpu)
+{
+	return (cpu == 0U) ? &log_buffer : &cpu_log_buffer[cpu - 1U];
+}
+
+static unsigned int buffer_cpu(const struct mpsc_pbuf_buffer *buffer)
+{
+	return (buffer == &log_buffer) ? 0U : (unsigned int)(buffer - cpu_log_buffer) + 1U;
+}
+
+/* Buffer the message was allocated from. The creating thread may have
+ * migrated to another CPU since then.
+ */
+static struct mpsc_pbuf_buffer *msg_buffer(const void *msg)
+{
+	uintptr_t offset = (uintptr_t)msg - (uintptr_t)cpu_buf32;
+
+	if (offset < sizeof(cpu_buf32)) {
+		return &cpu_log_buffer[offset / sizeof(cpu_buf32[0])];
+	}
+
+	return &log_buffer;
+}
+
+static void cpu_notify_drop(const struct mpsc_pbuf_buffer *buffer,
+			    const union mpsc_pbuf_generic *item)
+{
+	atomic_inc(&cpu_dropped_cnt[buffer_cpu(buffer)]);
+	z_log_notify_drop(buffer, item);
+}
+
+static void cpu_buffers_init(void)
+{
+	struct mpsc_pbuf_buffer_config config = mpsc_config;
+
+	for (unsigned int i = 0; i < LOG_CPU_BUFFERS; i++) {
+		config.buf = cpu_buf32[i];
+		config.size = ARRAY_SIZE(cpu_buf32[i]);
+		mpsc_pbuf_init(&cpu_log_buffer[i], &config);
+	}
+
+	for (unsigned int i = 0; i < CONFIG_MP_MAX_NUM_CPUS; i++) {
+		cpu_msg[i] = NULL;
+		atomic_clear(&cpu_dropped_cnt[i]);
+	}
+}
+
+/* Claim the oldest message out of all CPU buffers. */
+static union log_msg_generic *cpu_msg_claim_oldest(void)
+{
+	union log_msg_generic *msg = NULL;
+	log_timestamp_t t_min = 0;
+	unsigned int chosen = 0;
+
+	for (unsigned int i = 0; i < arch_num_cpus(); i++) {
+		if (cpu_msg[i] == NULL) {
+			cpu_msg[i] = (union log_msg_generic *)mpsc_pbuf_claim(cpu_buffer(i));
+			if (cpu_msg[i] == NULL) {
+				continue;
+			}
+		}
+
+		log_timestamp_t t = log_msg_get_timestamp(&cpu_msg[i]->log);
+
+		if ((msg == NULL) || (t < t_min)) {
+			t_min = t;
+			msg = cpu_msg[i];
+			chosen = i;
+		}
+	}
+
+	if (msg == NULL) {
+		return NULL;
+	}
+
+	cpu_msg[chosen] = NULL;
+	curr_log_buffer = cpu_buffer(chosen);
+
+	if (t_min < prev_timestamp) {
+		atomic_inc(&unordered_cnt);
+	}
+
+	prev_timestamp = t_min;
+
+	return msg;
+}
+#endif /* CONFIG_LOG_BUFFER_PER_CPU */
+
 void z_log_msg_init(void)
 {
 #ifdef CONFIG_MPSC_PBUF
 	mpsc_pbuf_init(&log_buffer, &mpsc_config);
 	curr_log_buffer = &log_buffer;
 #endif
+#ifdef CONFIG_LOG_BUFFER_PER_CPU
+	cpu_buffers_init();
+#endif
 }
 
 static struct log_msg *msg_alloc(struct mpsc_pbuf_buffer *buffer, uint32_t wlen)
@@ -671,7 +801,21 @@ static struct log_msg *msg_alloc(struct mpsc_pbuf_buffer *buffer, uint32_t wlen)
 
 struct log_msg *z_log_msg_alloc(uint32_t wlen)
 {
+#ifdef CONFIG_LOG_BUFFER_PER_CPU
+	/* The CPU may change right after reading it, which is harmless as
+	 * the message is committed to the buffer it was allocated from.
+	 */
+	unsigned int cpu = arch_curr_cpu()->id;
+	struct log_msg *msg = msg_alloc(cpu_buffer(cpu), wlen);
+
+	if (msg == NULL) {
+		atomic_inc(&cpu_dropped_cnt[cpu]);
+	}
+
+	return msg;
+#else
 	return msg_alloc(&log_buffer, wlen);
+#endif
 }
 
 static void msg_commit(struct mpsc_pbuf_buffer *buffer, struct log_msg *msg)
@@ -703,7 +847,7 @@ static void msg_commit(struct mpsc_pbuf_buffer *buffer, struct log_msg *msg)
 void z_log_msg_commit(struct log_msg *msg)
 {
 	msg->hdr.timestamp = timestamp_func();
-	msg_commit(&log_buffer, msg);
+	msg_commit(COND_CODE_1(CONFIG_LOG_BUFFER_PER_CPU, (msg_buffer(msg)), (&log_buffer)), msg);
 }
 
 union log_msg_generic *z_log_msg_local_claim(void)
@@ -785,6 +929,11 @@ union log_msg_generic *z_log_msg_claim_oldest(k_timeout_t *backoff)
 
 union log_msg_generic *z_log_msg_claim(k_timeout_t *backoff)
 {
+#ifdef CONFIG_LOG_BUFFER_PER_CPU
+	ARG_UNUSED(backoff);
+
+	return cpu_msg_claim_oldest();
+#else
 	size_t len;
 
 	STRUCT_SECTION_COUNT(log_mpsc_pbuf, &len);
@@ -795,6 +944,7 @@ union log_msg_generic *z_log_msg_claim(k_timeout_t *backoff)
 	}
 
 	return z_log_msg_local_claim();
+#endif /* CONFIG_LOG_BUFFER_PER_CPU */
 }
 
 static void msg_free(struct mpsc_pbuf_buffer *buffer, const union log_msg_generic *msg)
@@ -820,6 +970,15 @@ static bool msg_pending(struct mpsc_pbuf_buffer *buffer)
 
 bool z_log_msg_pending(void)
 {
+#ifdef CONFIG_LOG_BUFFER_PER_CPU
+	for (unsigned int cpu = 0; cpu < arch_num_cpus(); cpu++) {
+		if ((cpu_msg[cpu] != NULL) || msg_pending(cpu_buffer(cpu))) {
+			return true;
+		}
+	}
+
+	return false;
+#else
 	size_t len;
 	int i = 0;
 
@@ -846,6 +1005,7 @@ bool z_log_msg_pending(void)
 	}
 
 	return false;
+#endif /* CONFIG_LOG_BUFFER_PER_CPU */
 }
 
 void z_log_msg_enqueue(const struct log_link *link, const void *data, size_t len)
@@ -907,6 +1067,17 @@ int log_mem_get_usage(uint32_t *buf_size, uint32_t *usage)
 
 	mpsc_pbuf_get_utilization(&log_buffer, buf_size, usage);
 
+#ifdef CONFIG_LOG_BUFFER_PER_CPU
+	for (unsigned int i = 0; i < LOG_CPU_BUFFERS; i++) {
+		uint32_t size;
+		uint32_t used;
+
+		mpsc_pbuf_get_utilization(&cpu_log_buffer[i], &size, &used);
+		*buf_size += size;
+		*usage += used;
+	}
+#endif
+
 	return 0;
 }
 
@@ -918,7 +1089,39 @@ int log_mem_get_max_usage(uint32_t *max)
 		return -EINVAL;
 	}
 
+#ifdef CONFIG_LOG_BUFFER_PER_CPU
+	int err = mpsc_pbuf_get_max_utilization(&log_buffer, max);
+
+	for (unsigned int i = 0; (err == 0) && (i < LOG_CPU_BUFFERS); i++) {
+		uint32_t cpu_max;
+
+		err = mpsc_pbuf_get_max_utilization(&cpu_log_buffer[i], &cpu_max);
+		*max += cpu_max;
+	}
+
+	return err;
+#else
 	return mpsc_pbuf_get_max_utilization(&log_buffer, max);
+#endif
+}
+
+int log_mem_get_cpu_dropped(unsigned int cpu, uint32_t *cnt)
+{
+	__ASSERT_NO_MSG(cnt != NULL);
+
+#ifdef CONFIG_LOG_BUFFER_PER_CPU
+	if (cpu >= arch_num_cpus()) {
+		return -EINVAL;
+	}
+
+	*cnt = (uint32_t)atomic_get(&cpu_dropped_cnt[cpu]);
+
+	return 0;
+#else
+	ARG_UNUSED(cpu);
+
+	return -ENOTSUP;
+#endif
 }
 
 static void log_backend_notify_all(enum log_backend_evt event,
@@ -116,6 +116,73 @@ static int out_func(int c, void *ctx)
 	return 0;
 }
 
+#ifdef CONFIG_LOG_PROCESS_BATCH
+/* A batch is written out early once less than this part of the buffer is
+ * left, so that the next message likely fits in one piece.
+ */
+#define BATCH_FLUSH_ROOM_DIV 4
+
+void z_log_output_batch_flush(const struct log_output *output)
+{
+	struct log_output_control_block *cb = output->control_block;
+	size_t offset = (size_t)atomic_get(&cb->offset);
+	struct log_output_iovec iov[CONFIG_LOG_PROCESS_BATCH_SIZE + 1];
+	size_t iovcnt = 0;
+	size_t start = 0;
+
+	if (output->vfunc == NULL) {
+		log_output_write(output->func, output->buf, offset, cb->ctx);
+	} else {
+		for (size_t i = 0; i < cb->msg_cnt; i++) {
+			iov[iovcnt].buf = &output->buf[start];
+			iov[iovcnt].len = cb->msg_end[i] - start;
+			start = cb->msg_end[i];
+			iovcnt++;
+		}
+
+		/* Beginning of a message that did not fit */
+		if (offset > start) {
+			iov[iovcnt].buf = &output->buf[start];
+			iov[iovcnt].len = offset - start;
+			iovcnt++;
+		}
+
+		output->vfunc(iov, iovcnt, cb->ctx);
+	}
+
+	cb->msg_cnt = 0;
+	atomic_set(&cb->offset, 0);
+}
+#endif /* CONFIG_LOG_PROCESS_BATCH */
+
+/* Complete a formatted message. Outside of a batch it is written out
+ * right away, otherwise only when the buffer gets full.
+ */
+static void msg_end(const struct log_output *output)
+{
+#ifdef CONFIG_LOG_PROCESS_BATCH
+	struct log_output_control_block *cb = output->control_block;
+
+	if (cb->batch && !IS_ENABLED(CONFIG_LOG_MODE_IMMEDIATE)) {
+		size_t offset = (size_t)atomic_get(&cb->offset);
+		size_t start = (cb->msg_cnt != 0) ? cb->msg_end[cb->msg_cnt - 1] : 0;
+
+		if (offset == start) {
+			/* Nothing was formatted */
+			return;
+		}
+
+		cb->msg_end[cb->msg_cnt++] = offset;
+		if ((cb->msg_cnt < ARRAY_SIZE(cb->msg_end)) &&
+		    ((output->size - offset) > (output->size / BATCH_FLUSH_ROOM_DIV))) {
+			return;
+		}
+	}
+#endif
+
+	log_output_flush(output);
+}
+
 static int cr_out_func(int c, void *ctx)
 {
 	if (c == '\n') {
@@ -680,7 +747,7 @@ void log_output_process(const struct log_output *output,
 		postfix_print(output, flags, level);
 	}
 
-	log_output_flush(output);
+	msg_end(output);
 }
 
 void log_output_msg_process(const struct log_output *output,
@@ -709,6 +776,9 @@ void log_output_dropped_process(const struct log_output *output, uint32_t cnt)
 			" messages dropped ---\r\n" DROPPED_COLOR_POSTFIX;
 	log_output_func_t outf = output->func;
 
+	/* Keep the report after messages of the current batch */
+	log_output_flush(output);
+
 	cnt = MIN(cnt, 9999);
 	len = snprintk(buf, sizeof(buf), "%d", cnt);
 
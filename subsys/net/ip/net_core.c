@@ -671,6 +671,7 @@ static inline int services_init(void)
 	int status;
 
 	socket_service_init();
+	socket_rtio_init();
 
 	status = net_dhcpv4_init();
 	if (status) {
@@ -89,6 +89,12 @@ extern void socket_service_init(void);
 static inline void socket_service_init(void) { }
 #endif
 
+#if defined(CONFIG_NET_SOCKETS_RTIO)
+extern void socket_rtio_init(void);
+#else
+static inline void socket_rtio_init(void) { }
+#endif
+
 #if defined(CONFIG_NET_NATIVE) || defined(CONFIG_NET_OFFLOAD)
 extern void net_context_init(void);
 extern const char *net_context_state(struct net_context *context);
@@ -0,0 +1,302 @@
+/*
+ * Copyright (c) 2025 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_REGISTER(net_sock_rtio, CONFIG_NET_SOCKETS_LOG_LEVEL);
+
+#include <zephyr/kernel.h>
+#include <zephyr/net/socket_rtio.h>
+#include <zephyr/sys/mpsc_lockfree.h>
+#include <zephyr/zvfs/eventfd.h>
+
+BUILD_ASSERT(CONFIG_NET_SOCKETS_RTIO_MAX_PENDING < CONFIG_ZVFS_POLL_MAX,
+	     "CONFIG_ZVFS_POLL_MAX must be larger than CONFIG_NET_SOCKETS_RTIO_MAX_PENDING");
+
+/* Submissions not yet seen by the poller thread */
+static struct mpsc submit_q = MPSC_INIT(submit_q);
+
+/* Event fd waking up the poller thread, -1 until the thread has started */
+static int wake_fd = -1;
+
+/* Operations waiting for their socket to become ready, owned by the poller
+ * thread. The first poll entry is the event fd.
+ */
+static struct {
+	struct zsock_pollfd events[CONFIG_NET_SOCKETS_RTIO_MAX_PENDING + 1];
+	struct rtio_iodev_sqe *ops[CONFIG_NET_SOCKETS_RTIO_MAX_PENDING + 1];
+	int count;
+} ctx;
+
+static void socket_rtio_wake(void)
+{
+	int fd = wake_fd;
+
+	if (fd >= 0) {
+		(void)zvfs_eventfd_write(fd, 1);
+	}
+}
+
+static void socket_rtio_submit(struct rtio_iodev_sqe *iodev_sqe)
+{
+	mpsc_push(&submit_q, &iodev_sqe->q);
+	socket_rtio_wake();
+}
+
+const struct rtio_iodev_api net_socket_rtio_api = {
+	.submit = socket_rtio_submit,
+};
+
+int net_socket_rtio_cancel(struct rtio_sqe *sqe)
+{
+	int ret;
+
+	ret = rtio_sqe_cancel(sqe);
+	if (ret == 0) {
+		/* Have the poller drop the operation now rather than on the
+		 * next socket event
+		 */
+		socket_rtio_wake();
+	}
+
+	return ret;
+}
+
+static short socket_rtio_events(const struct rtio_sqe *sqe)
+{
+	switch (sqe->op) {
+	case RTIO_OP_TX:
+	case RTIO_OP_TINY_TX:
+	case RTIO_OP_SOCK_SENDMSG:
+		return ZSOCK_POLLOUT;
+	default:
+		return ZSOCK_POLLIN;
+	}
+}
+
+static ssize_t socket_rtio_recv(struct rtio_iodev_sqe *iodev_sqe, int sock, bool ready)
+{
+	struct rtio_sqe *sqe = &iodev_sqe->sqe;
+	uint8_t *buf;
+	uint32_t buf_len;
+	int avail = 0;
+	ssize_t ret;
+
+	if ((sqe->flags & RTIO_SQE_MEMPOOL_BUFFER) == 0) {
+		ret = zsock_recv(sock, sqe->rx.buf, sqe->rx.buf_len, ZSOCK_MSG_DONTWAIT);
+		return (ret < 0) ? -errno : ret;
+	}
+
+	/* Only take a buffer from the pool once there is data to put in it, so
+	 * that waiting receives do not hold any memory.
+	 */
+	(void)zsock_ioctl(sock, ZFD_IOCTL_FIONREAD, &avail);
+	if (avail <= 0 && !ready) {
+		return -EAGAIN;
+	}
+
+	ret = rtio_sqe_rx_buf(iodev_sqe, 1, MAX(avail, 1), &buf, &buf_len);
+	if (ret != 0) {
+		return ret;
+	}
+
+	ret = zsock_recv(sock, buf, buf_len, ZSOCK_MSG_DONTWAIT);
+	if (ret < 0) {
+		ret = -errno;
+	}
+
+	if (ret <= 0) {
+		/* Nothing for the consumer, give the buffer back */
+		rtio_release_buffer(iodev_sqe->r, buf, buf_len);
+		sqe->rx.buf = NULL;
+		sqe->rx.buf_len = 0;
+	}
+
+	return ret;
+}
+
+/* Run an operation without blocking, -EAGAIN if the socket is not ready */
+static ssize_t socket_rtio_run(struct rtio_iodev_sqe *iodev_sqe, bool ready)
+{
+	struct rtio_sqe *sqe = &iodev_sqe->sqe;
+	int sock = net_socket_rtio_iodev_sock(sqe->iodev);
+	ssize_t ret;
+
+	switch (sqe->op) {
+	case RTIO_OP_NOP:
+		return 0;
+	case RTIO_OP_RX:
+		return socket_rtio_recv(iodev_sqe, sock, ready);
+	case RTIO_OP_TX:
+		ret = zsock_send(sock, sqe->tx.buf, sqe->tx.buf_len, ZSOCK_MSG_DONTWAIT);
+		break;
+	case RTIO_OP_TINY_TX:
+		ret = zsock_send(sock, sqe->tiny_tx.buf, sqe->tiny_tx.buf_len,
+				 ZSOCK_MSG_DONTWAIT);
+		break;
+	case RTIO_OP_SOCK_ACCEPT:
+		/* Accept would block on a blocking socket, wait until it is ready */
+		if (!ready) {
+			return -EAGAIN;
+		}
+		ret = zsock_accept(sock, sqe->sock_accept.addr, sqe->sock_accept.addrlen);
+		break;
+	case RTIO_OP_SOCK_RECVMSG:
+		ret = zsock_recvmsg(sock, sqe->sock_msg, ZSOCK_MSG_DONTWAIT);
+		break;
+	case RTIO_OP_SOCK_SENDMSG:
+		ret = zsock_sendmsg(sock, sqe->sock_msg, ZSOCK_MSG_DONTWAIT);
+		break;
+	default:
+		return -ENOTSUP;
+	}
+
+	return (ret < 0) ? -errno : ret;
+}
+
+static void socket_rtio_complete(struct rtio_iodev_sqe *iodev_sqe, ssize_t ret)
+{
+	if (ret <= 0) {
+		/* A multishot receive ends with the connection or on error */
+		iodev_sqe->sqe.flags &= ~RTIO_SQE_MULTISHOT;
+	}
+
+	if (ret < 0) {
+		rtio_iodev_sqe_err(iodev_sqe, (int)ret);
+	} else {
+		rtio_iodev_sqe_ok(iodev_sqe, (int)ret);
+	}
+}
+
+static void socket_rtio_start(struct rtio_iodev_sqe *iodev_sqe)
+{
+	ssize_t ret;
+
+	if (iodev_sqe->sqe.flags & RTIO_SQE_TRANSACTION) {
+		NET_ERR("Transactions are not supported on sockets");
+		rtio_iodev_sqe_err(iodev_sqe, -ENOTSUP);
+		return;
+	}
+
+	ret = socket_rtio_run(iodev_sqe, false);
+	if (ret != -EAGAIN) {
+		socket_rtio_complete(iodev_sqe, ret);
+		return;
+	}
+
+	if (ctx.count == CONFIG_NET_SOCKETS_RTIO_MAX_PENDING) {
+		NET_DBG("Too many pending socket operations, max is %d",
+			CONFIG_NET_SOCKETS_RTIO_MAX_PENDING);
+		rtio_iodev_sqe_err(iodev_sqe, -ENOMEM);
+		return;
+	}
+
+	ctx.count++;
+	ctx.events[ctx.count].fd = net_socket_rtio_iodev_sock(iodev_sqe->sqe.iodev);
+	ctx.events[ctx.count].events = socket_rtio_events(&iodev_sqe->sqe);
+	ctx.events[ctx.count].revents = 0;
+	ctx.ops[ctx.count] = iodev_sqe;
+}
+
+static void socket_rtio_remove(int i)
+{
+	/* Move the last pending operation into the free slot */
+	ctx.events[i] = ctx.events[ctx.count];
+	ctx.ops[i] = ctx.ops[ctx.count];
+	ctx.count--;
+}
+
+static void socket_rtio_process(void)
+{
+	int i = 1;
+
+	while (i <= ctx.count) {
+		struct rtio_iodev_sqe *iodev_sqe = ctx.ops[i];
+		ssize_t ret;
+
+		if (iodev_sqe->sqe.flags & RTIO_SQE_CANCELED) {
+			socket_rtio_remove(i);
+			rtio_iodev_sqe_err(iodev_sqe, -ECANCELED);
+			continue;
+		}
+
+		if (ctx.events[i].revents == 0) {
+			i++;
+			continue;
+		}
+
+		ret = socket_rtio_run(iodev_sqe, true);
+		if (ret == -EAGAIN) {
+			ctx.events[i].revents = 0;
+			i++;
+			continue;
+		}
+
+		/* Removed first, completing may resubmit a multishot receive */
+		socket_rtio_remove(i);
+		socket_rtio_complete(iodev_sqe, ret);
+	}
+}
+
+static void socket_rtio_thread(void *p1, void *p2, void *p3)
+{
+	struct mpsc_node *node;
+	zvfs_eventfd_t value;
+	int fd, ret;
+
+	ARG_UNUSED(p1);
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	fd = zvfs_eventfd(0, ZVFS_EFD_NONBLOCK);
+	if (fd < 0) {
+		NET_ERR("zvfs_eventfd failed (%d)", -errno);
+		return;
+	}
+
+	ctx.events[0].fd = fd;
+	ctx.events[0].events = ZSOCK_POLLIN;
+	wake_fd = fd;
+
+	while (true) {
+		/* Submissions pushed before the event fd was set are picked up
+		 * here as well.
+		 */
+		while ((node = mpsc_pop(&submit_q)) != NULL) {
+			socket_rtio_start(CONTAINER_OF(node, struct rtio_iodev_sqe, q));
+		}
+
+		ret = zsock_poll(ctx.events, ctx.count + 1, -1);
+		if (ret < 0) {
+			NET_ERR("poll failed (%d)", -errno);
+			k_msleep(1);
+			continue;
+		}
+
+		if (ctx.events[0].revents) {
+			(void)zvfs_eventfd_read(fd, &value);
+			ctx.events[0].revents = 0;
+		}
+
+		socket_rtio_process();
+	}
+}
+
+static K_THREAD_STACK_DEFINE(socket_rtio_stack, CONFIG_NET_SOCKETS_RTIO_STACK_SIZE);
+static struct k_thread socket_rtio_thread_data;
+
+void socket_rtio_init(void)
+{
+	k_tid_t tid;
+
+	tid = k_thread_create(&socket_rtio_thread_data, socket_rtio_stack,
+			      K_THREAD_STACK_SIZEOF(socket_rtio_stack),
+			      socket_rtio_thread, NULL, NULL, NULL,
+			      CLAMP(CONFIG_NET_SOCKETS_RTIO_THREAD_PRIO,
+				    K_HIGHEST_APPLICATION_THREAD_PRIO,
+				    K_LOWEST_APPLICATION_THREAD_PRIO), 0, K_NO_WAIT);
+
+	k_thread_name_set(tid, "net_socket_rtio");
+}
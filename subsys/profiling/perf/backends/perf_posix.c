@@ -0,0 +1,56 @@
+/*
+ *  Copyright (c) 2025 The Zephyr Project Contributors
+ *
+ *  SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+
+/* Largest distance between two consecutive frames accepted while unwinding */
+#define MAX_FRAME_SIZE 0x10000U
+
+/*
+ * On the POSIX architecture interrupts are handled on the host stack of the
+ * Zephyr thread that was running when the CPU got interrupted, so the trace
+ * of the interrupted thread is reached by unwinding from this very frame.
+ * The frames of the interrupt handling path end up at the top of the trace;
+ * the host tools strip them while symbolizing.
+ *
+ * Host stacks may be deep, so unlike the other backends the trace is
+ * truncated instead of being dropped when it does not fit in @p buf.
+ */
+size_t arch_perf_current_stack_trace(uintptr_t *buf, size_t size)
+{
+	void **fp = (void **)__builtin_frame_address(0);
+	size_t idx = 0;
+
+	/*
+	 * stack frame in memory:
+	 * (addresses growth up)
+	 *  ....
+	 *  ra
+	 *  fp (next) <- fp (curr)
+	 *  ....
+	 */
+	while ((fp != NULL) && (idx < size)) {
+		void **new_fp = (void **)fp[0];
+
+		if (fp[1] == NULL) {
+			break;
+		}
+
+		buf[idx++] = (uintptr_t)fp[1];
+
+		/*
+		 * anti-infinity-loop if
+		 * new_fp can't be smaller than fp, cause the stack is growing down
+		 * and trace moves deeper into the stack
+		 */
+		if ((new_fp <= fp) || (((uintptr_t)new_fp - (uintptr_t)fp) > MAX_FRAME_SIZE)) {
+			break;
+		}
+		fp = new_fp;
+	}
+
+	return idx;
+}
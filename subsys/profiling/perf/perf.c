@@ -6,6 +6,7 @@
  */
 
 #include <zephyr/kernel.h>
+#include <zephyr/kernel/smp.h>
 #include <zephyr/init.h>
 #include <zephyr/arch/cpu.h>
 #include <zephyr/shell/shell.h>
@@ -15,6 +16,34 @@
 
 size_t arch_perf_current_stack_trace(uintptr_t *buf, size_t size);
 
+/*
+ * A sample is stored as a header word, the sampled thread and the stack
+ * trace of that thread. The header holds the trace depth, the CPU that
+ * took the sample and PERF_HDR_THREAD, which tells the host tools that
+ * the thread word is present.
+ */
+#define PERF_HDR_DEPTH_MASK 0xffffU
+#define PERF_HDR_CPU_SHIFT  16U
+#define PERF_HDR_THREAD     BIT(24)
+
+#define PERF_SAMPLE_WORDS(hdr) (((hdr) & PERF_HDR_DEPTH_MASK) + 2U)
+
+BUILD_ASSERT(CONFIG_PROFILING_PERF_STACK_DEPTH + 2 <= CONFIG_PROFILING_PERF_BUFFER_SIZE,
+	     "Perf buffer can't hold a single sample");
+
+/* Samples taken on one CPU, written only from that CPU's interrupts */
+struct perf_cpu_buf {
+	/* Index of the oldest word and number of words in use */
+	size_t tail;
+	size_t used;
+
+	/* Samples lost to deep stacks, a full buffer or overwriting */
+	uint32_t dropped;
+
+	uintptr_t trace[CONFIG_PROFILING_PERF_STACK_DEPTH];
+	uintptr_t buf[CONFIG_PROFILING_PERF_BUFFER_SIZE];
+};
+
 struct perf_data_t {
 	struct k_timer timer;
 
@@ -22,9 +51,14 @@ struct perf_data_t {
 
 	struct k_work_delayable dwork;
 
-	size_t idx;
-	uintptr_t buf[CONFIG_PROFILING_PERF_BUFFER_SIZE];
+#ifdef CONFIG_SMP
+	struct k_ipi_work ipi_work;
+#endif
+
+	bool running;
 	bool buf_full;
+
+	struct perf_cpu_buf cpus[CONFIG_MP_MAX_NUM_CPUS];
 };
 
 static void perf_tracer(struct k_timer *timer);
@@ -34,27 +68,96 @@ static struct perf_data_t perf_data = {
 	.dwork = Z_WORK_DELAYABLE_INITIALIZER(perf_dwork_handler),
 };
 
-static void perf_tracer(struct k_timer *timer)
+static inline void perf_buf_put(struct perf_cpu_buf *cpu_buf, size_t idx, uintptr_t val)
 {
-	struct perf_data_t *perf_data_ptr =
-		(struct perf_data_t *)k_timer_user_data_get(timer);
+	cpu_buf->buf[(cpu_buf->tail + idx) % CONFIG_PROFILING_PERF_BUFFER_SIZE] = val;
+}
 
-	size_t trace_length = 0;
+static inline uintptr_t perf_buf_get(const struct perf_cpu_buf *cpu_buf, size_t idx)
+{
+	return cpu_buf->buf[(cpu_buf->tail + idx) % CONFIG_PROFILING_PERF_BUFFER_SIZE];
+}
+
+/* Overwrite the oldest sample of a ring buffer */
+static void perf_buf_drop_oldest(struct perf_cpu_buf *cpu_buf)
+{
+	size_t len = PERF_SAMPLE_WORDS(perf_buf_get(cpu_buf, 0));
 
-	if (++perf_data_ptr->idx < CONFIG_PROFILING_PERF_BUFFER_SIZE) {
-		trace_length = arch_perf_current_stack_trace(
-					perf_data_ptr->buf + perf_data_ptr->idx,
-					CONFIG_PROFILING_PERF_BUFFER_SIZE - perf_data_ptr->idx);
+	cpu_buf->tail = (cpu_buf->tail + len) % CONFIG_PROFILING_PERF_BUFFER_SIZE;
+	cpu_buf->used -= len;
+	cpu_buf->dropped++;
+}
+
+/* Record the stack trace of the thread interrupted on the current CPU */
+static void perf_sample(void)
+{
+	unsigned int cpu = _current_cpu->id;
+	struct perf_cpu_buf *cpu_buf = &perf_data.cpus[cpu];
+	size_t depth;
+	size_t len;
+
+	depth = arch_perf_current_stack_trace(cpu_buf->trace, ARRAY_SIZE(cpu_buf->trace));
+	if (depth == 0) {
+		cpu_buf->dropped++;
+		return;
 	}
 
-	if (trace_length != 0) {
-		perf_data_ptr->buf[perf_data_ptr->idx - 1] = trace_length;
-		perf_data_ptr->idx += trace_length;
-	} else {
-		--perf_data_ptr->idx;
-		perf_data_ptr->buf_full = true;
-		k_work_reschedule(&perf_data_ptr->dwork, K_NO_WAIT);
+	len = depth + 2U;
+	if (cpu_buf->used + len > CONFIG_PROFILING_PERF_BUFFER_SIZE) {
+		if (!IS_ENABLED(CONFIG_PROFILING_PERF_RING)) {
+			cpu_buf->dropped++;
+			perf_data.buf_full = true;
+			k_work_reschedule(&perf_data.dwork, K_NO_WAIT);
+			return;
+		}
+
+		while (cpu_buf->used + len > CONFIG_PROFILING_PERF_BUFFER_SIZE) {
+			perf_buf_drop_oldest(cpu_buf);
+		}
+	}
+
+	perf_buf_put(cpu_buf, cpu_buf->used,
+		     depth | (cpu << PERF_HDR_CPU_SHIFT) | PERF_HDR_THREAD);
+	perf_buf_put(cpu_buf, cpu_buf->used + 1U, (uintptr_t)_current);
+	for (size_t i = 0; i < depth; i++) {
+		perf_buf_put(cpu_buf, cpu_buf->used + 2U + i, cpu_buf->trace[i]);
+	}
+	cpu_buf->used += len;
+}
+
+#ifdef CONFIG_SMP
+static void perf_ipi_sample(struct k_ipi_work *work)
+{
+	ARG_UNUSED(work);
+
+	perf_sample();
+}
+#endif
+
+static void perf_tracer(struct k_timer *timer)
+{
+	ARG_UNUSED(timer);
+
+#ifdef CONFIG_SMP
+	/* The timer only interrupts one CPU, the others sample themselves
+	 * from the IPI. A round still in flight is skipped rather than
+	 * delaying this CPU.
+	 */
+	uint32_t others = BIT_MASK(arch_num_cpus()) & ~BIT(_current_cpu->id);
+
+	if ((others != 0U) &&
+	    (k_ipi_work_add(&perf_data.ipi_work, others, perf_ipi_sample) == 0)) {
+		k_ipi_work_signal();
 	}
+#endif
+
+	perf_sample();
+}
+
+static void perf_stop(void)
+{
+	k_timer_stop(&perf_data.timer);
+	perf_data.running = false;
 }
 
 static void perf_dwork_handler(struct k_work *work)
@@ -62,7 +165,7 @@ static void perf_dwork_handler(struct k_work *work)
 	struct k_work_delayable *dwork = k_work_delayable_from_work(work);
 	struct perf_data_t *perf_data_ptr = CONTAINER_OF(dwork, struct perf_data_t, dwork);
 
-	k_timer_stop(&perf_data_ptr->timer);
+	perf_stop();
 	if (perf_data_ptr->buf_full) {
 		shell_error(perf_data_ptr->sh, "Perf buf overflow!");
 	} else {
@@ -72,7 +175,7 @@ static void perf_dwork_handler(struct k_work *work)
 
 static int cmd_perf_record(const struct shell *sh, size_t argc, char **argv)
 {
-	if (k_work_delayable_is_pending(&perf_data.dwork)) {
+	if (perf_data.running) {
 		shell_warn(sh, "Perf is running");
 		return -EINPROGRESS;
 	}
@@ -82,32 +185,62 @@ static int cmd_perf_record(const struct shell *sh, size_t argc, char **argv)
 		return -ENOBUFS;
 	}
 
-	k_timeout_t duration = K_MSEC(strtoll(argv[1], NULL, 10));
-	k_timeout_t period = K_NSEC(1000000000 / strtoll(argv[2], NULL, 10));
+	long long duration_ms = strtoll(argv[1], NULL, 10);
+	long long frequency = strtoll(argv[2], NULL, 10);
+
+	if ((duration_ms < 0) || (frequency <= 0)) {
+		shell_error(sh, "Invalid duration or frequency");
+		return -EINVAL;
+	}
+
+	k_timeout_t period = K_NSEC(1000000000 / frequency);
 
 	perf_data.sh = sh;
+	perf_data.running = true;
 
-	k_timer_user_data_set(&perf_data.timer, &perf_data);
 	k_timer_start(&perf_data.timer, K_NO_WAIT, period);
 
-	k_work_schedule(&perf_data.dwork, duration);
+	/* A zero duration samples until "perf stop" */
+	if (duration_ms != 0) {
+		k_work_schedule(&perf_data.dwork, K_MSEC(duration_ms));
+	}
 
 	shell_print(sh, "Enabled perf");
 
 	return 0;
 }
 
+static int cmd_perf_stop(const struct shell *sh, size_t argc, char **argv)
+{
+	struct k_work_sync sync;
+
+	if (!perf_data.running) {
+		shell_warn(sh, "Perf is not running");
+		return -EALREADY;
+	}
+
+	(void)k_work_cancel_delayable_sync(&perf_data.dwork, &sync);
+	perf_stop();
+	shell_print(sh, "Perf done!");
+
+	return 0;
+}
+
 static int cmd_perf_clear(const struct shell *sh, size_t argc, char **argv)
 {
 	if (sh != NULL) {
-		if (k_work_delayable_is_pending(&perf_data.dwork)) {
+		if (perf_data.running) {
 			shell_warn(sh, "Perf is running");
 			return -EINPROGRESS;
 		}
 		shell_print(sh, "Perf buffer cleared");
 	}
 
-	perf_data.idx = 0;
+	for (unsigned int i = 0; i < ARRAY_SIZE(perf_data.cpus); i++) {
+		perf_data.cpus[i].tail = 0;
+		perf_data.cpus[i].used = 0;
+		perf_data.cpus[i].dropped = 0;
+	}
 	perf_data.buf_full = false;
 
 	return 0;
@@ -115,39 +248,84 @@ static int cmd_perf_clear(const struct shell *sh, size_t argc, char **argv)
 
 static int cmd_perf_info(const struct shell *sh, size_t argc, char **argv)
 {
-	if (k_work_delayable_is_pending(&perf_data.dwork)) {
+	if (perf_data.running) {
 		shell_print(sh, "Perf is running");
 	}
 
-	shell_print(sh, "Perf buf: %zu/%d %s", perf_data.idx, CONFIG_PROFILING_PERF_BUFFER_SIZE,
-		    perf_data.buf_full ? "(full)" : "");
+	for (unsigned int i = 0; i < arch_num_cpus(); i++) {
+		shell_print(sh, "Perf buf cpu%u: %zu/%d, %u dropped", i,
+			    perf_data.cpus[i].used, CONFIG_PROFILING_PERF_BUFFER_SIZE,
+			    perf_data.cpus[i].dropped);
+	}
+
+	if (perf_data.buf_full) {
+		shell_print(sh, "Perf buffer is full");
+	}
 
 	return 0;
 }
 
+#if defined(CONFIG_THREAD_MONITOR) && defined(CONFIG_THREAD_NAME)
+static void perf_print_thread(const struct k_thread *thread, void *user_data)
+{
+	const struct shell *sh = user_data;
+	const char *name = k_thread_name_get((k_tid_t)thread);
+
+	if ((name != NULL) && (name[0] != '\0')) {
+		shell_print(sh, "Perf thread %016lx %s", (uintptr_t)thread, name);
+	}
+}
+#endif
+
 static int cmd_perf_print(const struct shell *sh, size_t argc, char **argv)
 {
-	if (k_work_delayable_is_pending(&perf_data.dwork)) {
+	size_t length = 0;
+
+	if (perf_data.running) {
 		shell_warn(sh, "Perf is running");
 		return -EINPROGRESS;
 	}
 
-	shell_print(sh, "Perf buf length %zu", perf_data.idx);
-	for (size_t i = 0; i < perf_data.idx; i++) {
-		shell_print(sh, "%016lx", perf_data.buf[i]);
+	for (unsigned int i = 0; i < arch_num_cpus(); i++) {
+		length += perf_data.cpus[i].used;
+	}
+
+	shell_print(sh, "Perf buf length %zu", length);
+	for (unsigned int i = 0; i < arch_num_cpus(); i++) {
+		for (size_t j = 0; j < perf_data.cpus[i].used; j++) {
+			shell_print(sh, "%016lx", perf_buf_get(&perf_data.cpus[i], j));
+		}
 	}
 
+	/* Names of the sampled threads, for those still alive */
+#if defined(CONFIG_THREAD_MONITOR) && defined(CONFIG_THREAD_NAME)
+	k_thread_foreach_unlocked(perf_print_thread, (void *)sh);
+#endif
+
 	cmd_perf_clear(NULL, 0, NULL);
 
 	return 0;
 }
 
+#ifdef CONFIG_SMP
+static int perf_init(void)
+{
+	k_ipi_work_init(&perf_data.ipi_work);
+
+	return 0;
+}
+
+SYS_INIT(perf_init, APPLICATION, CONFIG_APPLICATION_INIT_PRIORITY);
+#endif
+
 #define CMD_HELP_RECORD                                                                            \
 	"Start recording for <duration> ms on <frequency> Hz\n"                                    \
+	"A <duration> of 0 records until \"perf stop\"\n"                                          \
 	"Usage: record <duration> <frequency>"
 
 SHELL_STATIC_SUBCMD_SET_CREATE(m_sub_perf,
 	SHELL_CMD_ARG(record, NULL, CMD_HELP_RECORD, cmd_perf_record, 3, 0),
+	SHELL_CMD_ARG(stop, NULL, "Stop recording", cmd_perf_stop, 0, 0),
 	SHELL_CMD_ARG(printbuf, NULL, "Print the perf buffer", cmd_perf_print, 0, 0),
 	SHELL_CMD_ARG(clear, NULL, "Clear the perf buffer", cmd_perf_clear, 0, 0),
 	SHELL_CMD_ARG(info, NULL, "Print the perf info", cmd_perf_info, 0, 0),
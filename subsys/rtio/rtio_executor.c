@@ -57,13 +57,32 @@ static inline void rtio_iodev_submit(struct rtio_iodev_sqe *iodev_sqe)
 }
 
 /**
- * @brief Submit operations in the queue to iodevs
+ * @brief Pop the next submission of a chain or transaction
  *
- * @param r RTIO context
+ * Chains and transactions are queued at once, but on SMP the last entry may
+ * still be unreachable for a moment while a producer on another CPU links its
+ * own batch behind it.
+ */
+static inline struct mpsc_node *rtio_executor_pop_linked(struct rtio *r)
+{
+	struct mpsc_node *node = mpsc_pop(&r->sq);
+
+#ifdef CONFIG_SMP
+	while (node == NULL) {
+		Z_SPIN_DELAY(1);
+		node = mpsc_pop(&r->sq);
+	}
+#endif
+
+	return node;
+}
+
+/**
+ * @brief Work through the submission queue, handing operations to iodevs
  *
- * @retval 0 Always succeeds
+ * @param r RTIO context
  */
-void rtio_executor_submit(struct rtio *r)
+static void rtio_executor_drain(struct rtio *r)
 {
 	const uint16_t cancel_no_response = (RTIO_SQE_CANCELED | RTIO_SQE_NO_RESPONSE);
 	struct mpsc_node *node = mpsc_pop(&r->sq);
@@ -88,7 +107,7 @@ void rtio_executor_submit(struct rtio *r)
 			__ASSERT(transaction != chained,
 				    "Expected chained or transaction flag, not both");
 #endif
-			node = mpsc_pop(&iodev_sqe->r->sq);
+			node = rtio_executor_pop_linked(r);
 
 			__ASSERT(node != NULL,
 				    "Expected a valid submission in the queue while in a transaction or chain");
@@ -119,6 +138,45 @@ void rtio_executor_submit(struct rtio *r)
 	}
 }
 
+/**
+ * @brief Submit operations in the queue to iodevs
+ *
+ * The submission queue has a single consumer. The first context to ring the
+ * doorbell works through the queue, and keeps doing so until the contexts
+ * that rang it meanwhile, from other threads, CPUs or completion handlers,
+ * had their submissions handled as well.
+ *
+ * @param r RTIO context
+ */
+void rtio_executor_submit(struct rtio *r)
+{
+	atomic_val_t rings;
+
+#if defined(CONFIG_SMP) && !defined(CONFIG_RTIO_SUBMIT_SEM)
+	/* Record the CPU of the draining context before it can be preempted,
+	 * so that a submitter waiting on that CPU knows it has to sleep.
+	 */
+	unsigned int key = arch_irq_lock();
+
+	if (atomic_inc(&r->sq_doorbell) != 0) {
+		arch_irq_unlock(key);
+		return;
+	}
+
+	atomic_set(&r->sq_drain_cpu, (atomic_val_t)arch_curr_cpu()->id);
+	arch_irq_unlock(key);
+#else
+	if (atomic_inc(&r->sq_doorbell) != 0) {
+		return;
+	}
+#endif
+
+	do {
+		rings = atomic_get(&r->sq_doorbell);
+		rtio_executor_drain(r);
+	} while (atomic_sub(&r->sq_doorbell, rings) != rings);
+}
+
 /**
  * @brief Handle common logic when :c:macro:`RTIO_SQE_MULTISHOT` is set
  *
@@ -168,7 +226,7 @@ static inline void rtio_executor_done(struct rtio_iodev_sqe *iodev_sqe, int resu
 		}
 		if (!is_multishot || is_canceled) {
 			/* SQE is no longer needed, release it */
-			rtio_sqe_pool_free(r->sqe_pool, curr);
+			rtio_sqe_pool_free(rtio_iodev_sqe_pool(r, curr), curr);
 		}
 		if (!is_canceled && FIELD_GET(RTIO_SQE_NO_RESPONSE, sqe_flags) == 0) {
 			/* Request was not canceled, generate a CQE */
@@ -17,7 +17,55 @@
  *
  * Each op code that is acceptable from user mode must also be validated.
  */
-static inline bool rtio_vrfy_sqe(struct rtio_sqe *sqe)
+#if CONFIG_RTIO_REGISTERED_BUFFERS > 0
+/**
+ * Verify a buffer lies within one of the buffers registered with the context,
+ * which were validated when they were registered.
+ */
+static inline bool rtio_vrfy_registered(const struct rtio *r, const uint8_t *buf,
+					uint32_t buf_len)
+{
+	for (uint16_t i = 0; i < r->reg_buf_cnt; i++) {
+		const struct rtio_iovec *reg = &r->reg_bufs[i];
+
+		if (buf >= reg->buf && buf_len <= reg->buf_len &&
+		    (size_t)(buf - reg->buf) <= reg->buf_len - buf_len) {
+			return true;
+		}
+	}
+
+	return false;
+}
+
+static inline bool rtio_vrfy_iov(const struct rtio *r, const struct rtio_sqe *sqe)
+{
+	/* Only registered buffers, the segments given by user mode could
+	 * change after being verified.
+	 */
+	return sqe->iov.iov == NULL && sqe->iov.iov_cnt > 0 &&
+	       (uint32_t)sqe->iov.buf_index + sqe->iov.iov_cnt <= r->reg_buf_cnt;
+}
+#else
+static inline bool rtio_vrfy_registered(const struct rtio *r, const uint8_t *buf,
+					uint32_t buf_len)
+{
+	ARG_UNUSED(r);
+	ARG_UNUSED(buf);
+	ARG_UNUSED(buf_len);
+
+	return false;
+}
+
+static inline bool rtio_vrfy_iov(const struct rtio *r, const struct rtio_sqe *sqe)
+{
+	ARG_UNUSED(r);
+	ARG_UNUSED(sqe);
+
+	return false;
+}
+#endif
+
+static inline bool rtio_vrfy_sqe(const struct rtio *r, struct rtio_sqe *sqe)
 {
 	if (sqe->iodev != NULL && K_SYSCALL_OBJ(sqe->iodev, K_OBJ_RTIO_IODEV)) {
 		return false;
@@ -29,13 +77,23 @@ static inline bool rtio_vrfy_sqe(struct rtio_sqe *sqe)
 	case RTIO_OP_NOP:
 		break;
 	case RTIO_OP_TX:
-		valid_sqe &= K_SYSCALL_MEMORY(sqe->tx.buf, sqe->tx.buf_len, false);
+		if ((sqe->flags & RTIO_SQE_REGISTERED_BUFFER) != 0) {
+			valid_sqe &= rtio_vrfy_registered(r, sqe->tx.buf, sqe->tx.buf_len);
+		} else {
+			valid_sqe &= K_SYSCALL_MEMORY(sqe->tx.buf, sqe->tx.buf_len, false);
+		}
 		break;
 	case RTIO_OP_RX:
-		if ((sqe->flags & RTIO_SQE_MEMPOOL_BUFFER) == 0) {
+		if ((sqe->flags & RTIO_SQE_REGISTERED_BUFFER) != 0) {
+			valid_sqe &= rtio_vrfy_registered(r, sqe->rx.buf, sqe->rx.buf_len);
+		} else if ((sqe->flags & RTIO_SQE_MEMPOOL_BUFFER) == 0) {
 			valid_sqe &= K_SYSCALL_MEMORY(sqe->rx.buf, sqe->rx.buf_len, true);
 		}
 		break;
+	case RTIO_OP_RXV:
+	case RTIO_OP_TXV:
+		valid_sqe &= rtio_vrfy_iov(r, sqe);
+		break;
 	case RTIO_OP_TINY_TX:
 		break;
 	case RTIO_OP_TXRX:
@@ -98,7 +156,7 @@ static inline int z_vrfy_rtio_sqe_copy_in_get_handles(struct rtio *r, const stru
 		}
 		*sqe = sqes[i];
 
-		if (!rtio_vrfy_sqe(sqe)) {
+		if (!rtio_vrfy_sqe(r, sqe)) {
 			rtio_sqe_drop_all(r);
 			K_OOPS(true);
 		}
@@ -133,3 +191,29 @@ static inline int z_vrfy_rtio_submit(struct rtio *r, uint32_t wait_count)
 	return z_impl_rtio_submit(r, wait_count);
 }
 #include <zephyr/syscalls/rtio_submit_mrsh.c>
+
+static inline int z_vrfy_rtio_register_buffers(struct rtio *r, const struct rtio_iovec *bufs,
+					       uint16_t buf_cnt)
+{
+	K_OOPS(K_SYSCALL_OBJ(r, K_OBJ_RTIO));
+
+#if CONFIG_RTIO_REGISTERED_BUFFERS > 0
+	struct rtio_iovec bufs_copy[CONFIG_RTIO_REGISTERED_BUFFERS];
+
+	if (buf_cnt > ARRAY_SIZE(bufs_copy)) {
+		return -ENOMEM;
+	}
+
+	/* Copy first so the buffers verified are the ones registered */
+	K_OOPS(k_usermode_from_copy(bufs_copy, bufs, buf_cnt * sizeof(struct rtio_iovec)));
+
+	for (uint16_t i = 0; i < buf_cnt; i++) {
+		K_OOPS(K_SYSCALL_MEMORY_WRITE(bufs_copy[i].buf, bufs_copy[i].buf_len));
+	}
+
+	return z_impl_rtio_register_buffers(r, bufs_copy, buf_cnt);
+#else
+	return z_impl_rtio_register_buffers(r, bufs, buf_cnt);
+#endif
+}
+#include <zephyr/syscalls/rtio_register_buffers_mrsh.c>
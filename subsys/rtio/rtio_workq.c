@@ -6,16 +6,37 @@
 
 #include <zephyr/rtio/work.h>
 #include <zephyr/kernel.h>
+#include <zephyr/init.h>
 
 #define RTIO_WORKQ_PRIO_MED		CONFIG_RTIO_WORKQ_PRIO_MED
 #define RTIO_WORKQ_PRIO_HIGH		RTIO_WORKQ_PRIO_MED - 1
 #define RTIO_WORKQ_PRIO_LOW		RTIO_WORKQ_PRIO_MED + 1
 
+/* Threads are started by us, either at boot or when all others are busy */
+#ifdef CONFIG_RTIO_WORKQ_CPU_AFFINITY
+#define RTIO_WORKQ_FLAGS		K_P4WQ_USER_CPU_MASK
+#else
+#define RTIO_WORKQ_FLAGS		K_P4WQ_DELAYED_START
+#endif
+
 K_MEM_SLAB_DEFINE_STATIC(rtio_work_items_slab,
 			 sizeof(struct rtio_work_req),
 			 CONFIG_RTIO_WORKQ_POOL_ITEMS,
 			 4);
 
+/* Number of threads of the pool started */
+static atomic_t rtio_workq_started;
+
+/* Number of requests queued or running on a thread, not counting batched ones */
+static atomic_t rtio_workq_busy;
+
+#ifdef CONFIG_RTIO_WORKQ_BATCHING
+static struct k_spinlock rtio_workq_batch_lock;
+
+/* Requests queued or running on a thread which others may be batched with */
+static sys_slist_t rtio_workq_batches;
+#endif
+
 static void rtio_work_req_done_handler(struct k_p4wq_work *work)
 {
 	struct rtio_work_req *req = CONTAINER_OF(work,
@@ -24,11 +45,81 @@ static void rtio_work_req_done_handler(struct k_p4wq_work *work)
 	k_mem_slab_free(&rtio_work_items_slab, req);
 }
 
-K_P4WQ_DEFINE_WITH_DONE_HANDLER(rtio_workq,
+K_P4WQ_DEFINE_WITH_FLAGS(rtio_workq,
 	      CONFIG_RTIO_WORKQ_THREADS_POOL,
 	      CONFIG_RTIO_WORKQ_STACK_SIZE,
+	      RTIO_WORKQ_FLAGS,
 		  rtio_work_req_done_handler);
 
+static void rtio_workq_start_thread(void)
+{
+	uint32_t cpu_mask = 0;
+	atomic_val_t i;
+
+	do {
+		i = atomic_get(&rtio_workq_started);
+		if (i >= CONFIG_RTIO_WORKQ_THREADS_POOL) {
+			return;
+		}
+	} while (!atomic_cas(&rtio_workq_started, i, i + 1));
+
+#ifdef CONFIG_RTIO_WORKQ_CPU_AFFINITY
+	/* Spread the threads over the CPUs */
+	cpu_mask = BIT(i % arch_num_cpus());
+#endif
+
+	k_p4wq_enable_static_thread(&rtio_workq, &_p4threads_rtio_workq[i], cpu_mask);
+}
+
+#ifdef CONFIG_RTIO_WORKQ_BATCHING
+/* Add the request to the batch of a request for the same iodev if there is one,
+ * or make it the head of a new batch.
+ */
+static bool rtio_work_req_batch(struct rtio_work_req *req)
+{
+	k_spinlock_key_t key = k_spin_lock(&rtio_workq_batch_lock);
+	struct rtio_work_req *head;
+
+	SYS_SLIST_FOR_EACH_CONTAINER(&rtio_workq_batches, head, node) {
+		if (head->iodev == req->iodev && head->work.priority == req->work.priority) {
+			sys_slist_append(&head->batch, &req->node);
+			k_spin_unlock(&rtio_workq_batch_lock, key);
+			return true;
+		}
+	}
+
+	sys_slist_init(&req->batch);
+	sys_slist_append(&rtio_workq_batches, &req->node);
+	k_spin_unlock(&rtio_workq_batch_lock, key);
+
+	return false;
+}
+
+static void rtio_work_req_run_batch(struct rtio_work_req *head)
+{
+	struct rtio_work_req *req;
+	k_spinlock_key_t key;
+	sys_snode_t *node;
+
+	while (true) {
+		key = k_spin_lock(&rtio_workq_batch_lock);
+		node = sys_slist_get(&head->batch);
+		if (node == NULL) {
+			(void)sys_slist_find_and_remove(&rtio_workq_batches, &head->node);
+		}
+		k_spin_unlock(&rtio_workq_batch_lock, key);
+
+		if (node == NULL) {
+			return;
+		}
+
+		req = CONTAINER_OF(node, struct rtio_work_req, node);
+		req->handler(req->iodev_sqe);
+		k_mem_slab_free(&rtio_work_items_slab, req);
+	}
+}
+#endif
+
 static void rtio_work_handler(struct k_p4wq_work *work)
 {
 	struct rtio_work_req *req = CONTAINER_OF(work,
@@ -37,6 +128,12 @@ static void rtio_work_handler(struct k_p4wq_work *work)
 	struct rtio_iodev_sqe *iodev_sqe = req->iodev_sqe;
 
 	req->handler(iodev_sqe);
+
+#ifdef CONFIG_RTIO_WORKQ_BATCHING
+	rtio_work_req_run_batch(req);
+#endif
+
+	atomic_dec(&rtio_workq_busy);
 }
 
 struct rtio_work_req *rtio_work_req_alloc(void)
@@ -91,6 +188,21 @@ void rtio_work_req_submit(struct rtio_work_req *req,
 		work->priority = RTIO_WORKQ_PRIO_MED;
 	}
 
+#ifdef CONFIG_RTIO_WORKQ_BATCHING
+	/** Requests for the same iodev would mostly wait on the same bus,
+	 * run them one after the other on a single thread instead.
+	 */
+	req->iodev = sqe->iodev;
+	if (rtio_work_req_batch(req)) {
+		return;
+	}
+#endif
+
+	/** Grow the pool when every started thread is busy */
+	if (atomic_inc(&rtio_workq_busy) >= atomic_get(&rtio_workq_started)) {
+		rtio_workq_start_thread();
+	}
+
 	/** Decoupling action: Let the P4WQ execute the action. */
 	k_p4wq_submit(&rtio_workq, work);
 }
@@ -99,3 +211,15 @@ uint32_t rtio_work_req_used_count_get(void)
 {
 	return k_mem_slab_num_used_get(&rtio_work_items_slab);
 }
+
+static int rtio_workq_init(void)
+{
+	for (int i = 0; i < CONFIG_RTIO_WORKQ_THREADS_POOL_MIN; i++) {
+		rtio_workq_start_thread();
+	}
+
+	return 0;
+}
+
+/* After the P4WQ threads have been created, RTIO_WORKQ selects P4WQ_INIT_STAGE_EARLY */
+SYS_INIT(rtio_workq_init, POST_KERNEL, 2);
@@ -39,12 +39,14 @@ struct settings_nvs {
 	uint16_t last_name_id;
 	const struct device *flash_dev;
 #if CONFIG_SETTINGS_NVS_NAME_CACHE
+	/* Hash table of name IDs, filled with all names on load. */
 	struct {
-		uint16_t name_hash;
+		uint32_t name_hash;
 		uint16_t name_id;
+		/* Hash of the first name component, to load subtrees. */
+		uint16_t subtree_hash;
 	} cache[CONFIG_SETTINGS_NVS_NAME_CACHE_SIZE];
 
-	uint16_t cache_next;
 	uint16_t cache_total;
 	bool loaded;
 #endif
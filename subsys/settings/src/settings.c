@@ -25,6 +25,127 @@ sys_slist_t settings_handlers;
 
 K_MUTEX_DEFINE(settings_lock);
 
+#if defined(CONFIG_SETTINGS_HANDLER_INDEX)
+BUILD_ASSERT(IS_POWER_OF_TWO(CONFIG_SETTINGS_HANDLER_INDEX_SIZE),
+	     "Settings handler index size must be a power of two");
+
+#define HANDLER_INDEX_MASK (CONFIG_SETTINGS_HANDLER_INDEX_SIZE - 1)
+
+/* Open addressing hash table of handlers keyed by the hash of their name. */
+static struct settings_handler_index_entry {
+	uint32_t hash;
+	struct settings_handler_static *handler;
+} handler_index[CONFIG_SETTINGS_HANDLER_INDEX_SIZE];
+
+static bool handler_index_valid;
+
+static bool handler_index_add(struct settings_handler_static *handler)
+{
+	uint32_t hash = settings_name_hash(handler->name);
+
+	for (uint32_t i = 0; i < ARRAY_SIZE(handler_index); i++) {
+		struct settings_handler_index_entry *entry =
+			&handler_index[(hash + i) & HANDLER_INDEX_MASK];
+
+		if (entry->handler == NULL) {
+			entry->hash = hash;
+			entry->handler = handler;
+			return true;
+		}
+	}
+
+	return false;
+}
+
+void settings_handler_index_build(void)
+{
+	memset(handler_index, 0, sizeof(handler_index));
+	handler_index_valid = true;
+
+	STRUCT_SECTION_FOREACH(settings_handler_static, ch) {
+		handler_index_valid = handler_index_valid && handler_index_add(ch);
+	}
+
+#if defined(CONFIG_SETTINGS_DYNAMIC_HANDLERS)
+	struct settings_handler *ch;
+
+	SYS_SLIST_FOR_EACH_CONTAINER(&settings_handlers, ch, node) {
+		handler_index_valid = handler_index_valid &&
+			handler_index_add((struct settings_handler_static *)ch);
+	}
+#endif /* CONFIG_SETTINGS_DYNAMIC_HANDLERS */
+
+	if (!handler_index_valid) {
+		LOG_WRN("Handler index full, increase SETTINGS_HANDLER_INDEX_SIZE");
+	}
+}
+
+void settings_handler_index_drop(void)
+{
+	handler_index_valid = false;
+}
+
+/* Find the handler registered under the first len characters of name. */
+static struct settings_handler_static *handler_index_find(const char *name, size_t len,
+							  uint32_t hash)
+{
+	struct settings_handler_static *found = NULL;
+
+	for (uint32_t i = 0; i < ARRAY_SIZE(handler_index); i++) {
+		struct settings_handler_index_entry *entry =
+			&handler_index[(hash + i) & HANDLER_INDEX_MASK];
+
+		if (entry->handler == NULL) {
+			break;
+		}
+
+		/* Last handler registered under the same name wins, as in a full scan. */
+		if ((entry->hash == hash) && (strncmp(entry->handler->name, name, len) == 0) &&
+		    (entry->handler->name[len] == '\0')) {
+			found = entry->handler;
+		}
+	}
+
+	return found;
+}
+
+/*
+ * Look up the handler for each prefix of the name ending at a separator,
+ * the deepest one is the best match.
+ */
+static struct settings_handler_static *handler_index_lookup(const char *name,
+							    const char **next)
+{
+	struct settings_handler_static *bestmatch = NULL;
+	uint32_t hash = SETTINGS_NAME_HASH_INIT;
+	const char *c = name;
+
+	while (true) {
+		bool end = (*c == '\0') || (*c == SETTINGS_NAME_END);
+
+		if (end || (*c == SETTINGS_NAME_SEPARATOR)) {
+			struct settings_handler_static *ch;
+
+			ch = handler_index_find(name, c - name, hash);
+			if (ch != NULL) {
+				bestmatch = ch;
+				if (next) {
+					*next = end ? NULL : c + 1;
+				}
+			}
+		}
+
+		if (end) {
+			break;
+		}
+
+		hash = settings_name_hash_update(hash, *c++);
+	}
+
+	return bestmatch;
+}
+#endif /* CONFIG_SETTINGS_HANDLER_INDEX */
+
 
 void settings_store_init(void);
 
@@ -60,6 +181,14 @@ int settings_register_with_cprio(struct settings_handler *handler, int cprio)
 	handler->cprio = cprio;
 	sys_slist_append(&settings_handlers, &handler->node);
 
+#if defined(CONFIG_SETTINGS_HANDLER_INDEX)
+	/* Handler registered while settings are loaded. */
+	if (handler_index_valid) {
+		handler_index_valid =
+			handler_index_add((struct settings_handler_static *)handler);
+	}
+#endif /* CONFIG_SETTINGS_HANDLER_INDEX */
+
 end:
 	k_mutex_unlock(&settings_lock);
 	return rc;
@@ -153,6 +282,12 @@ struct settings_handler_static *settings_parse_and_lookup(const char *name,
 		*next = NULL;
 	}
 
+#if defined(CONFIG_SETTINGS_HANDLER_INDEX)
+	if (handler_index_valid && (name != NULL)) {
+		return handler_index_lookup(name, next);
+	}
+#endif /* CONFIG_SETTINGS_HANDLER_INDEX */
+
 	STRUCT_SECTION_FOREACH(settings_handler_static, ch) {
 		if (!settings_name_steq(name, ch->name, &tmpnext)) {
 			continue;
@@ -217,6 +352,11 @@ int settings_call_set_handler(const char *name,
 	} else {
 		struct settings_handler_static *ch;
 
+		if (IS_ENABLED(CONFIG_SETTINGS_DEFERRED_LOAD) &&
+		    !(load_arg && load_arg->subtree) && settings_deferred_skip(name)) {
+			return 0;
+		}
+
 		ch = settings_parse_and_lookup(name, &name_key);
 		if (!ch) {
 			return 0;
@@ -275,6 +415,11 @@ int settings_commit_subtree(const char *subtree)
 				continue;
 			}
 
+			if (IS_ENABLED(CONFIG_SETTINGS_DEFERRED_LOAD) && !subtree &&
+			    settings_deferred_skip(ch->name)) {
+				continue;
+			}
+
 			if (ch->h_commit) {
 				next_cprio = set_next_cprio(ch->cprio, cprio, next_cprio);
 				if (ch->cprio != cprio) {
@@ -296,6 +441,11 @@ int settings_commit_subtree(const char *subtree)
 					continue;
 				}
 
+				if (IS_ENABLED(CONFIG_SETTINGS_DEFERRED_LOAD) && !subtree &&
+				    settings_deferred_skip(ch->name)) {
+					continue;
+				}
+
 				if (ch->h_commit) {
 					next_cprio = set_next_cprio(ch->cprio, cprio, next_cprio);
 					if (ch->cprio != cprio) {
@@ -0,0 +1,147 @@
+/*
+ * Copyright (c) 2025 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <errno.h>
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <zephyr/settings/settings.h>
+#include "settings_priv.h"
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_DECLARE(settings, CONFIG_SETTINGS_LOG_LEVEL);
+
+#define DEFERRED_LOAD_DONE BIT(0)
+
+extern struct k_mutex settings_lock;
+
+/* Subtrees skipped by settings_load() until they are loaded in the background. */
+static const char *deferred_subtrees[CONFIG_SETTINGS_DEFERRED_LOAD_MAX_SUBTREES];
+
+static K_THREAD_STACK_DEFINE(deferred_load_stack, CONFIG_SETTINGS_DEFERRED_LOAD_STACK_SIZE);
+static struct k_work_q deferred_load_workq;
+static struct k_work_delayable deferred_load_work;
+static K_EVENT_DEFINE(deferred_load_event);
+static bool deferred_load_started;
+
+static void deferred_load_handler(struct k_work *work)
+{
+	ARG_UNUSED(work);
+
+	for (size_t i = 0; i < ARRAY_SIZE(deferred_subtrees); i++) {
+		const char *subtree;
+		int rc;
+
+		k_mutex_lock(&settings_lock, K_FOREVER);
+		subtree = deferred_subtrees[i];
+		k_mutex_unlock(&settings_lock);
+
+		if (subtree == NULL) {
+			continue;
+		}
+
+		rc = settings_load_subtree(subtree);
+		if (rc != 0) {
+			LOG_ERR("Deferred load of %s failed (err %d)", subtree, rc);
+		}
+
+		k_mutex_lock(&settings_lock, K_FOREVER);
+		deferred_subtrees[i] = NULL;
+		k_mutex_unlock(&settings_lock);
+	}
+
+	k_mutex_lock(&settings_lock, K_FOREVER);
+	for (size_t i = 0; i < ARRAY_SIZE(deferred_subtrees); i++) {
+		if (deferred_subtrees[i] != NULL) {
+			/* Subtree deferred while others were loaded. */
+			(void)k_work_schedule_for_queue(&deferred_load_workq, &deferred_load_work,
+							K_NO_WAIT);
+			k_mutex_unlock(&settings_lock);
+			return;
+		}
+	}
+	k_event_post(&deferred_load_event, DEFERRED_LOAD_DONE);
+	k_mutex_unlock(&settings_lock);
+}
+
+int settings_load_defer(const char *subtree)
+{
+	int rc = -ENOMEM;
+
+	if ((subtree == NULL) || (*subtree == '\0')) {
+		return -EINVAL;
+	}
+
+	k_mutex_lock(&settings_lock, K_FOREVER);
+
+	if (!deferred_load_started) {
+		k_work_queue_start(&deferred_load_workq, deferred_load_stack,
+				   K_THREAD_STACK_SIZEOF(deferred_load_stack),
+				   CONFIG_SETTINGS_DEFERRED_LOAD_PRIORITY, NULL);
+		k_thread_name_set(&deferred_load_workq.thread, "settings_load");
+		k_work_init_delayable(&deferred_load_work, deferred_load_handler);
+		deferred_load_started = true;
+	}
+
+	for (size_t i = 0; i < ARRAY_SIZE(deferred_subtrees); i++) {
+		if ((deferred_subtrees[i] != NULL) &&
+		    (strcmp(deferred_subtrees[i], subtree) == 0)) {
+			rc = 0;
+			goto end;
+		}
+	}
+
+	for (size_t i = 0; i < ARRAY_SIZE(deferred_subtrees); i++) {
+		if (deferred_subtrees[i] == NULL) {
+			deferred_subtrees[i] = subtree;
+			rc = 0;
+			break;
+		}
+	}
+
+end:
+	if (rc == 0) {
+		k_event_clear(&deferred_load_event, DEFERRED_LOAD_DONE);
+	}
+
+	k_mutex_unlock(&settings_lock);
+
+	return rc;
+}
+
+bool settings_deferred_skip(const char *name)
+{
+	for (size_t i = 0; i < ARRAY_SIZE(deferred_subtrees); i++) {
+		if ((deferred_subtrees[i] != NULL) &&
+		    settings_name_steq(name, deferred_subtrees[i], NULL)) {
+			return true;
+		}
+	}
+
+	return false;
+}
+
+void settings_deferred_schedule(void)
+{
+	if (!deferred_load_started) {
+		return;
+	}
+
+	(void)k_work_schedule_for_queue(&deferred_load_workq, &deferred_load_work,
+					K_MSEC(CONFIG_SETTINGS_DEFERRED_LOAD_DELAY_MS));
+}
+
+int settings_load_deferred_wait(k_timeout_t timeout)
+{
+	if (!deferred_load_started) {
+		return 0;
+	}
+
+	if (k_event_wait(&deferred_load_event, DEFERRED_LOAD_DONE, false, timeout) == 0) {
+		return -EAGAIN;
+	}
+
+	return 0;
+}
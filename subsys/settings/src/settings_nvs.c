@@ -10,7 +10,6 @@
 
 #include <zephyr/settings/settings.h>
 #include "settings/settings_nvs.h"
-#include <zephyr/sys/crc.h>
 #include "settings_priv.h"
 #include <zephyr/storage/flash_map.h>
 
@@ -76,33 +75,93 @@ int settings_nvs_dst(struct settings_nvs *cf)
 #if CONFIG_SETTINGS_NVS_NAME_CACHE
 #define SETTINGS_NVS_CACHE_OVFL(cf) ((cf)->cache_total > ARRAY_SIZE((cf)->cache))
 
+/* Name IDs are above NVS_NAMECNT_ID, lower values mark unused entries. */
+#define SETTINGS_NVS_CACHE_EMPTY 0
+#define SETTINGS_NVS_CACHE_DELETED NVS_NAMECNT_ID
+
+static uint16_t settings_nvs_subtree_hash(const char *name)
+{
+	uint32_t hash = SETTINGS_NAME_HASH_INIT;
+
+	while ((*name != '\0') && (*name != SETTINGS_NAME_SEPARATOR) &&
+	       (*name != SETTINGS_NAME_END)) {
+		hash = settings_name_hash_update(hash, *name++);
+	}
+
+	return hash ^ (hash >> 16);
+}
+
+static void settings_nvs_cache_clear(struct settings_nvs *cf)
+{
+	memset(cf->cache, 0, sizeof(cf->cache));
+	cf->cache_total = 0;
+}
+
 static void settings_nvs_cache_add(struct settings_nvs *cf, const char *name,
 				   uint16_t name_id)
 {
-	uint16_t name_hash = crc16_ccitt(0xffff, name, strlen(name));
+	uint32_t name_hash = settings_name_hash(name);
+
+	/* Once overflowed, the cache is incomplete until the next load. */
+	if (SETTINGS_NVS_CACHE_OVFL(cf)) {
+		return;
+	}
+
+	cf->cache_total++;
 
-	cf->cache[cf->cache_next].name_hash = name_hash;
-	cf->cache[cf->cache_next++].name_id = name_id;
+	for (int i = 0; i < CONFIG_SETTINGS_NVS_NAME_CACHE_SIZE; i++) {
+		int idx = (name_hash + i) % CONFIG_SETTINGS_NVS_NAME_CACHE_SIZE;
 
-	cf->cache_next %= CONFIG_SETTINGS_NVS_NAME_CACHE_SIZE;
+		if (cf->cache[idx].name_id <= NVS_NAMECNT_ID) {
+			cf->cache[idx].name_hash = name_hash;
+			cf->cache[idx].name_id = name_id;
+			cf->cache[idx].subtree_hash = settings_nvs_subtree_hash(name);
+			return;
+		}
+	}
+}
+
+static void settings_nvs_cache_remove(struct settings_nvs *cf, const char *name,
+				      uint16_t name_id)
+{
+	uint32_t name_hash = settings_name_hash(name);
+
+	for (int i = 0; i < CONFIG_SETTINGS_NVS_NAME_CACHE_SIZE; i++) {
+		int idx = (name_hash + i) % CONFIG_SETTINGS_NVS_NAME_CACHE_SIZE;
+
+		if (cf->cache[idx].name_id == SETTINGS_NVS_CACHE_EMPTY) {
+			return;
+		}
+
+		if (cf->cache[idx].name_id == name_id) {
+			cf->cache[idx].name_id = SETTINGS_NVS_CACHE_DELETED;
+			if (!SETTINGS_NVS_CACHE_OVFL(cf)) {
+				cf->cache_total--;
+			}
+			return;
+		}
+	}
 }
 
 static uint16_t settings_nvs_cache_match(struct settings_nvs *cf, const char *name,
 					 char *rdname, size_t len)
 {
-	uint16_t name_hash = crc16_ccitt(0xffff, name, strlen(name));
+	uint32_t name_hash = settings_name_hash(name);
 	int rc;
 
 	for (int i = 0; i < CONFIG_SETTINGS_NVS_NAME_CACHE_SIZE; i++) {
-		if (cf->cache[i].name_hash != name_hash) {
-			continue;
+		int idx = (name_hash + i) % CONFIG_SETTINGS_NVS_NAME_CACHE_SIZE;
+
+		if (cf->cache[idx].name_id == SETTINGS_NVS_CACHE_EMPTY) {
+			break;
 		}
 
-		if (cf->cache[i].name_id <= NVS_NAMECNT_ID) {
+		if ((cf->cache[idx].name_hash != name_hash) ||
+		    (cf->cache[idx].name_id <= NVS_NAMECNT_ID)) {
 			continue;
 		}
 
-		rc = nvs_read(&cf->cf_nvs, cf->cache[i].name_id, rdname, len);
+		rc = nvs_read(&cf->cf_nvs, cf->cache[idx].name_id, rdname, len);
 		if (rc < 0) {
 			continue;
 		}
@@ -113,11 +172,51 @@ static uint16_t settings_nvs_cache_match(struct settings_nvs *cf, const char *na
 			continue;
 		}
 
-		return cf->cache[i].name_id;
+		return cf->cache[idx].name_id;
 	}
 
 	return NVS_NAMECNT_ID;
 }
+
+/* Load a subtree, reading only the names which share its first component. */
+static int settings_nvs_cache_load(struct settings_nvs *cf,
+				   const struct settings_load_arg *arg)
+{
+	struct settings_nvs_read_fn_arg read_fn_arg;
+	char name[SETTINGS_MAX_NAME_LEN + SETTINGS_EXTRA_LEN + 1];
+	uint16_t subtree_hash = settings_nvs_subtree_hash(arg->subtree);
+	char buf;
+	ssize_t rc1, rc2;
+	int ret = 0;
+
+	for (int i = 0; i < CONFIG_SETTINGS_NVS_NAME_CACHE_SIZE; i++) {
+		uint16_t name_id = cf->cache[i].name_id;
+
+		if ((name_id <= NVS_NAMECNT_ID) || (cf->cache[i].subtree_hash != subtree_hash)) {
+			continue;
+		}
+
+		rc1 = nvs_read(&cf->cf_nvs, name_id, &name, sizeof(name));
+		rc2 = nvs_read(&cf->cf_nvs, name_id + NVS_NAME_ID_OFFSET,
+			       &buf, sizeof(buf));
+		if ((rc1 <= 0) || (rc2 <= 0)) {
+			/* Broken items are cleaned by a full load. */
+			continue;
+		}
+
+		name[rc1] = '\0';
+		read_fn_arg.fs = &cf->cf_nvs;
+		read_fn_arg.id = name_id + NVS_NAME_ID_OFFSET;
+
+		ret = settings_call_set_handler(name, rc2, settings_nvs_read_fn,
+						&read_fn_arg, (void *)arg);
+		if (ret) {
+			break;
+		}
+	}
+
+	return ret;
+}
 #endif /* CONFIG_SETTINGS_NVS_NAME_CACHE */
 
 static int settings_nvs_load(struct settings_store *cs,
@@ -132,9 +231,14 @@ static int settings_nvs_load(struct settings_store *cs,
 	uint16_t name_id = NVS_NAMECNT_ID;
 
 #if CONFIG_SETTINGS_NVS_NAME_CACHE
-	uint16_t cached = 0;
+	/* A complete cache tells where the items of a subtree are. */
+	if ((arg != NULL) && (arg->subtree != NULL) && cf->loaded &&
+	    !SETTINGS_NVS_CACHE_OVFL(cf)) {
+		return settings_nvs_cache_load(cf, arg);
+	}
 
 	cf->loaded = false;
+	settings_nvs_cache_clear(cf);
 #endif
 
 	name_id = cf->last_name_id + 1;
@@ -145,7 +249,6 @@ static int settings_nvs_load(struct settings_store *cs,
 		if (name_id == NVS_NAMECNT_ID) {
 #if CONFIG_SETTINGS_NVS_NAME_CACHE
 			cf->loaded = true;
-			cf->cache_total = cached;
 #endif
 			break;
 		}
@@ -198,7 +301,6 @@ static int settings_nvs_load(struct settings_store *cs,
 
 #if CONFIG_SETTINGS_NVS_NAME_CACHE
 		settings_nvs_cache_add(cf, name, name_id);
-		cached++;
 #endif
 
 		ret = settings_call_set_handler(
@@ -297,6 +399,10 @@ found:
 			return rc;
 		}
 
+#if CONFIG_SETTINGS_NVS_NAME_CACHE
+		settings_nvs_cache_remove(cf, name, name_id);
+#endif
+
 		if (name_id == cf->last_name_id) {
 			cf->last_name_id--;
 			rc = nvs_write(&cf->cf_nvs, NVS_NAMECNT_ID,
@@ -345,9 +451,6 @@ found:
 #if CONFIG_SETTINGS_NVS_NAME_CACHE
 	if (!name_in_cache) {
 		settings_nvs_cache_add(cf, name, write_name_id);
-		if (cf->loaded && !SETTINGS_NVS_CACHE_OVFL(cf)) {
-			cf->cache_total++;
-		}
 	}
 #endif
 
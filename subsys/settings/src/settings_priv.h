@@ -107,6 +107,39 @@ void settings_line_io_init(int (*read_cb)(void *ctx, off_t off, char *buf,
 			  uint8_t io_rwbs);
 
 
+/* FNV-1a hash of settings names, used by the name indexes. */
+#define SETTINGS_NAME_HASH_INIT 2166136261U
+
+static inline uint32_t settings_name_hash_update(uint32_t hash, char c)
+{
+	return (hash ^ (uint8_t)c) * 16777619U;
+}
+
+static inline uint32_t settings_name_hash(const char *name)
+{
+	uint32_t hash = SETTINGS_NAME_HASH_INIT;
+
+	while (*name != '\0') {
+		hash = settings_name_hash_update(hash, *name++);
+	}
+
+	return hash;
+}
+
+/*
+ * Build the index of handlers used by settings_parse_and_lookup() while
+ * settings are loaded, and drop it once loading is done.
+ */
+void settings_handler_index_build(void);
+void settings_handler_index_drop(void);
+
+/*
+ * Check if a setting belongs to a subtree deferred with settings_load_defer(),
+ * and schedule the loading of deferred subtrees.
+ */
+bool settings_deferred_skip(const char *name);
+void settings_deferred_schedule(void);
+
 extern sys_slist_t settings_load_srcs;
 extern sys_slist_t settings_handlers;
 extern struct settings_store *settings_save_dst;
@@ -54,10 +54,19 @@ int settings_load_subtree(const char *subtree)
 	 *    commit all
 	 */
 	k_mutex_lock(&settings_lock, K_FOREVER);
+	if (IS_ENABLED(CONFIG_SETTINGS_HANDLER_INDEX)) {
+		settings_handler_index_build();
+	}
 	SYS_SLIST_FOR_EACH_CONTAINER(&settings_load_srcs, cs, cs_next) {
 		cs->cs_itf->csi_load(cs, &arg);
 	}
+	if (IS_ENABLED(CONFIG_SETTINGS_HANDLER_INDEX)) {
+		settings_handler_index_drop();
+	}
 	rc = settings_commit_subtree(subtree);
+	if (IS_ENABLED(CONFIG_SETTINGS_DEFERRED_LOAD) && (subtree == NULL)) {
+		settings_deferred_schedule();
+	}
 	k_mutex_unlock(&settings_lock);
 	return rc;
 }
@@ -49,10 +49,20 @@
 		tracing_format_raw_data(epacket, sizeof(epacket));              \
 	}
 
+/*
+ * Timestamp in nanoseconds truncated to 32 bits. It wraps around consistently
+ * only if it is taken from the 64-bit cycle counter.
+ */
+#ifdef CONFIG_TIMER_HAS_64BIT_CYCLE_COUNTER
+#define CTF_INTERNAL_TIMESTAMP() ((uint32_t)k_cyc_to_ns_floor64(k_cycle_get_64()))
+#else
+#define CTF_INTERNAL_TIMESTAMP() ((uint32_t)k_cyc_to_ns_floor64(k_cycle_get_32()))
+#endif
+
 #ifdef CONFIG_TRACING_CTF_TIMESTAMP
 #define CTF_EVENT(...)                                                         \
 	{                                                                      \
-		const uint32_t tstamp = k_cyc_to_ns_floor64(k_cycle_get_32()); \
+		const uint32_t tstamp = CTF_INTERNAL_TIMESTAMP();              \
 									       \
 		CTF_GATHER_FIELDS(tstamp, __VA_ARGS__)                         \
 	}
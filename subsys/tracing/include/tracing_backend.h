@@ -31,6 +31,9 @@ struct tracing_backend_api {
 	void (*init)(void);
 	void (*output)(const struct tracing_backend *backend,
 		       uint8_t *data, uint32_t length);
+	/* Optional, output data of a per-CPU buffer to the stream of the CPU. */
+	void (*output_cpu)(const struct tracing_backend *backend, uint32_t cpu,
+			   uint8_t *data, uint32_t length);
 };
 
 /**
@@ -82,6 +85,29 @@ static inline void tracing_backend_output(
 	}
 }
 
+/**
+ * @brief Output tracing packet of a CPU with tracing backend.
+ *
+ * Packet is output to the common stream if backend has no per-CPU streams.
+ *
+ * @param backend Pointer to tracing_backend instance.
+ * @param cpu     CPU which put the packet.
+ * @param data    Address of outputting buffer.
+ * @param length  Length of outputting buffer.
+ */
+static inline void tracing_backend_output_cpu(
+		const struct tracing_backend *backend, uint32_t cpu,
+		uint8_t *data, uint32_t length)
+{
+	if (backend && backend->api) {
+		if (backend->api->output_cpu) {
+			backend->api->output_cpu(backend, cpu, data, length);
+		} else {
+			backend->api->output(backend, data, length);
+		}
+	}
+}
+
 /**
  * @brief Get tracing backend based on the name of
  *        tracing backend in tracing backend section.
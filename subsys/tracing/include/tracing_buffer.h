@@ -9,6 +9,7 @@
 
 #include <stdbool.h>
 #include <zephyr/types.h>
+#include <zephyr/tracing/tracing_format.h>
 
 #ifdef __cplusplus
 extern "C" {
@@ -104,6 +105,40 @@ int tracing_buffer_get_finish(uint32_t size);
  */
 uint32_t tracing_buffer_get(uint8_t *data, uint32_t size);
 
+/**
+ * @brief Put a packet to the tracing buffer of the current CPU.
+ *
+ * Packet is gathered from the data fragments and stamped with the cycle
+ * counter, so packets of all CPUs can be output in time order.
+ *
+ * @param data_array Data fragments of the packet.
+ * @param count Number of data fragments.
+ * @param before_put_is_empty Set to true if the buffer was empty before put.
+ *
+ * @retval true Packet was put or discarded because tracing is stopped.
+ * @retval false Packet was dropped because there isn't enough free space.
+ */
+bool tracing_buffer_cpu_put(const tracing_data_t *data_array, uint32_t count,
+			    bool *before_put_is_empty);
+
+/**
+ * @brief Get the oldest packet of all per-CPU tracing buffers.
+ *
+ * @param data Pointer to the address. It's set to the packet data
+ *             within the tracing buffer.
+ * @param cpu Set to the CPU which put the packet.
+ *
+ * @return Packet length (in bytes), 0 if all buffers are empty.
+ */
+uint32_t tracing_buffer_cpu_get_claim(uint8_t **data, uint32_t *cpu);
+
+/**
+ * @brief Release the packet claimed with @ref tracing_buffer_cpu_get_claim.
+ *
+ * @param cpu CPU which put the packet.
+ */
+void tracing_buffer_cpu_get_finish(uint32_t cpu);
+
 /**
  * @brief Get buffer from tracing command buffer.
  *
@@ -33,6 +33,15 @@ bool is_tracing_enabled(void);
  */
 void tracing_buffer_handle(uint8_t *data, uint32_t length);
 
+/**
+ * @brief Give tracing buffer of a CPU to backend.
+ *
+ * @param cpu CPU which put the data.
+ * @param data Tracing buffer address.
+ * @param length Tracing buffer length.
+ */
+void tracing_buffer_handle_cpu(uint32_t cpu, uint8_t *data, uint32_t length);
+
 /**
  * @brief Handle tracing packet drop.
  */
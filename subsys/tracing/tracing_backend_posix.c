@@ -4,21 +4,87 @@
  * SPDX-License-Identifier: Apache-2.0
  */
 
+#include <ctype.h>
+#include <stdio.h>
+#include <string.h>
 #include <soc.h>
 #include <cmdline.h>
 #include <tracing_backend.h>
 #include "tracing_backend_posix_bottom.h"
 
-static void *out_stream;
+#define TRACING_POSIX_PATH_MAX 256
+
+static void *out_stream[CONFIG_MP_MAX_NUM_CPUS];
 static const char *file_name;
 
+#ifdef CONFIG_TRACING_BACKEND_POSIX_CTF_METADATA
+static const uint8_t ctf_metadata[] = {
+#include "ctf_metadata.inc"
+};
+
+/* Metadata is written to the directory of the trace file. */
+static void tracing_backend_posix_metadata_write(void)
+{
+	char path[TRACING_POSIX_PATH_MAX];
+	const char *sep = strrchr(file_name, '/');
+	int dir_len = (sep != NULL) ? (sep - file_name + 1) : 0;
+	void *stream;
+
+	if (snprintf(path, sizeof(path), "%.*smetadata", dir_len, file_name) >= (int)sizeof(path)) {
+		return;
+	}
+
+	stream = tracing_backend_posix_init_bottom(path);
+	tracing_backend_posix_output_bottom(ctf_metadata, sizeof(ctf_metadata), stream);
+	tracing_backend_posix_close_bottom(stream);
+}
+#endif
+
+#ifdef CONFIG_TRACING_PER_CPU_BUFFERS
+/* Stream of a CPU replaces the stream number at the end of the file name, so
+ * "channel0_0" is used for CPU 0, "channel0_1" for CPU 1 and so on.
+ */
+static void *tracing_backend_posix_cpu_stream_open(uint32_t cpu)
+{
+	char path[TRACING_POSIX_PATH_MAX];
+	size_t len = strlen(file_name);
+	int ret;
+
+	while ((len > 0) && isdigit((unsigned char)file_name[len - 1])) {
+		len--;
+	}
+
+	if ((len == 0) || (file_name[len - 1] != '_')) {
+		ret = snprintf(path, sizeof(path), "%s_%u", file_name, cpu);
+	} else {
+		ret = snprintf(path, sizeof(path), "%.*s%u", (int)len, file_name, cpu);
+	}
+
+	if (ret >= (int)sizeof(path)) {
+		return NULL;
+	}
+
+	return tracing_backend_posix_init_bottom(path);
+}
+#endif
+
 static void tracing_backend_posix_init(void)
 {
 	if (file_name == NULL) {
 		file_name = "channel0_0";
 	}
 
-	out_stream = tracing_backend_posix_init_bottom(file_name);
+	out_stream[0] = tracing_backend_posix_init_bottom(file_name);
+
+#ifdef CONFIG_TRACING_PER_CPU_BUFFERS
+	for (uint32_t cpu = 1; cpu < ARRAY_SIZE(out_stream); cpu++) {
+		out_stream[cpu] = tracing_backend_posix_cpu_stream_open(cpu);
+	}
+#endif
+
+#ifdef CONFIG_TRACING_BACKEND_POSIX_CTF_METADATA
+	tracing_backend_posix_metadata_write();
+#endif
 }
 
 static void tracing_backend_posix_output(
@@ -27,12 +93,31 @@ static void tracing_backend_posix_output(
 {
 	ARG_UNUSED(backend);
 
-	tracing_backend_posix_output_bottom(data, length, out_stream);
+	tracing_backend_posix_output_bottom(data, length, out_stream[0]);
+}
+
+static void tracing_backend_posix_output_cpu(
+		const struct tracing_backend *backend, uint32_t cpu,
+		uint8_t *data, uint32_t length)
+{
+	void *stream = (cpu < ARRAY_SIZE(out_stream)) ? out_stream[cpu] : NULL;
+
+	ARG_UNUSED(backend);
+
+	/* CPUs whose stream could not be opened share the first one */
+	if (stream == NULL) {
+		stream = out_stream[0];
+	}
+
+	if (stream != NULL) {
+		tracing_backend_posix_output_bottom(data, length, stream);
+	}
 }
 
 const struct tracing_backend_api tracing_backend_posix_api = {
 	.init = tracing_backend_posix_init,
-	.output  = tracing_backend_posix_output
+	.output  = tracing_backend_posix_output,
+	.output_cpu = tracing_backend_posix_output_cpu
 };
 
 TRACING_BACKEND_DEFINE(tracing_backend_posix, tracing_backend_posix_api);
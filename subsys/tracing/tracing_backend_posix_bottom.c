@@ -31,3 +31,8 @@ void tracing_backend_posix_output_bottom(const void *data, unsigned long length,
 
 	fflush((FILE *)out_stream);
 }
+
+void tracing_backend_posix_close_bottom(void *out_stream)
+{
+	fclose((FILE *)out_stream);
+}
@@ -19,6 +19,7 @@ extern "C" {
 
 void *tracing_backend_posix_init_bottom(const char *file_name);
 void tracing_backend_posix_output_bottom(const void *data, unsigned long length, void *out_stream);
+void tracing_backend_posix_close_bottom(void *out_stream);
 
 #ifdef __cplusplus
 }
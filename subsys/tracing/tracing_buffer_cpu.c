@@ -0,0 +1,255 @@
+/*
+ * Copyright (c) 2025 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/* Per-CPU tracing buffers.
+ *
+ * Each CPU is the only producer of its buffer and the tracing thread is the
+ * only consumer, so a packet is put with local interrupts locked and without
+ * any lock shared with other CPUs. Packets are stamped with the cycle counter
+ * and the consumer outputs the oldest packet of all buffers first.
+ *
+ * A packet never wraps around the end of the buffer. If it does not fit in the
+ * remaining space, a wrap marker is put and the packet starts at the beginning
+ * of the buffer.
+ *
+ * In overwrite mode the producer also moves the tail to free space. Consumer
+ * only reads the buffers once tracing is disabled and it waits for producers
+ * which have seen tracing enabled to complete.
+ */
+
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <zephyr/sys/atomic.h>
+#include <zephyr/sys/util.h>
+#include <tracing_core.h>
+#include <tracing_buffer.h>
+
+#define TRACING_PKT_ALIGN 8
+#define TRACING_CPU_BUFFER_SIZE ROUND_DOWN(CONFIG_TRACING_BUFFER_SIZE, TRACING_PKT_ALIGN)
+
+struct tracing_pkt_hdr {
+	/* Cycle counter when packet was put. */
+	uint32_t stamp;
+	uint16_t len;
+	/* Set in the wrap marker, next packet is at the beginning of the buffer. */
+	uint16_t wrap;
+};
+
+BUILD_ASSERT(sizeof(struct tracing_pkt_hdr) == TRACING_PKT_ALIGN);
+
+struct tracing_cpu_buffer {
+	/* Written by the owning CPU. */
+	atomic_t head;
+	/* Written by the tracing thread, and by the owning CPU in overwrite mode. */
+	atomic_t tail;
+	/* Set while the owning CPU puts a packet, used in overwrite mode. */
+	atomic_t busy;
+	uint8_t data[TRACING_CPU_BUFFER_SIZE] __aligned(TRACING_PKT_ALIGN);
+};
+
+static struct tracing_cpu_buffer tracing_cpu_buffers[CONFIG_MP_MAX_NUM_CPUS];
+static uint8_t tracing_cmd_buffer[CONFIG_TRACING_CMD_BUFFER_SIZE];
+
+static inline uint32_t pkt_size(uint32_t len)
+{
+	return ROUND_UP(sizeof(struct tracing_pkt_hdr) + len, TRACING_PKT_ALIGN);
+}
+
+static inline struct tracing_pkt_hdr *pkt_hdr(struct tracing_cpu_buffer *buf, uint32_t idx)
+{
+	return (struct tracing_pkt_hdr *)&buf->data[idx];
+}
+
+/* One alignment unit is always kept free to tell a full buffer from an empty one. */
+static inline uint32_t space_get(uint32_t head, uint32_t tail)
+{
+	if (tail > head) {
+		return tail - head - TRACING_PKT_ALIGN;
+	}
+
+	return TRACING_CPU_BUFFER_SIZE - head + tail - TRACING_PKT_ALIGN;
+}
+
+static uint32_t next_pkt(struct tracing_cpu_buffer *buf, uint32_t idx)
+{
+	struct tracing_pkt_hdr *hdr = pkt_hdr(buf, idx);
+
+	idx = hdr->wrap ? 0 : idx + pkt_size(hdr->len);
+
+	return (idx == TRACING_CPU_BUFFER_SIZE) ? 0 : idx;
+}
+
+uint32_t tracing_cmd_buffer_alloc(uint8_t **data)
+{
+	*data = &tracing_cmd_buffer[0];
+
+	return sizeof(tracing_cmd_buffer);
+}
+
+void tracing_buffer_init(void)
+{
+	for (int i = 0; i < ARRAY_SIZE(tracing_cpu_buffers); i++) {
+		atomic_set(&tracing_cpu_buffers[i].head, 0);
+		atomic_set(&tracing_cpu_buffers[i].tail, 0);
+		atomic_set(&tracing_cpu_buffers[i].busy, 0);
+	}
+}
+
+bool tracing_buffer_is_empty(void)
+{
+	for (int i = 0; i < ARRAY_SIZE(tracing_cpu_buffers); i++) {
+		if (atomic_get(&tracing_cpu_buffers[i].head) !=
+		    atomic_get(&tracing_cpu_buffers[i].tail)) {
+			return false;
+		}
+	}
+
+	return true;
+}
+
+uint32_t tracing_buffer_capacity_get(void)
+{
+	return TRACING_CPU_BUFFER_SIZE - TRACING_PKT_ALIGN;
+}
+
+bool tracing_buffer_cpu_put(const tracing_data_t *data_array, uint32_t count,
+			    bool *before_put_is_empty)
+{
+	struct tracing_cpu_buffer *buf;
+	struct tracing_pkt_hdr *hdr;
+	uint32_t head, tail, size, need;
+	uint32_t len = 0;
+	uint8_t *dst;
+	unsigned int key;
+	bool ret = false;
+
+	for (uint32_t i = 0; i < count; i++) {
+		len += data_array[i].length;
+	}
+
+	*before_put_is_empty = false;
+	if (len == 0) {
+		return true;
+	} else if (len > UINT16_MAX) {
+		return false;
+	}
+
+	size = pkt_size(len);
+
+	key = arch_irq_lock();
+	buf = &tracing_cpu_buffers[_current_cpu->id];
+
+	if (IS_ENABLED(CONFIG_TRACING_OVERFLOW_OVERWRITE)) {
+		atomic_set(&buf->busy, 1);
+		if (!is_tracing_enabled()) {
+			/* Buffers are being output, discard the packet. */
+			ret = true;
+			goto out;
+		}
+	}
+
+	head = atomic_get(&buf->head);
+	tail = atomic_get(&buf->tail);
+	*before_put_is_empty = (head == tail);
+
+	/* Packet which does not fit at the end needs the space up to the end as well. */
+	need = (TRACING_CPU_BUFFER_SIZE - head < size) ?
+	       (TRACING_CPU_BUFFER_SIZE - head + size) : size;
+
+	while (space_get(head, tail) < need) {
+		if (!IS_ENABLED(CONFIG_TRACING_OVERFLOW_OVERWRITE) || (head == tail)) {
+			goto out;
+		}
+
+		if (!pkt_hdr(buf, tail)->wrap) {
+			tracing_packet_drop_handle();
+		}
+		tail = next_pkt(buf, tail);
+		atomic_set(&buf->tail, tail);
+	}
+
+	if (TRACING_CPU_BUFFER_SIZE - head < size) {
+		pkt_hdr(buf, head)->wrap = 1;
+		head = 0;
+	}
+
+	hdr = pkt_hdr(buf, head);
+	hdr->stamp = k_cycle_get_32();
+	hdr->len = len;
+	hdr->wrap = 0;
+
+	dst = (uint8_t *)(hdr + 1);
+	for (uint32_t i = 0; i < count; i++) {
+		memcpy(dst, data_array[i].data, data_array[i].length);
+		dst += data_array[i].length;
+	}
+
+	head += size;
+	if (head == TRACING_CPU_BUFFER_SIZE) {
+		head = 0;
+	}
+
+	/* Publish the packet to the consumer. */
+	atomic_set(&buf->head, head);
+	ret = true;
+
+out:
+	if (IS_ENABLED(CONFIG_TRACING_OVERFLOW_OVERWRITE)) {
+		atomic_set(&buf->busy, 0);
+	}
+	arch_irq_unlock(key);
+
+	return ret;
+}
+
+uint32_t tracing_buffer_cpu_get_claim(uint8_t **data, uint32_t *cpu)
+{
+	struct tracing_pkt_hdr *oldest = NULL;
+
+	for (uint32_t i = 0; i < ARRAY_SIZE(tracing_cpu_buffers); i++) {
+		struct tracing_cpu_buffer *buf = &tracing_cpu_buffers[i];
+		struct tracing_pkt_hdr *hdr;
+		uint32_t tail;
+
+		if (IS_ENABLED(CONFIG_TRACING_OVERFLOW_OVERWRITE)) {
+			while (atomic_get(&buf->busy) != 0) {
+				/* Wait for the packet put on another CPU. */
+			}
+		}
+
+		tail = atomic_get(&buf->tail);
+		if (tail == atomic_get(&buf->head)) {
+			continue;
+		}
+
+		hdr = pkt_hdr(buf, tail);
+		if (hdr->wrap) {
+			/* Packet after the wrap marker is put before head is moved. */
+			atomic_set(&buf->tail, 0);
+			hdr = pkt_hdr(buf, 0);
+		}
+
+		if ((oldest == NULL) || ((int32_t)(hdr->stamp - oldest->stamp) < 0)) {
+			oldest = hdr;
+			*cpu = i;
+		}
+	}
+
+	if (oldest == NULL) {
+		return 0;
+	}
+
+	*data = (uint8_t *)(oldest + 1);
+
+	return oldest->len;
+}
+
+void tracing_buffer_cpu_get_finish(uint32_t cpu)
+{
+	struct tracing_cpu_buffer *buf = &tracing_cpu_buffers[cpu];
+
+	atomic_set(&buf->tail, next_pkt(buf, atomic_get(&buf->tail)));
+}
@@ -54,6 +54,31 @@ static K_SEM_DEFINE(tracing_thread_sem, 0, 1);
 static K_THREAD_STACK_DEFINE(tracing_thread_stack,
 			CONFIG_TRACING_THREAD_STACK_SIZE);
 
+#ifdef CONFIG_TRACING_PER_CPU_BUFFERS
+static void tracing_thread_func(void *dummy1, void *dummy2, void *dummy3)
+{
+	uint8_t *data;
+	uint32_t length, cpu;
+
+	tracing_thread_tid = k_current_get();
+
+	while (true) {
+		/* In overwrite mode buffers are output only once tracing is stopped. */
+		if (IS_ENABLED(CONFIG_TRACING_OVERFLOW_OVERWRITE) && is_tracing_enabled()) {
+			k_sem_take(&tracing_thread_sem, K_FOREVER);
+			continue;
+		}
+
+		length = tracing_buffer_cpu_get_claim(&data, &cpu);
+		if (length == 0) {
+			k_sem_take(&tracing_thread_sem, K_FOREVER);
+		} else {
+			tracing_buffer_handle_cpu(cpu, data, length);
+			tracing_buffer_cpu_get_finish(cpu);
+		}
+	}
+}
+#else
 static void tracing_thread_func(void *dummy1, void *dummy2, void *dummy3)
 {
 	uint8_t *transferring_buf;
@@ -77,6 +102,7 @@ static void tracing_thread_func(void *dummy1, void *dummy2, void *dummy3)
 		}
 	}
 }
+#endif
 
 static void tracing_thread_timer_expiry_fn(struct k_timer *timer)
 {
@@ -87,6 +113,15 @@ static void tracing_thread_timer_expiry_fn(struct k_timer *timer)
 static void tracing_set_state(enum tracing_state state)
 {
 	atomic_set(&tracing_state, state);
+
+#ifdef CONFIG_TRACING_ASYNC
+	/* Output buffered packets right away when tracing is stopped. Thread is
+	 * woken up from the timer as tracing hooks may hold the scheduler lock.
+	 */
+	if ((state == TRACING_DISABLE) && (tracing_thread_tid != NULL)) {
+		k_timer_start(&tracing_thread_timer, K_NO_WAIT, K_NO_WAIT);
+	}
+#endif
 }
 
 static int tracing_init(void)
@@ -156,7 +191,21 @@ void tracing_buffer_handle(uint8_t *data, uint32_t length)
 	tracing_backend_output(working_backend, data, length);
 }
 
+void tracing_buffer_handle_cpu(uint32_t cpu, uint8_t *data, uint32_t length)
+{
+	tracing_backend_output_cpu(working_backend, cpu, data, length);
+}
+
 void tracing_packet_drop_handle(void)
 {
 	atomic_inc(&tracing_packet_drop_num);
+
+	if (IS_ENABLED(CONFIG_TRACING_OVERFLOW_STOP)) {
+		tracing_set_state(TRACING_DISABLE);
+	}
+}
+
+void tracing_flush(void)
+{
+	tracing_set_state(TRACING_DISABLE);
 }
@@ -0,0 +1,66 @@
+/*
+ * Copyright (c) 2025 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#define DISABLE_SYSCALL_TRACING
+
+#include <zephyr/sys/printk.h>
+#include <zephyr/sys/util.h>
+#include <tracing_core.h>
+#include <tracing_buffer.h>
+
+static void tracing_format_cpu_put(const tracing_data_t *tracing_data_array, uint32_t count)
+{
+	bool put_success, before_put_is_empty;
+
+	put_success = tracing_buffer_cpu_put(tracing_data_array, count, &before_put_is_empty);
+
+	if (!put_success) {
+		tracing_packet_drop_handle();
+	} else if (!IS_ENABLED(CONFIG_TRACING_OVERFLOW_OVERWRITE)) {
+		tracing_trigger_output(before_put_is_empty);
+	}
+}
+
+void tracing_format_string(const char *str, ...)
+{
+	uint8_t data[CONFIG_TRACING_PACKET_MAX_SIZE];
+	tracing_data_t tracing_data = { .data = data };
+	va_list args;
+	int length;
+
+	if (!is_tracing_enabled() || is_tracing_thread()) {
+		return;
+	}
+
+	va_start(args, str);
+	length = vsnprintk((char *)data, sizeof(data), str, args);
+	va_end(args);
+
+	/* String is truncated to the packet size, without the terminating null. */
+	tracing_data.length = CLAMP(length, 0, (int)sizeof(data) - 1);
+
+	tracing_format_cpu_put(&tracing_data, 1);
+}
+
+void tracing_format_raw_data(uint8_t *data, uint32_t length)
+{
+	tracing_data_t tracing_data = { .data = data, .length = length };
+
+	if (!is_tracing_enabled() || is_tracing_thread()) {
+		return;
+	}
+
+	tracing_format_cpu_put(&tracing_data, 1);
+}
+
+void tracing_format_data(tracing_data_t *tracing_data_array, uint32_t count)
+{
+	if (!is_tracing_enabled() || is_tracing_thread()) {
+		return;
+	}
+
+	tracing_format_cpu_put(tracing_data_array, count);
+}
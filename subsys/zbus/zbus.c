@@ -52,6 +52,63 @@ static inline struct net_buf *_zbus_create_net_buf(struct net_buf_pool *pool, si
 
 #endif /* CONFIG_ZBUS_MSG_SUBSCRIBER */
 
+#if defined(CONFIG_ZBUS_ASYNC_DISPATCH)
+
+static struct k_spinlock async_slock;
+
+static struct k_work_q async_queues[CONFIG_ZBUS_ASYNC_DISPATCH_THREADS];
+
+static K_THREAD_STACK_ARRAY_DEFINE(async_stacks, CONFIG_ZBUS_ASYNC_DISPATCH_THREADS,
+				   CONFIG_ZBUS_ASYNC_DISPATCH_STACK_SIZE);
+
+/* Work queue serving the next channel switched to asynchronous dispatch */
+static uint8_t async_next_queue;
+
+/* Set once the dispatcher work queues accept work */
+static bool async_started;
+
+K_HEAP_DEFINE(_zbus_async_heap, CONFIG_ZBUS_ASYNC_DISPATCH_HEAP_SIZE);
+
+/* Copy of a message waiting for the dispatcher */
+struct async_msg {
+	sys_snode_t node;
+#if defined(CONFIG_ZBUS_ASYNC_DISPATCH_METRICS)
+	uint32_t publish_cycles;
+#endif /* CONFIG_ZBUS_ASYNC_DISPATCH_METRICS */
+	uint8_t message[];
+};
+
+#if defined(CONFIG_ZBUS_ASYNC_DISPATCH_METRICS)
+ZBUS_CHAN_DEFINE(zbus_async_metrics_chan, struct zbus_async_metrics, NULL, NULL,
+		 ZBUS_OBSERVERS_EMPTY, ZBUS_MSG_INIT(0));
+#endif /* CONFIG_ZBUS_ASYNC_DISPATCH_METRICS */
+
+static void async_queues_start(void)
+{
+	const struct k_work_queue_config cfg = {
+		.name = "zbus_async",
+	};
+
+	for (int i = 0; i < CONFIG_ZBUS_ASYNC_DISPATCH_THREADS; i++) {
+		k_work_queue_start(&async_queues[i], async_stacks[i],
+				   K_THREAD_STACK_SIZEOF(async_stacks[i]),
+				   CONFIG_ZBUS_ASYNC_DISPATCH_PRIORITY, &cfg);
+
+#if defined(CONFIG_ZBUS_ASYNC_DISPATCH_CPU_AFFINITY)
+		/* The CPU mask can only be changed while the thread cannot run */
+		k_thread_suspend(&async_queues[i].thread);
+		(void)k_thread_cpu_pin(&async_queues[i].thread, i % arch_num_cpus());
+		k_thread_resume(&async_queues[i].thread);
+#endif /* CONFIG_ZBUS_ASYNC_DISPATCH_CPU_AFFINITY */
+	}
+
+	K_SPINLOCK(&async_slock) {
+		async_started = true;
+	}
+}
+
+#endif /* CONFIG_ZBUS_ASYNC_DISPATCH */
+
 int _zbus_init(void)
 {
 
@@ -99,6 +156,10 @@ int _zbus_init(void)
 	}
 #endif /* CONFIG_ZBUS_CHANNEL_ID */
 
+#if defined(CONFIG_ZBUS_ASYNC_DISPATCH)
+	async_queues_start();
+#endif /* CONFIG_ZBUS_ASYNC_DISPATCH */
+
 	return 0;
 }
 SYS_INIT(_zbus_init, APPLICATION, CONFIG_ZBUS_CHANNELS_SYS_INIT_PRIORITY);
@@ -374,25 +435,73 @@ static inline void chan_unlock(const struct zbus_channel *chan, int prio)
 #endif /* CONFIG_ZBUS_PRIORITY_BOOST */
 }
 
-int zbus_chan_pub(const struct zbus_channel *chan, const void *msg, k_timeout_t timeout)
+#if defined(CONFIG_ZBUS_ZERO_COPY)
+
+static inline void *zc_buf(const struct zbus_channel *chan, atomic_val_t idx)
 {
-	int err;
+	return (uint8_t *)chan->message + idx * chan->message_size;
+}
 
-	_ZBUS_ASSERT(chan != NULL, "chan is required");
-	_ZBUS_ASSERT(msg != NULL, "msg is required");
-	_ZBUS_ASSERT(k_is_in_isr() ? K_TIMEOUT_EQ(timeout, K_NO_WAIT) : true,
-		     "inside an ISR, the timeout must be K_NO_WAIT");
+static int zc_buf_idx(const struct zbus_channel *chan, const void *msg)
+{
+	ptrdiff_t offset = (const uint8_t *)msg - (const uint8_t *)chan->message;
 
-	if (k_is_in_isr()) {
-		timeout = K_NO_WAIT;
+	if (offset < 0 || ((size_t)offset % chan->message_size) != 0 ||
+	    ((size_t)offset / chan->message_size) >= chan->data->zc_buf_count) {
+		return -EINVAL;
 	}
 
-	k_timepoint_t end_time = sys_timepoint_calc(timeout);
+	return (size_t)offset / chan->message_size;
+}
 
-	if (chan->validator != NULL && !chan->validator(msg, chan->message_size)) {
-		return -ENOMSG;
+/* Find a buffer which is neither the latest message nor borrowed. Only called with the channel
+ * locked, so no other publisher can take it. A reader may still reference it for a moment, but
+ * it then sees the buffer is not the latest message and lets it go again.
+ */
+static int zc_buf_find_free(const struct zbus_channel *chan)
+{
+	struct zbus_channel_data *data = chan->data;
+	atomic_val_t current = atomic_get(&data->zc_current);
+
+	for (int i = 0; i < data->zc_buf_count; i++) {
+		if (i != current && atomic_get(&data->zc_refs[i]) == 0) {
+			return i;
+		}
+	}
+
+	return -ENOBUFS;
+}
+
+#endif /* CONFIG_ZBUS_ZERO_COPY */
+
+static inline int chan_msg_store(const struct zbus_channel *chan, const void *msg)
+{
+#if defined(CONFIG_ZBUS_ZERO_COPY)
+	if (zbus_chan_is_zero_copy(chan)) {
+		int idx = zc_buf_find_free(chan);
+
+		if (idx < 0) {
+			return idx;
+		}
+
+		memcpy(zc_buf(chan, idx), msg, chan->message_size);
+
+		/* Readers only switch to the new message once it is complete */
+		atomic_set(&chan->data->zc_current, idx);
+
+		return 0;
 	}
+#endif /* CONFIG_ZBUS_ZERO_COPY */
+
+	memcpy(chan->message, msg, chan->message_size);
+
+	return 0;
+}
 
+static int chan_publish(const struct zbus_channel *chan, const void *msg, k_timeout_t timeout,
+			k_timepoint_t end_time)
+{
+	int err;
 	int context_priority = ZBUS_MIN_THREAD_PRIORITY;
 
 	err = chan_lock(chan, timeout, &context_priority);
@@ -400,13 +509,18 @@ int zbus_chan_pub(const struct zbus_channel *chan, const void *msg, k_timeout_t
 		return err;
 	}
 
+	err = chan_msg_store(chan, msg);
+	if (err) {
+		chan_unlock(chan, context_priority);
+
+		return err;
+	}
+
 #if defined(CONFIG_ZBUS_CHANNEL_PUBLISH_STATS)
 	chan->data->publish_timestamp = k_uptime_ticks();
 	chan->data->publish_count += 1;
 #endif /* CONFIG_ZBUS_CHANNEL_PUBLISH_STATS */
 
-	memcpy(chan->message, msg, chan->message_size);
-
 	err = _zbus_vded_exec(chan, end_time);
 
 	chan_unlock(chan, context_priority);
@@ -414,6 +528,170 @@ int zbus_chan_pub(const struct zbus_channel *chan, const void *msg, k_timeout_t
 	return err;
 }
 
+#if defined(CONFIG_ZBUS_ASYNC_DISPATCH)
+
+static void async_dispatch(struct k_work *work)
+{
+	struct zbus_channel_data *data = CONTAINER_OF(work, struct zbus_channel_data, async_work);
+	const struct zbus_channel *chan = data->async_chan;
+	struct async_msg *amsg;
+	sys_snode_t *node;
+	uint16_t pending;
+	int err;
+
+	K_SPINLOCK(&async_slock) {
+		node = sys_slist_peek_head(&data->async_msgs);
+	}
+
+	if (node == NULL) {
+		return;
+	}
+
+	amsg = CONTAINER_OF(node, struct async_msg, node);
+
+#if defined(CONFIG_ZBUS_ASYNC_DISPATCH_METRICS)
+	uint32_t start = k_cycle_get_32();
+#endif /* CONFIG_ZBUS_ASYNC_DISPATCH_METRICS */
+
+	err = chan_publish(chan, amsg->message, K_FOREVER,
+			   sys_timepoint_calc(K_MSEC(CONFIG_ZBUS_ASYNC_DISPATCH_TIMEOUT_MS)));
+
+#if defined(CONFIG_ZBUS_ASYNC_DISPATCH_METRICS)
+	uint32_t end = k_cycle_get_32();
+#endif /* CONFIG_ZBUS_ASYNC_DISPATCH_METRICS */
+
+	/* Only dequeued once published, so a synchronous publish cannot overtake it */
+	K_SPINLOCK(&async_slock) {
+		(void)sys_slist_get(&data->async_msgs);
+		pending = --data->async_pending;
+	}
+
+	if (err) {
+		LOG_WRN("Asynchronous dispatch to channel %p failed (%d)", chan, err);
+	}
+
+#if defined(CONFIG_ZBUS_ASYNC_DISPATCH_METRICS)
+	struct zbus_async_metrics metrics = {
+		.chan = chan,
+		.latency_us = k_cyc_to_us_floor32(start - amsg->publish_cycles),
+		.dispatch_us = k_cyc_to_us_floor32(end - start),
+		.count = ++data->async_count,
+		.pending = pending,
+		.err = err,
+	};
+
+	(void)zbus_chan_pub(&zbus_async_metrics_chan, &metrics, K_NO_WAIT);
+#endif /* CONFIG_ZBUS_ASYNC_DISPATCH_METRICS */
+
+	k_heap_free(&_zbus_async_heap, amsg);
+
+	if (pending > 0) {
+		/* One message per run, so a busy channel does not starve the other ones */
+		(void)k_work_submit_to_queue(&async_queues[data->async_queue], work);
+	}
+}
+
+static int async_enqueue(const struct zbus_channel *chan, const void *msg, k_timeout_t timeout)
+{
+	struct zbus_channel_data *data = chan->data;
+	struct async_msg *amsg;
+
+	amsg = k_heap_alloc(&_zbus_async_heap, sizeof(*amsg) + chan->message_size, timeout);
+	if (amsg == NULL) {
+		return -ENOMEM;
+	}
+
+	memcpy(amsg->message, msg, chan->message_size);
+
+#if defined(CONFIG_ZBUS_ASYNC_DISPATCH_METRICS)
+	amsg->publish_cycles = k_cycle_get_32();
+#endif /* CONFIG_ZBUS_ASYNC_DISPATCH_METRICS */
+
+	K_SPINLOCK(&async_slock) {
+		sys_slist_append(&data->async_msgs, &amsg->node);
+		++data->async_pending;
+	}
+
+	int err = k_work_submit_to_queue(&async_queues[data->async_queue], &data->async_work);
+
+	if (err < 0) {
+		/* The work is neither queued nor running, nothing else can use the message */
+		K_SPINLOCK(&async_slock) {
+			(void)sys_slist_find_and_remove(&data->async_msgs, &amsg->node);
+			--data->async_pending;
+		}
+
+		k_heap_free(&_zbus_async_heap, amsg);
+
+		return err;
+	}
+
+	return 0;
+}
+
+int zbus_chan_set_async_dispatch(const struct zbus_channel *chan, bool enabled)
+{
+	_ZBUS_ASSERT(chan != NULL, "chan is required");
+
+#if defined(CONFIG_ZBUS_ASYNC_DISPATCH_METRICS)
+	if (chan == &zbus_async_metrics_chan) {
+		return -EINVAL;
+	}
+#endif /* CONFIG_ZBUS_ASYNC_DISPATCH_METRICS */
+
+	int err = 0;
+
+	K_SPINLOCK(&async_slock) {
+		struct zbus_channel_data *data = chan->data;
+
+		/* Queued messages would never be dispatched */
+		if (enabled && !async_started) {
+			err = -EAGAIN;
+			K_SPINLOCK_BREAK;
+		}
+
+		if (data->async_chan == NULL) {
+			k_work_init(&data->async_work, async_dispatch);
+			data->async_chan = chan;
+			data->async_queue = async_next_queue;
+			async_next_queue = (async_next_queue + 1) % CONFIG_ZBUS_ASYNC_DISPATCH_THREADS;
+		}
+
+		data->async = enabled;
+	}
+
+	return err;
+}
+
+#endif /* CONFIG_ZBUS_ASYNC_DISPATCH */
+
+int zbus_chan_pub(const struct zbus_channel *chan, const void *msg, k_timeout_t timeout)
+{
+	_ZBUS_ASSERT(chan != NULL, "chan is required");
+	_ZBUS_ASSERT(msg != NULL, "msg is required");
+	_ZBUS_ASSERT(k_is_in_isr() ? K_TIMEOUT_EQ(timeout, K_NO_WAIT) : true,
+		     "inside an ISR, the timeout must be K_NO_WAIT");
+
+	if (k_is_in_isr()) {
+		timeout = K_NO_WAIT;
+	}
+
+	k_timepoint_t end_time = sys_timepoint_calc(timeout);
+
+	if (chan->validator != NULL && !chan->validator(msg, chan->message_size)) {
+		return -ENOMSG;
+	}
+
+#if defined(CONFIG_ZBUS_ASYNC_DISPATCH)
+	/* Messages still queued are published first, even when the dispatch was disabled since */
+	if (chan->data->async || chan->data->async_pending > 0) {
+		return async_enqueue(chan, msg, timeout);
+	}
+#endif /* CONFIG_ZBUS_ASYNC_DISPATCH */
+
+	return chan_publish(chan, msg, timeout, end_time);
+}
+
 int zbus_chan_read(const struct zbus_channel *chan, void *msg, k_timeout_t timeout)
 {
 	_ZBUS_ASSERT(chan != NULL, "chan is required");
@@ -425,6 +703,19 @@ int zbus_chan_read(const struct zbus_channel *chan, void *msg, k_timeout_t timeo
 		timeout = K_NO_WAIT;
 	}
 
+#if defined(CONFIG_ZBUS_ZERO_COPY)
+	if (zbus_chan_is_zero_copy(chan)) {
+		const void *latest;
+
+		/* No need to lock, the borrowed message does not change */
+		(void)zbus_chan_borrow(chan, &latest);
+		memcpy(msg, latest, chan->message_size);
+		(void)zbus_chan_release(chan, latest);
+
+		return 0;
+	}
+#endif /* CONFIG_ZBUS_ZERO_COPY */
+
 	int err = k_sem_take(&chan->data->sem, timeout);
 	if (err) {
 		return err;
@@ -465,6 +756,153 @@ int zbus_chan_notify(const struct zbus_channel *chan, k_timeout_t timeout)
 	return err;
 }
 
+#if defined(CONFIG_ZBUS_ZERO_COPY)
+
+int zbus_chan_borrow(const struct zbus_channel *chan, const void **msg)
+{
+	struct zbus_channel_data *data;
+	atomic_val_t idx;
+
+	_ZBUS_ASSERT(chan != NULL, "chan is required");
+	_ZBUS_ASSERT(msg != NULL, "msg is required");
+
+	if (!zbus_chan_is_zero_copy(chan)) {
+		return -ENOTSUP;
+	}
+
+	data = chan->data;
+
+	/* The reference only holds if the buffer was still the latest message after taking it.
+	 * Otherwise a publisher may have picked the buffer as free in between, so retry.
+	 */
+	while (true) {
+		idx = atomic_get(&data->zc_current);
+		atomic_inc(&data->zc_refs[idx]);
+
+		if (atomic_get(&data->zc_current) == idx) {
+			break;
+		}
+
+		atomic_dec(&data->zc_refs[idx]);
+	}
+
+	*msg = zc_buf(chan, idx);
+
+	return 0;
+}
+
+int zbus_chan_release(const struct zbus_channel *chan, const void *msg)
+{
+	int idx;
+
+	_ZBUS_ASSERT(chan != NULL, "chan is required");
+	_ZBUS_ASSERT(msg != NULL, "msg is required");
+
+	if (!zbus_chan_is_zero_copy(chan)) {
+		return -ENOTSUP;
+	}
+
+	idx = zc_buf_idx(chan, msg);
+	if (idx < 0) {
+		return idx;
+	}
+
+	__ASSERT(atomic_get(&chan->data->zc_refs[idx]) > 0, "msg is not borrowed");
+
+	atomic_dec(&chan->data->zc_refs[idx]);
+
+	return 0;
+}
+
+int zbus_chan_loan(const struct zbus_channel *chan, void **msg, k_timeout_t timeout)
+{
+	int context_priority = ZBUS_MIN_THREAD_PRIORITY;
+	int err;
+
+	_ZBUS_ASSERT(!k_is_in_isr(), "zbus_chan_loan cannot be used inside ISRs");
+	_ZBUS_ASSERT(chan != NULL, "chan is required");
+	_ZBUS_ASSERT(msg != NULL, "msg is required");
+
+	if (!zbus_chan_is_zero_copy(chan)) {
+		return -ENOTSUP;
+	}
+
+	err = chan_lock(chan, timeout, &context_priority);
+	if (err) {
+		return err;
+	}
+
+	err = zc_buf_find_free(chan);
+	if (err < 0) {
+		chan_unlock(chan, context_priority);
+
+		return err;
+	}
+
+	chan->data->zc_loan_prio = context_priority;
+	*msg = zc_buf(chan, err);
+
+	return 0;
+}
+
+int zbus_chan_commit(const struct zbus_channel *chan, void *msg, k_timeout_t timeout)
+{
+	int context_priority;
+	int idx;
+	int err;
+
+	_ZBUS_ASSERT(!k_is_in_isr(), "zbus_chan_commit cannot be used inside ISRs");
+	_ZBUS_ASSERT(chan != NULL, "chan is required");
+	_ZBUS_ASSERT(msg != NULL, "msg is required");
+
+	idx = zc_buf_idx(chan, msg);
+	if (idx < 0) {
+		return idx;
+	}
+
+	k_timepoint_t end_time = sys_timepoint_calc(timeout);
+
+	context_priority = chan->data->zc_loan_prio;
+
+	if (chan->validator != NULL && !chan->validator(msg, chan->message_size)) {
+		chan_unlock(chan, context_priority);
+
+		return -ENOMSG;
+	}
+
+#if defined(CONFIG_ZBUS_CHANNEL_PUBLISH_STATS)
+	chan->data->publish_timestamp = k_uptime_ticks();
+	chan->data->publish_count += 1;
+#endif /* CONFIG_ZBUS_CHANNEL_PUBLISH_STATS */
+
+	atomic_set(&chan->data->zc_current, idx);
+
+	err = _zbus_vded_exec(chan, end_time);
+
+	chan_unlock(chan, context_priority);
+
+	return err;
+}
+
+int zbus_chan_loan_cancel(const struct zbus_channel *chan, void *msg)
+{
+	int idx;
+
+	_ZBUS_ASSERT(chan != NULL, "chan is required");
+	_ZBUS_ASSERT(msg != NULL, "msg is required");
+
+	idx = zc_buf_idx(chan, msg);
+	if (idx < 0) {
+		return idx;
+	}
+
+	chan_unlock(chan, chan->data->zc_loan_prio);
+
+	return 0;
+}
+
+#endif /* CONFIG_ZBUS_ZERO_COPY */
+
 int zbus_chan_claim(const struct zbus_channel *chan, k_timeout_t timeout)
 {
 	_ZBUS_ASSERT(chan != NULL, "chan is required");
@@ -475,6 +913,13 @@ int zbus_chan_claim(const struct zbus_channel *chan, k_timeout_t timeout)
 		timeout = K_NO_WAIT;
 	}
 
+#if defined(CONFIG_ZBUS_ZERO_COPY)
+	/* Readers borrow the message without the lock, a claim would let it change under them */
+	if (zbus_chan_is_zero_copy(chan)) {
+		return -ENOTSUP;
+	}
+#endif /* CONFIG_ZBUS_ZERO_COPY */
+
 	int err = k_sem_take(&chan->data->sem, timeout);
 
 	if (err) {
@@ -0,0 +1,135 @@
+/*
+ * Copyright (c) 2025 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @file
+ * @brief Benchmark of packaging of log messages with string arguments
+ *
+ * Measures the cost of creating a log message on the logging fast path and the
+ * cost of the package conversion done for it, with the string arguments
+ * resolved at compile time and with the runtime scanning of the format string.
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+#include <zephyr/logging/log.h>
+#include <zephyr/logging/log_backend.h>
+#include <zephyr/logging/log_ctrl.h>
+#include <zephyr/sys/cbprintf.h>
+
+LOG_MODULE_REGISTER(test, LOG_LEVEL_INF);
+
+#define MSG_CNT 32
+#define ROUNDS 16
+#define CONVERT_CNT 256
+
+static uint32_t total_drops;
+
+static void process(const struct log_backend *const backend, union log_msg_generic *msg)
+{
+}
+
+static void dropped(const struct log_backend *const backend, uint32_t cnt)
+{
+	total_drops += cnt;
+}
+
+static const struct log_backend_api log_backend_bench_api = {
+	.process = process,
+	.dropped = dropped,
+};
+
+LOG_BACKEND_DEFINE(bench_backend, log_backend_bench_api, true);
+
+/* Strings in RAM are copied into the log message. */
+static char str1[] = "sensor";
+static char str2[] = "running";
+static char str3[] = "idle";
+
+static void report(const char *name, uint64_t cycles, uint32_t cnt)
+{
+	TC_PRINT("%-36s: %6u cycles, %6u ns\n", name, (uint32_t)(cycles / cnt),
+		 (uint32_t)(k_cyc_to_ns_floor64(cycles) / cnt));
+}
+
+/* Messages are processed outside of the measured section so buffer never overflows. */
+#define BENCH_LOG(_name, ...) do { \
+	uint64_t _cycles = 0; \
+	for (int _r = 0; _r < ROUNDS; _r++) { \
+		uint32_t _start = k_cycle_get_32(); \
+		for (int _i = 0; _i < MSG_CNT; _i++) { \
+			LOG_INF(__VA_ARGS__); \
+		} \
+		_cycles += k_cycle_get_32() - _start; \
+		while (log_process()) { \
+		} \
+	} \
+	report(_name, _cycles, ROUNDS * MSG_CNT); \
+} while (false)
+
+ZTEST(cbprintf_package_bench, test_log_msg_create)
+{
+	BENCH_LOG("no string", "value %d of %d", 1, 2);
+	BENCH_LOG("one string", "%s: value %d of %d", str1, 1, 2);
+	BENCH_LOG("three strings", "%s: value %d, state %s, next %s", str1, 1, str2, str3);
+	/* Pointer conversion requires the runtime scanning of the format string. */
+	BENCH_LOG("one string, pointer", "%s: value %d at %p", str1, 1, &total_drops);
+	BENCH_LOG("three strings, pointer", "%s: value %p, state %s, next %s",
+		  str1, &total_drops, str2, str3);
+
+	zassert_equal(total_drops, 0, "Unexpected drops: %u", total_drops);
+}
+
+static uint64_t bench_convert(const uint8_t *package, size_t len)
+{
+	static uint8_t __aligned(CBPRINTF_PACKAGE_ALIGNMENT) out[256];
+	/* Same flags as used when a log message is created. */
+	uint32_t flags = CBPRINTF_PACKAGE_CONVERT_RW_STR | CBPRINTF_PACKAGE_CONVERT_PTR_CHECK;
+	uint16_t strl[4];
+	uint32_t start = k_cycle_get_32();
+
+	for (int i = 0; i < CONVERT_CNT; i++) {
+		int clen = cbprintf_package_copy((void *)package, len, NULL, 0,
+						 flags, strl, ARRAY_SIZE(strl));
+
+		zassert_true(clen > 0 && clen <= (int)sizeof(out));
+		clen = cbprintf_package_copy((void *)package, len, out, clen,
+					     flags, strl, ARRAY_SIZE(strl));
+		zassert_true(clen > 0);
+	}
+
+	return k_cycle_get_32() - start;
+}
+
+#define BENCH_CONVERT(_name, _flags, ...) do { \
+	static uint8_t __aligned(CBPRINTF_PACKAGE_ALIGNMENT) _package[128]; \
+	int _len; \
+	CBPRINTF_STATIC_PACKAGE(NULL, 0, _len, 0, \
+				CBPRINTF_PACKAGE_ADD_RW_STR_POS | (_flags), __VA_ARGS__); \
+	zassert_true(_len > 0 && _len <= (int)sizeof(_package)); \
+	CBPRINTF_STATIC_PACKAGE(_package, _len, _len, 0, \
+				CBPRINTF_PACKAGE_ADD_RW_STR_POS | (_flags), __VA_ARGS__); \
+	zassert_true(_len > 0); \
+	report(_name, bench_convert(_package, _len), CONVERT_CNT); \
+} while (false)
+
+ZTEST(cbprintf_package_bench, test_package_convert)
+{
+	if (!IS_ENABLED(CONFIG_CBPRINTF_CONVERT_CHECK_PTR)) {
+		ztest_test_skip();
+	}
+
+	BENCH_CONVERT("convert one string, scan", 0,
+		      "%s: value %d of %d", str1, 1, 2);
+	BENCH_CONVERT("convert one string, resolved", CBPRINTF_PACKAGE_PCHAR_ARGS_ARE_STR,
+		      "%s: value %d of %d", str1, 1, 2);
+	BENCH_CONVERT("convert three strings, scan", 0,
+		      "%s: value %d, state %s, next %s", str1, 1, str2, str3);
+	BENCH_CONVERT("convert three strings, resolved", CBPRINTF_PACKAGE_PCHAR_ARGS_ARE_STR,
+		      "%s: value %d, state %s, next %s", str1, 1, str2, str3);
+}
+
+ZTEST_SUITE(cbprintf_package_bench, NULL, NULL, NULL, NULL, NULL);
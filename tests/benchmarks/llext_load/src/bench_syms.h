@@ -0,0 +1,30 @@
+/*
+ * Copyright (c) 2025 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef BENCH_SYMS_H_
+#define BENCH_SYMS_H_
+
+#include <zephyr/sys/util.h>
+
+/* Functions exported by the application and by the exports extension.
+ * Function n returns n, the imports extension calls all of them from each
+ * of its BENCH_PARTS functions.
+ */
+#define BENCH_BUILTIN_COUNT 256
+#define BENCH_EXT_COUNT     128
+#define BENCH_PARTS         4
+
+#define BENCH_SUM(n) ((n) * ((n) - 1) / 2)
+#define BENCH_EXPECTED \
+	(BENCH_PARTS * (BENCH_SUM(BENCH_BUILTIN_COUNT) + BENCH_SUM(BENCH_EXT_COUNT)))
+
+#define BENCH_BUILTIN_DECLARE(n, _) int bench_builtin_##n(void)
+#define BENCH_EXT_DECLARE(n, _)     int bench_ext_##n(void)
+
+LISTIFY(BENCH_BUILTIN_COUNT, BENCH_BUILTIN_DECLARE, (;));
+LISTIFY(BENCH_EXT_COUNT, BENCH_EXT_DECLARE, (;));
+
+#endif /* BENCH_SYMS_H_ */
@@ -0,0 +1,19 @@
+/*
+ * Copyright (c) 2025 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/* Exports the symbols imported by the imports extension */
+
+#include <zephyr/llext/symbol.h>
+#include "bench_syms.h"
+
+#define BENCH_EXT_DEFINE(n, _)              \
+	int bench_ext_##n(void)             \
+	{                                   \
+		return n;                   \
+	}                                   \
+	EXPORT_SYMBOL(bench_ext_##n)
+
+LISTIFY(BENCH_EXT_COUNT, BENCH_EXT_DEFINE, (;));
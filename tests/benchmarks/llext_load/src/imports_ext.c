@@ -0,0 +1,38 @@
+/*
+ * Copyright (c) 2025 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/* Each call is a relocation against a symbol of the application or of the
+ * exports extension, that is resolved when this extension is loaded.
+ */
+
+#include <zephyr/llext/symbol.h>
+#include "bench_syms.h"
+
+#define BENCH_CALL_BUILTIN(n, _) sum += bench_builtin_##n()
+#define BENCH_CALL_EXT(n, _)     sum += bench_ext_##n()
+
+#define BENCH_PART_DEFINE(p)                                            \
+	static int bench_part_##p(void)                                 \
+	{                                                               \
+		int sum = 0;                                            \
+									\
+		LISTIFY(BENCH_BUILTIN_COUNT, BENCH_CALL_BUILTIN, (;));  \
+		LISTIFY(BENCH_EXT_COUNT, BENCH_CALL_EXT, (;));          \
+		return sum;                                             \
+	}
+
+BENCH_PART_DEFINE(0)
+BENCH_PART_DEFINE(1)
+BENCH_PART_DEFINE(2)
+BENCH_PART_DEFINE(3)
+
+BUILD_ASSERT(BENCH_PARTS == 4);
+
+int bench_entry(void)
+{
+	return bench_part_0() + bench_part_1() + bench_part_2() + bench_part_3();
+}
+EXPORT_SYMBOL(bench_entry);
@@ -0,0 +1,116 @@
+/*
+ * Copyright (c) 2025 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/* Load time of an extension with about 1.5k relocations against symbols of
+ * the application and of another extension. The application exports a few
+ * hundred symbols on top of the kernel ones, so that the cost of the symbol
+ * lookups stands out. With the load cache, only the first load processes the
+ * ELF file and the following ones are taken from the cache.
+ */
+
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+#include <zephyr/llext/llext.h>
+#include <zephyr/llext/buf_loader.h>
+#include <zephyr/llext/symbol.h>
+#include "bench_syms.h"
+
+#define BENCH_LOAD_ROUNDS 16
+
+#define BENCH_BUILTIN_DEFINE(n, _)          \
+	int bench_builtin_##n(void)         \
+	{                                   \
+		return n;                   \
+	}                                   \
+	EXPORT_SYMBOL(bench_builtin_##n)
+
+LISTIFY(BENCH_BUILTIN_COUNT, BENCH_BUILTIN_DEFINE, (;));
+
+#ifdef CONFIG_LLEXT_STORAGE_WRITABLE
+#define LLEXT_CONST
+#else
+#define LLEXT_CONST const
+#endif
+
+static LLEXT_CONST uint8_t exports_ext[] __aligned(4) = {
+#include "exports.inc"
+};
+
+static const uint8_t imports_elf[] __aligned(4) = {
+#include "imports.inc"
+};
+
+#ifdef CONFIG_LLEXT_STORAGE_WRITABLE
+/* Writable storage is relocated in place, so it is restored before each load */
+static uint8_t imports_ext[sizeof(imports_elf)] __aligned(4);
+#else
+#define imports_ext imports_elf
+#endif
+
+ZTEST(llext_load, test_load_time)
+{
+	struct llext_buf_loader exports_loader = LLEXT_BUF_LOADER(exports_ext,
+								  sizeof(exports_ext));
+	struct llext_load_param ldr_parm = LLEXT_LOAD_PARAM_DEFAULT;
+	struct llext *exports = NULL;
+	uint32_t first_us = 0U;
+	uint32_t total_us = 0U;
+	uint32_t max_us = 0U;
+	size_t heap_size = 0U;
+	int res;
+
+	res = llext_load(&exports_loader.loader, "exports", &exports, &ldr_parm);
+	zassert_ok(res, "Loading exports extension failed: %d", res);
+
+	/* Cached extensions must not depend on the ELF buffer */
+	ldr_parm.cache = IS_ENABLED(CONFIG_LLEXT_LOAD_CACHE);
+
+	for (int i = 0; i < BENCH_LOAD_ROUNDS; i++) {
+#ifdef CONFIG_LLEXT_LOAD_CACHE
+		struct llext_buf_loader imports_loader =
+			LLEXT_TEMPORARY_BUF_LOADER(imports_ext, sizeof(imports_ext));
+#else
+		struct llext_buf_loader imports_loader = LLEXT_BUF_LOADER(imports_ext,
+									  sizeof(imports_ext));
+#endif
+		struct llext *imports = NULL;
+		int (*entry)(void);
+		uint32_t start;
+		uint32_t us;
+
+		if (IS_ENABLED(CONFIG_LLEXT_STORAGE_WRITABLE)) {
+			memcpy((void *)imports_ext, imports_elf, sizeof(imports_elf));
+		}
+
+		start = k_cycle_get_32();
+		res = llext_load(&imports_loader.loader, "imports", &imports, &ldr_parm);
+		us = k_cyc_to_us_floor32(k_cycle_get_32() - start);
+		zassert_ok(res, "Loading imports extension failed: %d", res);
+
+		if (i == 0) {
+			first_us = us;
+		}
+		total_us += us;
+		max_us = MAX(max_us, us);
+
+		entry = llext_find_sym(&imports->exp_tab, "bench_entry");
+		zassert_not_null(entry, "bench_entry should be an exported symbol");
+		zassert_equal(entry(), BENCH_EXPECTED, "Wrong symbol resolved");
+
+		heap_size = imports->alloc_size;
+
+		llext_unload(&imports);
+	}
+
+	TC_PRINT("Load first: %u us, average: %u us, max: %u us, heap usage: %zu bytes\n",
+		 first_us, total_us / BENCH_LOAD_ROUNDS, max_us, heap_size);
+
+	llext_unload(&exports);
+	llext_cache_flush();
+}
+
+ZTEST_SUITE(llext_load, NULL, NULL, NULL, NULL, NULL);
@@ -0,0 +1,237 @@
+/*
+ * Copyright (c) 2025 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/* Time needed to turn a full ICM42688 FIFO, as streamed at 8 kHz, into float
+ * accelerometer readings. The per frame decode() into an array of structures is
+ * compared with sensor_decode_bulk(), both through the driver's own bulk decoder
+ * and through the generic fallback that every other decoder uses.
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+#include <zephyr/drivers/sensor.h>
+
+#include "icm42688_decoder.h"
+#include "icm42688_reg.h"
+
+#define TEST_FRAME_SIZE  16
+/* fifo_count of the decoder header is 11 bits */
+#define TEST_FRAME_COUNT 127
+#define TEST_ROUNDS      256
+
+static const struct device *const dev = DEVICE_DT_GET(DT_NODELABEL(icm42688));
+static const struct sensor_decoder_api *decoder;
+
+static uint8_t fifo[sizeof(struct icm42688_fifo_data) + TEST_FRAME_COUNT * TEST_FRAME_SIZE]
+	__aligned(8);
+
+static uint8_t aos[sizeof(struct sensor_three_axis_data) +
+		   (TEST_FRAME_COUNT - 1) * sizeof(struct sensor_three_axis_sample_data)]
+	__aligned(8);
+
+/* Reference decoded by decode() */
+static uint32_t ref_delta[TEST_FRAME_COUNT];
+static q31_t ref_values[3][TEST_FRAME_COUNT];
+static int8_t ref_shift;
+
+static uint32_t delta[TEST_FRAME_COUNT];
+static q31_t values[3][TEST_FRAME_COUNT];
+static float values_f[3][TEST_FRAME_COUNT];
+
+static void fill_fifo(void)
+{
+	struct icm42688_fifo_data *edata = (struct icm42688_fifo_data *)fifo;
+	uint8_t *frame = fifo + sizeof(*edata);
+
+	memset(fifo, 0, sizeof(fifo));
+	edata->header.timestamp = 1000000;
+	edata->header.is_fifo = 1;
+	edata->header.accel_fs = ICM42688_DT_ACCEL_FS_16;
+	edata->header.gyro_fs = ICM42688_DT_GYRO_FS_2000;
+	edata->accel_odr = ICM42688_DT_ACCEL_ODR_8000;
+	edata->gyro_odr = ICM42688_DT_GYRO_ODR_8000;
+	edata->fifo_count = TEST_FRAME_COUNT * TEST_FRAME_SIZE;
+
+	for (int i = 0; i < TEST_FRAME_COUNT; i++, frame += TEST_FRAME_SIZE) {
+		frame[0] = FIFO_HEADER_ACCEL | FIFO_HEADER_GYRO;
+		/* Accel and gyro samples, big endian */
+		for (int b = 1; b < 13; b++) {
+			frame[b] = (uint8_t)(i * 31 + b * 7);
+		}
+		/* Temperature */
+		frame[13] = 25;
+	}
+}
+
+static uint32_t ns_per_frame(uint32_t cycles)
+{
+	return (uint32_t)(k_cyc_to_ns_floor64(cycles) / (TEST_ROUNDS * TEST_FRAME_COUNT));
+}
+
+static void decode_aos(bool to_float)
+{
+	struct sensor_decode_context ctx =
+		SENSOR_DECODE_CONTEXT_INIT(decoder, fifo, SENSOR_CHAN_ACCEL_XYZ, 0);
+	struct sensor_three_axis_data *data = (struct sensor_three_axis_data *)aos;
+	int rc;
+
+	rc = sensor_decode(&ctx, data, TEST_FRAME_COUNT);
+	zassert_equal(rc, TEST_FRAME_COUNT, "Decoded %d frames", rc);
+
+	if (!to_float) {
+		return;
+	}
+
+	for (int i = 0; i < TEST_FRAME_COUNT; i++) {
+		for (int axis = 0; axis < 3; axis++) {
+			values_f[axis][i] = (float)data->readings[i].values[axis] /
+					    (float)(INT64_C(1) << (31 - data->shift));
+		}
+	}
+}
+
+static void decode_bulk(const struct sensor_decoder_api *api, bool to_float)
+{
+	struct sensor_decode_context ctx =
+		SENSOR_DECODE_CONTEXT_INIT(api, fifo, SENSOR_CHAN_ACCEL_XYZ, 0);
+	struct sensor_bulk_data out = {0};
+	int total = 0;
+	int rc;
+
+	/* The generic fallback may need several calls */
+	do {
+		out.timestamp_delta = &delta[total];
+		for (int axis = 0; axis < 3; axis++) {
+			out.values[axis] = &values[axis][total];
+		}
+		rc = sensor_decode_bulk(&ctx, &out, TEST_FRAME_COUNT - total);
+		zassert_true(rc >= 0, "Bulk decode failed: %d", rc);
+		total += rc;
+	} while (rc > 0 && total < TEST_FRAME_COUNT);
+
+	zassert_equal(total, TEST_FRAME_COUNT, "Decoded %d frames", total);
+
+	if (!to_float) {
+		return;
+	}
+
+	for (int axis = 0; axis < 3; axis++) {
+		sensor_q31_to_float_array(values[axis], out.shift, values_f[axis],
+					  TEST_FRAME_COUNT);
+	}
+}
+
+static void check_bulk(const struct sensor_decoder_api *api)
+{
+	struct sensor_decode_context ctx =
+		SENSOR_DECODE_CONTEXT_INIT(api, fifo, SENSOR_CHAN_ACCEL_XYZ, 0);
+	struct sensor_bulk_data out = {
+		.timestamp_delta = delta,
+		.values = {values[0], values[1], values[2]},
+	};
+	int rc;
+
+	memset(values, 0, sizeof(values));
+	memset(delta, 0, sizeof(delta));
+
+	rc = sensor_decode_bulk(&ctx, &out, TEST_FRAME_COUNT);
+	zassert_equal(rc, TEST_FRAME_COUNT, "Decoded %d frames", rc);
+	zassert_equal(out.base_timestamp_ns, 1000000);
+	zassert_equal(out.shift, ref_shift);
+	zassert_mem_equal(delta, ref_delta, sizeof(delta));
+	zassert_mem_equal(values, ref_values, sizeof(values));
+
+	/* Everything was decoded */
+	rc = sensor_decode_bulk(&ctx, &out, TEST_FRAME_COUNT);
+	zassert_equal(rc, 0, "Decoded %d frames past the end", rc);
+}
+
+ZTEST(sensor_decode, test_bulk_matches_decode)
+{
+	struct sensor_decoder_api generic = *decoder;
+
+	generic.decode_bulk = NULL;
+
+	check_bulk(decoder);
+	check_bulk(&generic);
+}
+
+ZTEST(sensor_decode, test_bulk_to_float)
+{
+	const struct sensor_three_axis_data *data = (const struct sensor_three_axis_data *)aos;
+
+	decode_bulk(decoder, true);
+
+	for (int i = 0; i < TEST_FRAME_COUNT; i++) {
+		for (int axis = 0; axis < 3; axis++) {
+			float expected = (float)data->readings[i].values[axis] /
+					 (float)(INT64_C(1) << (31 - data->shift));
+
+			zassert_within(values_f[axis][i], expected, 1e-3f,
+				       "Frame %d axis %d converted to %f, expected %f", i, axis,
+				       (double)values_f[axis][i], (double)expected);
+		}
+	}
+}
+
+ZTEST(sensor_decode, test_decode_latency)
+{
+	struct sensor_decoder_api generic = *decoder;
+	uint32_t start, aos_cyc, native_cyc, generic_cyc;
+
+	generic.decode_bulk = NULL;
+
+	for (int to_float = 0; to_float < 2; to_float++) {
+		start = k_cycle_get_32();
+		for (int i = 0; i < TEST_ROUNDS; i++) {
+			decode_aos(to_float);
+		}
+		aos_cyc = k_cycle_get_32() - start;
+
+		start = k_cycle_get_32();
+		for (int i = 0; i < TEST_ROUNDS; i++) {
+			decode_bulk(decoder, to_float);
+		}
+		native_cyc = k_cycle_get_32() - start;
+
+		start = k_cycle_get_32();
+		for (int i = 0; i < TEST_ROUNDS; i++) {
+			decode_bulk(&generic, to_float);
+		}
+		generic_cyc = k_cycle_get_32() - start;
+
+		TC_PRINT("%s, ns per frame: decode %u, bulk %u, bulk fallback %u\n",
+			 to_float ? "q31 to float" : "q31", ns_per_frame(aos_cyc),
+			 ns_per_frame(native_cyc), ns_per_frame(generic_cyc));
+	}
+}
+
+static void *sensor_decode_setup(void)
+{
+	const struct sensor_three_axis_data *data = (const struct sensor_three_axis_data *)aos;
+	int rc;
+
+	zassert_true(device_is_ready(dev), "Sensor not ready");
+
+	rc = sensor_get_decoder(dev, &decoder);
+	zassert_equal(rc, 0, "Getting the decoder failed: %d", rc);
+	zassert_not_null(decoder->decode_bulk);
+
+	fill_fifo();
+
+	decode_aos(false);
+	ref_shift = data->shift;
+	for (int i = 0; i < TEST_FRAME_COUNT; i++) {
+		ref_delta[i] = data->readings[i].timestamp_delta;
+		for (int axis = 0; axis < 3; axis++) {
+			ref_values[axis][i] = data->readings[i].values[axis];
+		}
+	}
+
+	return NULL;
+}
+
+ZTEST_SUITE(sensor_decode, NULL, sensor_decode_setup, NULL, NULL, NULL);
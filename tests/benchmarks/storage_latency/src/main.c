@@ -0,0 +1,271 @@
+/*
+ * Copyright (c) 2025 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/* Latency of many small record writes to NVS or ZMS on the flash simulator.
+ * The writes are spread over a few IDs so that the sectors fill up and garbage
+ * collection runs regularly. The test thread sleeps now and then, which leaves
+ * idle time to background garbage collection when it is enabled.
+ * The latency of reads of stored and missing IDs and of a mount is measured as
+ * well, which is what the lookup cache and index speed up.
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+#include <zephyr/drivers/flash.h>
+#include <zephyr/storage/flash_map.h>
+
+#if defined(CONFIG_NVS)
+#include <zephyr/fs/nvs.h>
+#elif defined(CONFIG_ZMS)
+#include <zephyr/fs/zms.h>
+#endif
+
+#define TEST_PARTITION        storage_partition
+#define TEST_PARTITION_OFFSET FIXED_PARTITION_OFFSET(TEST_PARTITION)
+#define TEST_PARTITION_DEV    FIXED_PARTITION_DEVICE(TEST_PARTITION)
+
+#define TEST_SECTOR_COUNT 8
+#define TEST_ID_COUNT     16
+#define TEST_WRITE_COUNT  2048
+#define TEST_IDLE_PERIOD  16
+#define TEST_HIST_BUCKETS 16
+#define TEST_READ_ROUNDS  64
+
+struct test_record {
+	uint32_t seq;
+	uint8_t payload[12];
+};
+
+#if defined(CONFIG_NVS)
+static struct nvs_fs fs;
+
+static int storage_mount(void)
+{
+	return nvs_mount(&fs);
+}
+
+static int storage_clear(void)
+{
+	return nvs_clear(&fs);
+}
+
+static ssize_t storage_write(uint16_t id, const void *data, size_t len)
+{
+	return nvs_write(&fs, id, data, len);
+}
+
+static ssize_t storage_read(uint16_t id, void *data, size_t len)
+{
+	return nvs_read(&fs, id, data, len);
+}
+
+static int storage_flush(void)
+{
+	return nvs_flush(&fs);
+}
+#elif defined(CONFIG_ZMS)
+static struct zms_fs fs;
+
+static int storage_mount(void)
+{
+	return zms_mount(&fs);
+}
+
+static int storage_clear(void)
+{
+	return zms_clear(&fs);
+}
+
+static ssize_t storage_write(uint16_t id, const void *data, size_t len)
+{
+	return zms_write(&fs, id, data, len);
+}
+
+static ssize_t storage_read(uint16_t id, void *data, size_t len)
+{
+	return zms_read(&fs, id, data, len);
+}
+
+static int storage_flush(void)
+{
+	return zms_flush(&fs);
+}
+#endif
+
+/* Bucket i counts the latencies in [2^(i-1), 2^i) us, the last one everything above. */
+static uint32_t hist[TEST_HIST_BUCKETS];
+
+static void hist_add(uint32_t us)
+{
+	uint32_t bucket = (us == 0U) ? 0U : (LOG2(us) + 1U);
+
+	hist[MIN(bucket, TEST_HIST_BUCKETS - 1U)]++;
+}
+
+static void hist_print(const char *name)
+{
+	TC_PRINT("%s latency histogram:\n", name);
+	for (uint32_t i = 0; i < TEST_HIST_BUCKETS; i++) {
+		if (hist[i] == 0U) {
+			continue;
+		}
+		if (i == TEST_HIST_BUCKETS - 1U) {
+			TC_PRINT("  >= %6u us: %u\n", (uint32_t)BIT(i - 1U), hist[i]);
+		} else {
+			TC_PRINT("  <  %6u us: %u\n", (uint32_t)BIT(i), hist[i]);
+		}
+	}
+}
+
+static void verify_records(void)
+{
+	for (uint16_t id = 0; id < TEST_ID_COUNT; id++) {
+		struct test_record rec;
+		ssize_t len;
+
+		len = storage_read(id, &rec, sizeof(rec));
+		zassert_equal(len, sizeof(rec), "Reading ID %u failed: %d", id, (int)len);
+		zassert_equal(rec.seq, TEST_WRITE_COUNT - TEST_ID_COUNT + id,
+			      "Unexpected record %u for ID %u", rec.seq, id);
+	}
+}
+
+ZTEST(storage_latency, test_write_latency)
+{
+	struct test_record rec;
+	uint32_t total_us = 0U;
+	uint32_t max_us = 0U;
+	uint32_t start;
+	int err;
+
+	memset(hist, 0, sizeof(hist));
+	memset(rec.payload, 0xa5, sizeof(rec.payload));
+
+	for (uint32_t i = 0; i < TEST_WRITE_COUNT; i++) {
+		ssize_t len;
+		uint32_t us;
+
+		rec.seq = i;
+
+		start = k_cycle_get_32();
+		len = storage_write(i % TEST_ID_COUNT, &rec, sizeof(rec));
+		us = k_cyc_to_us_floor32(k_cycle_get_32() - start);
+
+		zassert_equal(len, sizeof(rec), "Write %u failed: %d", i, (int)len);
+
+		hist_add(us);
+		total_us += us;
+		max_us = MAX(max_us, us);
+
+		if ((i % TEST_IDLE_PERIOD) == (TEST_IDLE_PERIOD - 1U)) {
+			k_msleep(1);
+		}
+	}
+
+	start = k_cycle_get_32();
+	err = storage_flush();
+	zassert_equal(err, 0, "Flush failed: %d", err);
+
+	hist_print("Write");
+	TC_PRINT("Write average: %u us, max: %u us, final flush: %u us\n",
+		 total_us / TEST_WRITE_COUNT, max_us,
+		 k_cyc_to_us_floor32(k_cycle_get_32() - start));
+
+	verify_records();
+
+	/* Written records survive a remount */
+	err = storage_mount();
+	zassert_equal(err, 0, "Remount failed: %d", err);
+	verify_records();
+}
+
+ZTEST(storage_latency, test_read_latency)
+{
+	struct test_record rec;
+	uint32_t total_us = 0U;
+	uint32_t max_us = 0U;
+	uint32_t start;
+	uint32_t reads = 0U;
+	int err;
+
+	memset(hist, 0, sizeof(hist));
+	memset(rec.payload, 0x5a, sizeof(rec.payload));
+
+	for (uint16_t id = 0; id < TEST_ID_COUNT; id++) {
+		ssize_t len;
+
+		rec.seq = TEST_WRITE_COUNT - TEST_ID_COUNT + id;
+		len = storage_write(id, &rec, sizeof(rec));
+		zassert_true(len >= 0, "Write of ID %u failed: %d", id, (int)len);
+	}
+
+	err = storage_flush();
+	zassert_equal(err, 0, "Flush failed: %d", err);
+
+	/* Every other read is of an ID that was never written */
+	for (uint32_t i = 0; i < TEST_READ_ROUNDS * TEST_ID_COUNT * 2U; i++) {
+		uint16_t id = (i / 2U) % TEST_ID_COUNT;
+		ssize_t len;
+		uint32_t us;
+
+		if ((i % 2U) == 1U) {
+			id += TEST_ID_COUNT;
+		}
+
+		start = k_cycle_get_32();
+		len = storage_read(id, &rec, sizeof(rec));
+		us = k_cyc_to_us_floor32(k_cycle_get_32() - start);
+
+		if (id < TEST_ID_COUNT) {
+			zassert_equal(len, sizeof(rec), "Reading ID %u failed: %d", id, (int)len);
+		} else {
+			zassert_equal(len, -ENOENT, "Missing ID %u found: %d", id, (int)len);
+		}
+
+		hist_add(us);
+		total_us += us;
+		max_us = MAX(max_us, us);
+		reads++;
+	}
+
+	hist_print("Read");
+	TC_PRINT("Read average: %u us, max: %u us\n", total_us / reads, max_us);
+
+	start = k_cycle_get_32();
+	err = storage_mount();
+	zassert_equal(err, 0, "Remount failed: %d", err);
+	TC_PRINT("Mount: %u us\n", k_cyc_to_us_floor32(k_cycle_get_32() - start));
+
+	verify_records();
+}
+
+static void *storage_latency_setup(void)
+{
+	struct flash_pages_info info;
+	int err;
+
+	fs.offset = TEST_PARTITION_OFFSET;
+	fs.flash_device = TEST_PARTITION_DEV;
+	zassert_true(device_is_ready(fs.flash_device), "Flash device not ready");
+
+	err = flash_get_page_info_by_offs(fs.flash_device, fs.offset, &info);
+	zassert_equal(err, 0, "Unable to get page info: %d", err);
+
+	fs.sector_size = info.size;
+	fs.sector_count = TEST_SECTOR_COUNT;
+
+	/* Start from an empty storage */
+	err = storage_mount();
+	zassert_equal(err, 0, "Mount failed: %d", err);
+	err = storage_clear();
+	zassert_equal(err, 0, "Clear failed: %d", err);
+	err = storage_mount();
+	zassert_equal(err, 0, "Mount failed: %d", err);
+
+	return NULL;
+}
+
+ZTEST_SUITE(storage_latency, NULL, storage_latency_setup, NULL, NULL, NULL);
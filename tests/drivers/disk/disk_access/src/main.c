@@ -275,6 +275,80 @@ ZTEST(disk_driver, test_write)
 	}
 }
 
+#ifdef CONFIG_DISK_CACHE_STATS
+/* Test read-ahead of sequential reads and deferred write-back of the block cache */
+ZTEST(disk_driver, test_cache)
+{
+	struct disk_cache_stats stats;
+	uint32_t start = disk_sector_count / 4;
+	bool force = true;
+	int rc, i;
+
+	/* Restart the disk to begin with an empty cache */
+	rc = disk_access_ioctl(disk_pdrv, DISK_IOCTL_CTRL_DEINIT, &force);
+	zassert_equal(rc, 0, "Disk deinit failed");
+	rc = disk_access_init(disk_pdrv);
+	zassert_equal(rc, 0, "Disk access initialization failed");
+	disk_access_cache_stats_reset();
+
+	/* Second read continues the first one and is read ahead */
+	for (i = 0; i < 4; i++) {
+		rc = read_sector(scratch_buf[0], start + i, 1);
+		zassert_equal(rc, 0, "Failed to read from disk");
+	}
+
+	disk_access_cache_stats_get(&stats);
+	zassert_equal(stats.read_misses, 2, "Unexpected read misses %u", stats.read_misses);
+	zassert_equal(stats.read_hits, 2, "Unexpected read hits %u", stats.read_hits);
+	zassert_equal(stats.read_ahead, CONFIG_DISK_CACHE_RUN_SECTORS - 1,
+		      "Unexpected read-ahead %u", stats.read_ahead);
+
+	/* Reading cached sectors again is served from the cache */
+	memset(scratch_buf[1], 0xff, disk_sector_size);
+	rc = read_sector(scratch_buf[1], start, 1);
+	zassert_equal(rc, 0, "Failed to read from disk");
+	disk_access_cache_stats_get(&stats);
+	zassert_equal(stats.read_hits, 3, "Unexpected read hits %u", stats.read_hits);
+
+	/* Consecutive writes are written back together on sync */
+	for (i = 0; i < 2; i++) {
+		memset(scratch_buf[0], i + 1, disk_sector_size);
+		rc = disk_access_write(disk_pdrv, scratch_buf[0], start + i, 1);
+		zassert_equal(rc, 0, "Failed to write to disk");
+	}
+
+	disk_access_cache_stats_get(&stats);
+	if (IS_ENABLED(CONFIG_DISK_CACHE_WRITE_BACK)) {
+		zassert_equal(stats.write_backs, 0, "Write back before sync");
+	}
+
+	rc = disk_access_ioctl(disk_pdrv, DISK_IOCTL_CTRL_SYNC, NULL);
+	zassert_equal(rc, 0, "Disk sync failed");
+
+	disk_access_cache_stats_get(&stats);
+	if (IS_ENABLED(CONFIG_DISK_CACHE_WRITE_BACK)) {
+		zassert_equal(stats.write_backs, 1, "Unexpected write backs %u",
+			      stats.write_backs);
+		zassert_equal(stats.write_back_sectors, 2, "Unexpected written back sectors %u",
+			      stats.write_back_sectors);
+	}
+
+	/* Written data is read back from the disk once the cache is dropped */
+	rc = disk_access_ioctl(disk_pdrv, DISK_IOCTL_CTRL_DEINIT, &force);
+	zassert_equal(rc, 0, "Disk deinit failed");
+	rc = disk_access_init(disk_pdrv);
+	zassert_equal(rc, 0, "Disk access initialization failed");
+
+	for (i = 0; i < 2; i++) {
+		memset(scratch_buf[0], i + 1, disk_sector_size);
+		rc = read_sector(scratch_buf[1], start + i, 1);
+		zassert_equal(rc, 0, "Failed to read from disk");
+		zassert_mem_equal(scratch_buf[0], scratch_buf[1], disk_sector_size,
+				  "Read data did not match data written to disk");
+	}
+}
+#endif /* CONFIG_DISK_CACHE_STATS */
+
 static void *disk_driver_setup(void)
 {
 #ifdef CONFIG_DISK_DRIVER_LOOPBACK
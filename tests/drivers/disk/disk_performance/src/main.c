@@ -18,6 +18,9 @@
 #define DISK_NAME "SD2"
 #elif defined(CONFIG_NVME)
 #define DISK_NAME "nvme0n0"
+#elif defined(CONFIG_DISK_DRIVER_RAM)
+/* Ramdisk is checked last to not override other backends. */
+#define DISK_NAME "RAM"
 #else
 #error "No disk device defined, is your board supported?"
 #endif
@@ -135,6 +138,50 @@ ZTEST(disk_performance, test_sequential_read)
 		((BUF_SIZE) * (NSEC_PER_SEC / time_ns)) / 1024);
 }
 
+/* Time a sequential read issued one sector at a time, as done by file systems. */
+ZTEST(disk_performance, test_sequential_sector_read)
+{
+	timing_t start_time, end_time;
+	uint64_t cycles, total_ns;
+	int rc;
+
+	if (!disk_init_done) {
+		zassert_unreachable("Disk is not initialized");
+	}
+
+#ifdef CONFIG_DISK_CACHE_STATS
+	disk_access_cache_stats_reset();
+#endif
+
+	timing_init();
+	timing_start();
+
+	start_time = timing_counter_get();
+	for (int i = 0; i < SEQ_BLOCK_COUNT; i++) {
+		rc = disk_access_read(disk_pdrv, &test_buf[i * SECTOR_SIZE], i, 1);
+		if (rc != 0) {
+			break;
+		}
+	}
+	end_time = timing_counter_get();
+	zassert_equal(rc, 0, "disk read failed");
+	cycles = timing_cycles_get(&start_time, &end_time);
+	total_ns = timing_cycles_to_ns(cycles);
+	timing_stop();
+
+	TC_PRINT("Average read speed over %d single sector reads: %"PRIu64" KiB/s\n",
+		SEQ_BLOCK_COUNT,
+		((BUF_SIZE) * (NSEC_PER_SEC / total_ns)) / 1024);
+
+#ifdef CONFIG_DISK_CACHE_STATS
+	struct disk_cache_stats stats;
+
+	disk_access_cache_stats_get(&stats);
+	TC_PRINT("Cache: %u hits, %u misses, %u sectors read ahead\n",
+		stats.read_hits, stats.read_misses, stats.read_ahead);
+#endif
+}
+
 /* Helper function to time multiple sequential writes. Returns average time. */
 static uint64_t write_helper(uint32_t num_blocks)
 {
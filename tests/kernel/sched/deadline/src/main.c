@@ -321,4 +321,114 @@ ZTEST(suite_deadline, test_thread_reschedule)
 }
 #endif /* CONFIG_MP_MAX_NUM_CPUS == 1 */
 
+#ifdef CONFIG_SCHED_DEADLINE_CBS
+ZTEST(suite_deadline, test_cbs_admission)
+{
+	k_tid_t t0 = &worker_threads[0], t1 = &worker_threads[1];
+
+	k_thread_create(t0, worker_stacks[0], STACK_SIZE, worker,
+			INT_TO_POINTER(0), NULL, NULL,
+			K_LOWEST_APPLICATION_THREAD_PRIO, 0, K_FOREVER);
+	k_thread_create(t1, worker_stacks[1], STACK_SIZE, worker,
+			INT_TO_POINTER(1), NULL, NULL,
+			K_LOWEST_APPLICATION_THREAD_PRIO, 0, K_FOREVER);
+
+	zassert_equal(k_thread_cbs_set(t0, 2000, 1000), -EINVAL,
+		      "budget larger than period accepted");
+	zassert_equal(k_thread_cbs_set(t0, 1000, 0), -EINVAL,
+		      "zero period accepted");
+
+	zassert_ok(k_thread_cbs_set(t0, 60000, 100000));
+	zassert_equal(k_thread_cbs_set(t1, 50000, 100000), -EBUSY,
+		      "over-utilization accepted");
+
+	/* Shrinking an existing reservation frees bandwidth */
+	zassert_ok(k_thread_cbs_set(t0, 40000, 100000));
+	zassert_ok(k_thread_cbs_set(t1, 50000, 100000));
+
+	/* Aborting a thread releases its reservation */
+	k_thread_abort(t0);
+	zassert_ok(k_thread_cbs_set(t1, 100000, 100000));
+
+	/* A dead thread cannot take a reservation back */
+	zassert_equal(k_thread_cbs_set(t0, 10000, 100000), -EINVAL,
+		      "reservation set on a dead thread");
+
+	zassert_ok(k_thread_cbs_set(t1, 0, 0));
+	k_thread_abort(t1);
+}
+
+#if CONFIG_MP_MAX_NUM_CPUS == 1
+/* With more CPUs the background thread runs regardless of the budget */
+static volatile uint32_t spinner_loops;
+static volatile uint32_t background_loops;
+
+static void cbs_spinner(void *p1, void *p2, void *p3)
+{
+	ARG_UNUSED(p1);
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	while (true) {
+		spinner_loops++;
+		k_busy_wait(100);
+	}
+}
+
+static void cbs_background(void *p1, void *p2, void *p3)
+{
+	ARG_UNUSED(p1);
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	while (true) {
+		background_loops++;
+		k_busy_wait(100);
+	}
+}
+
+ZTEST(suite_deadline, test_cbs_throttle)
+{
+	k_tid_t spinner = &worker_threads[0], background = &worker_threads[1];
+	uint32_t share;
+
+	spinner_loops = 0;
+	background_loops = 0;
+
+	/* A CPU hog with a 20% reservation must leave CPU time to a
+	 * lower priority thread once its budget is exhausted.
+	 */
+	k_thread_create(spinner, worker_stacks[0], STACK_SIZE, cbs_spinner,
+			NULL, NULL, NULL, K_LOWEST_APPLICATION_THREAD_PRIO - 1,
+			0, K_FOREVER);
+	k_thread_create(background, worker_stacks[1], STACK_SIZE,
+			cbs_background, NULL, NULL, NULL,
+			K_LOWEST_APPLICATION_THREAD_PRIO, 0, K_FOREVER);
+
+	zassert_ok(k_thread_cbs_set(spinner, 20000, 100000));
+
+	k_thread_start(spinner);
+	k_thread_start(background);
+
+	k_msleep(500);
+
+	k_thread_abort(spinner);
+	k_thread_abort(background);
+
+	zassert_true(background_loops > 0,
+		     "budget not enforced, background thread starved");
+
+	/* Both threads spin in equal steps, so the loop counts give the
+	 * split of CPU time between them. The spinner must get close to
+	 * its 20% reservation: the upper bound leaves room for budget
+	 * overruns of up to a tick per period.
+	 */
+	share = (spinner_loops * 100U) / (spinner_loops + background_loops);
+	zassert_true((share >= 10U) && (share <= 35U),
+		     "spinner got %u%% of the CPU with a 20%% reservation",
+		     share);
+}
+#endif /* CONFIG_MP_MAX_NUM_CPUS == 1 */
+#endif /* CONFIG_SCHED_DEADLINE_CBS */
+
 ZTEST_SUITE(suite_deadline, NULL, NULL, NULL, NULL, NULL);
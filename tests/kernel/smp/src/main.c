@@ -9,6 +9,7 @@
 #include <zephyr/kernel.h>
 #include <ksched.h>
 #include <zephyr/kernel_structs.h>
+#include <zephyr/kernel/smp.h>
 
 #if CONFIG_MP_MAX_NUM_CPUS < 2
 #error SMP test requires at least two CPUs!
@@ -1217,6 +1218,177 @@ ZTEST(smp, test_smp_affinity)
 }
 #endif
 
+#ifdef CONFIG_SCHED_IPI_WORK
+static atomic_t ipi_work_cpus;
+static atomic_t ipi_work_not_in_isr;
+
+static void ipi_work_func(struct k_ipi_work *work)
+{
+	ARG_UNUSED(work);
+
+	/* Asserts must not be called from ISRs, checked by the test thread */
+	if (!k_is_in_isr()) {
+		atomic_set(&ipi_work_not_in_isr, 1);
+	}
+	atomic_or(&ipi_work_cpus, BIT(arch_curr_cpu()->id));
+}
+
+/**
+ * @brief Test cross-CPU function calls
+ *
+ * @ingroup kernel_smp_tests
+ *
+ * @details Queue a function on every CPU, including the calling one,
+ * and verify that it runs exactly on the other CPUs. Also check that a
+ * pending item is rejected and that an item can be reused after it
+ * completed.
+ */
+ZTEST(smp, test_smp_ipi_work)
+{
+	static struct k_ipi_work work;
+	uint32_t all_cpus = BIT_MASK(arch_num_cpus());
+	uint32_t self;
+	unsigned int key;
+	int ret;
+
+	k_ipi_work_init(&work);
+
+	for (int i = 0; i < 3; i++) {
+		atomic_clear(&ipi_work_cpus);
+		atomic_clear(&ipi_work_not_in_isr);
+
+		key = arch_irq_lock();
+		self = BIT(arch_curr_cpu()->id);
+
+		zassert_equal(k_ipi_work_add(&work, self, ipi_work_func),
+			      -EINVAL, "work targeting only self accepted");
+
+		ret = k_ipi_work_add(&work, all_cpus, ipi_work_func);
+		zassert_equal(ret, 0, "failed to add IPI work (%d)", ret);
+
+		ret = k_ipi_work_add(&work, all_cpus, ipi_work_func);
+		zassert_equal(ret, -EBUSY, "pending IPI work re-added (%d)",
+			      ret);
+		arch_irq_unlock(key);
+
+		k_ipi_work_signal();
+
+		ret = k_ipi_work_wait(&work, K_MSEC(1000));
+		zassert_equal(ret, 0, "IPI work did not complete (%d)", ret);
+		zassert_equal(atomic_get(&ipi_work_cpus), all_cpus & ~self,
+			      "IPI work ran on 0x%lx, expected 0x%x",
+			      atomic_get(&ipi_work_cpus), all_cpus & ~self);
+		zassert_false(atomic_get(&ipi_work_not_in_isr),
+			      "IPI work not run from the IPI handler");
+	}
+}
+#endif /* CONFIG_SCHED_IPI_WORK */
+
+#if defined(CONFIG_TIMEOUT_QUEUE_PER_CPU) && defined(CONFIG_SCHED_CPU_MASK)
+static struct k_timer percpu_timers[MAX_NUM_THREADS];
+static volatile int percpu_timer_cpu[MAX_NUM_THREADS];
+
+static void percpu_timer_expiry(struct k_timer *timer)
+{
+	/* Runs from the timeout callback, recorded for the test thread */
+	percpu_timer_cpu[timer - percpu_timers] = curr_cpu();
+}
+
+static void percpu_timer_entry(void *arg0, void *arg1, void *arg2)
+{
+	int i = POINTER_TO_INT(arg0);
+
+	ARG_UNUSED(arg1);
+	ARG_UNUSED(arg2);
+
+	k_timer_init(&percpu_timers[i], percpu_timer_expiry, NULL);
+	k_timer_start(&percpu_timers[i], K_MSEC(10), K_NO_WAIT);
+	(void)k_timer_status_sync(&percpu_timers[i]);
+}
+
+/**
+ * @brief Test that timeouts expire on the CPU that armed them
+ *
+ * @ingroup kernel_smp_tests
+ *
+ * @details Start a timer from a thread pinned to each CPU and verify
+ * that every expiry function runs on the CPU of its thread.
+ */
+ZTEST(smp, test_percpu_timeout_cpu)
+{
+	int num_cpus = arch_num_cpus();
+
+	for (int i = 0; i < num_cpus; i++) {
+		percpu_timer_cpu[i] = -1;
+		k_thread_create(&tthread[i], tstack[i], STACK_SIZE,
+				percpu_timer_entry, INT_TO_POINTER(i), NULL, NULL,
+				0, 0, K_FOREVER);
+		k_thread_cpu_pin(&tthread[i], i);
+		k_thread_start(&tthread[i]);
+	}
+
+	for (int i = 0; i < num_cpus; i++) {
+		zassert_equal(k_thread_join(&tthread[i], K_MSEC(TIMEOUT)), 0,
+			      "timer of CPU %d did not expire", i);
+		zassert_equal(percpu_timer_cpu[i], i,
+			      "timer armed on CPU %d expired on CPU %d", i,
+			      percpu_timer_cpu[i]);
+	}
+}
+
+static volatile int percpu_wake_cpu;
+
+static void percpu_sleep_entry(void *arg0, void *arg1, void *arg2)
+{
+	ARG_UNUSED(arg0);
+	ARG_UNUSED(arg1);
+	ARG_UNUSED(arg2);
+
+	k_msleep(100);
+	percpu_wake_cpu = curr_cpu();
+}
+
+/**
+ * @brief Test that a pending thread's timeout follows its CPU mask
+ *
+ * @ingroup kernel_smp_tests
+ *
+ * @details Pin a sleeping thread to another CPU than the one it armed
+ * its timeout on, and verify that the timeout moved to the new CPU's
+ * queue and still wakes the thread on time.
+ */
+ZTEST(smp, test_percpu_timeout_migrate)
+{
+	int64_t start;
+
+	percpu_wake_cpu = -1;
+	k_thread_create(&tthread[0], tstack[0], STACK_SIZE,
+			percpu_sleep_entry, NULL, NULL, NULL,
+			0, 0, K_FOREVER);
+	k_thread_cpu_pin(&tthread[0], 0);
+
+	start = k_uptime_get();
+	k_thread_start(&tthread[0]);
+
+	/* Let the thread go to sleep on CPU 0 */
+	k_msleep(20);
+	zassert_equal(tthread[0].base.timeout.cpu, 0,
+		      "timeout not armed on the sleeping thread's CPU");
+
+	zassert_equal(k_thread_cpu_pin(&tthread[0], 1), 0,
+		      "failed to pin the sleeping thread");
+	zassert_equal(tthread[0].base.timeout.cpu, 1,
+		      "timeout did not follow the CPU mask");
+
+	zassert_equal(k_thread_join(&tthread[0], K_MSEC(TIMEOUT)), 0,
+		      "migrated timeout did not expire");
+	zassert_true(k_uptime_get() - start >= 100,
+		     "migrated timeout expired early");
+	zassert_equal(percpu_wake_cpu, 1, "thread woke up on CPU %d",
+		      percpu_wake_cpu);
+}
+#endif /* CONFIG_TIMEOUT_QUEUE_PER_CPU && CONFIG_SCHED_CPU_MASK */
+
 static void *smp_tests_setup(void)
 {
 	/* Sleep a bit to guarantee that both CPUs enter an idle
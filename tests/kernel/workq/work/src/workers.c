@@ -0,0 +1,160 @@
+/*
+ * Copyright (c) 2025 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/ztest.h>
+
+#ifdef CONFIG_WORKQUEUE_WORKERS
+
+#define STACK_SIZE (1024 + CONFIG_TEST_EXTRA_STACK_SIZE)
+#define NUM_WORKERS 2
+#define NUM_ITEMS (NUM_WORKERS + 1)
+#define WORKER_PRIORITY K_PRIO_PREEMPT(1)
+
+static K_THREAD_STACK_DEFINE(mw_stack, STACK_SIZE);
+static K_THREAD_STACK_ARRAY_DEFINE(mw_worker_stacks, NUM_WORKERS, STACK_SIZE);
+static struct k_thread mw_workers[NUM_WORKERS];
+static struct k_work_q mw_queue;
+
+static struct k_work mw_items[NUM_ITEMS];
+static struct k_work_sync mw_sync;
+
+/* Given by handlers when they start, taken by the test. */
+static K_SEM_DEFINE(mw_started, 0, NUM_ITEMS);
+
+/* Given by the test to let blocked handlers finish. */
+static K_SEM_DEFINE(mw_release, 0, NUM_ITEMS);
+
+static atomic_t mw_active;
+static atomic_t mw_max_active;
+static atomic_t mw_runs;
+
+static void mw_handler(struct k_work *work)
+{
+	atomic_val_t active = atomic_inc(&mw_active) + 1;
+	atomic_val_t max = atomic_get(&mw_max_active);
+
+	while ((active > max) && !atomic_cas(&mw_max_active, max, active)) {
+		max = atomic_get(&mw_max_active);
+	}
+
+	atomic_inc(&mw_runs);
+	k_sem_give(&mw_started);
+	(void)k_sem_take(&mw_release, K_FOREVER);
+	atomic_dec(&mw_active);
+}
+
+static void mw_reset(void)
+{
+	atomic_set(&mw_active, 0);
+	atomic_set(&mw_max_active, 0);
+	atomic_set(&mw_runs, 0);
+	k_sem_reset(&mw_started);
+	k_sem_reset(&mw_release);
+
+	for (unsigned int i = 0; i < NUM_ITEMS; i++) {
+		k_work_init(&mw_items[i], mw_handler);
+	}
+}
+
+/* Independent items are spread over all workers of the queue. */
+ZTEST(work_workers, test_parallel_items)
+{
+	mw_reset();
+
+	for (unsigned int i = 0; i < NUM_ITEMS; i++) {
+		zassert_equal(k_work_submit_to_queue(&mw_queue, &mw_items[i]), 1);
+	}
+
+	for (unsigned int i = 0; i < NUM_ITEMS; i++) {
+		zassert_equal(k_sem_take(&mw_started, K_MSEC(100)), 0);
+	}
+	for (unsigned int i = 0; i < NUM_ITEMS; i++) {
+		zassert_equal(k_work_busy_get(&mw_items[i]), K_WORK_RUNNING);
+	}
+	zassert_equal(atomic_get(&mw_max_active), NUM_ITEMS);
+
+	for (unsigned int i = 0; i < NUM_ITEMS; i++) {
+		k_sem_give(&mw_release);
+	}
+	zassert_equal(k_work_queue_drain(&mw_queue, false), 1);
+	zassert_equal(atomic_get(&mw_runs), NUM_ITEMS);
+}
+
+/* A resubmitted item waits for its running instance and a flush waits
+ * for both, even though idle workers are available.
+ */
+ZTEST(work_workers, test_resubmit_running)
+{
+	struct k_work *work = &mw_items[0];
+
+	mw_reset();
+
+	zassert_equal(k_work_submit_to_queue(&mw_queue, work), 1);
+	zassert_equal(k_sem_take(&mw_started, K_MSEC(100)), 0);
+
+	zassert_equal(k_work_submit_to_queue(&mw_queue, work), 2);
+	zassert_equal(k_work_busy_get(work), K_WORK_RUNNING | K_WORK_QUEUED);
+
+	/* No other worker may pick up the queued instance */
+	zassert_equal(k_sem_take(&mw_started, K_MSEC(50)), -EAGAIN);
+
+	k_sem_give(&mw_release);
+	k_sem_give(&mw_release);
+	zassert_true(k_work_flush(work, &mw_sync));
+
+	zassert_equal(k_work_busy_get(work), 0);
+	zassert_equal(atomic_get(&mw_runs), 2);
+	zassert_equal(atomic_get(&mw_max_active), 1);
+}
+
+/* Cancelling an item running on a worker waits for its completion. */
+ZTEST(work_workers, test_cancel_running)
+{
+	struct k_work *work = &mw_items[1];
+
+	mw_reset();
+
+	zassert_equal(k_work_submit_to_queue(&mw_queue, work), 1);
+	zassert_equal(k_sem_take(&mw_started, K_MSEC(100)), 0);
+
+	zassert_equal(k_work_cancel(work), K_WORK_RUNNING | K_WORK_CANCELING);
+	k_sem_give(&mw_release);
+	zassert_true(k_work_cancel_sync(work, &mw_sync));
+	zassert_equal(k_work_busy_get(work), 0);
+}
+
+ZTEST(work_workers, test_add_worker_errors)
+{
+	static struct k_work_q unstarted;
+
+	zassert_equal(k_work_queue_add_worker(&unstarted, &mw_workers[0],
+					      mw_worker_stacks[0], STACK_SIZE,
+					      WORKER_PRIORITY, -1), -ENODEV);
+	zassert_equal(k_work_queue_add_worker(&mw_queue, &mw_workers[0],
+					      mw_worker_stacks[0], STACK_SIZE,
+					      WORKER_PRIORITY,
+					      arch_num_cpus()), -EINVAL);
+}
+
+static void *workers_setup(void)
+{
+	k_work_queue_init(&mw_queue);
+	k_work_queue_start(&mw_queue, mw_stack, STACK_SIZE, WORKER_PRIORITY,
+			   NULL);
+
+	for (unsigned int i = 0; i < NUM_WORKERS; i++) {
+		zassert_equal(k_work_queue_add_worker(&mw_queue, &mw_workers[i],
+						      mw_worker_stacks[i],
+						      K_THREAD_STACK_SIZEOF(mw_worker_stacks[i]),
+						      WORKER_PRIORITY, -1), 0);
+	}
+
+	return NULL;
+}
+
+ZTEST_SUITE(work_workers, NULL, workers_setup, NULL, NULL, NULL);
+
+#endif /* CONFIG_WORKQUEUE_WORKERS */
@@ -990,6 +990,61 @@ ZTEST(cbprintf_package, test_cbprintf_package_convert_static)
 
 }
 
+/* Character pointer used for %p is not appended when format string is checked
+ * unless package indicates that all character pointers are strings.
+ */
+ZTEST(cbprintf_package, test_cbprintf_package_convert_pchar_str)
+{
+	int slen, clen0, clen1;
+	static const char test_str[] = "test %p %s";
+	char test_str1[] = "test str1";
+	char test_str2[] = "test str2";
+	uint32_t flags = CBPRINTF_PACKAGE_ADD_RW_STR_POS;
+	uint32_t copy_flags = CBPRINTF_PACKAGE_CONVERT_RW_STR |
+			      CBPRINTF_PACKAGE_CONVERT_PTR_CHECK;
+
+	if (!IS_ENABLED(CONFIG_CBPRINTF_CONVERT_CHECK_PTR)) {
+		ztest_test_skip();
+	}
+
+	zassert_false(Z_CBPRINTF_FMT_NO_PTR(test_str));
+	zassert_false(Z_CBPRINTF_FMT_NO_PTR("test %08p"));
+	zassert_false(Z_CBPRINTF_FMT_NO_PTR("test %-p"));
+
+#define TEST_FMT test_str, test_str1, test_str2
+	CBPRINTF_STATIC_PACKAGE(NULL, 0, slen, 0, flags, TEST_FMT);
+	zassert_true(slen > 0);
+
+	uint8_t __aligned(CBPRINTF_PACKAGE_ALIGNMENT) package0[slen];
+	uint8_t __aligned(CBPRINTF_PACKAGE_ALIGNMENT) package1[slen];
+
+	CBPRINTF_STATIC_PACKAGE(package0, slen, slen, 0, flags, TEST_FMT);
+	zassert_true(slen > 0);
+	CBPRINTF_STATIC_PACKAGE(package1, slen, slen, 0,
+				flags | CBPRINTF_PACKAGE_PCHAR_ARGS_ARE_STR, TEST_FMT);
+	zassert_true(slen > 0);
+
+	/* Argument index of the last read-write string location is marked. */
+	zassert_true(package1[slen - 2] & Z_CBPRINTF_RW_STR_ARG_IS_STR);
+	zassert_false(package0[slen - 2] & Z_CBPRINTF_RW_STR_ARG_IS_STR);
+
+	clen0 = cbprintf_package_convert(package0, slen, NULL, 0, copy_flags, NULL, 0);
+	zassert_true(clen0 > 0);
+	clen1 = cbprintf_package_convert(package1, slen, NULL, 0, copy_flags, NULL, 0);
+	zassert_true(clen1 > 0);
+
+	if (Z_C_GENERIC) {
+		/* Static packaging only looks at argument types. Instead of
+		 * dropping the location, the string is appended.
+		 */
+		zassert_equal(clen1, clen0 + 2 + (int)strlen(test_str1));
+	} else {
+		/* Runtime packaging does not record the pointer as a string. */
+		zassert_equal(clen1, clen0);
+	}
+#undef TEST_FMT
+}
+
 /**
  * @brief Log information about variable sizes and alignment.
  *
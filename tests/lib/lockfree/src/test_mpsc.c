@@ -68,6 +68,43 @@ ZTEST(mpsc, test_push_pop)
 	zassert_is_null(node, "Pop on empty queue should return null");
 }
 
+static struct mpsc push_list_q;
+static struct mpsc_node push_list_nodes[4];
+
+/*
+ * @brief Push a list of elements and pop them in order
+ *
+ * @see mpsc_push_list(), mpsc_pop()
+ *
+ * @ingroup tests
+ */
+ZTEST(mpsc, test_push_list)
+{
+	struct mpsc_node *node;
+
+	mpsc_init(&push_list_q);
+
+	mpsc_push(&push_list_q, &push_list_nodes[0]);
+
+	mpsc_ptr_set(push_list_nodes[1].next, &push_list_nodes[2]);
+	mpsc_push_list(&push_list_q, &push_list_nodes[1], &push_list_nodes[2]);
+
+	zassert_equal(mpsc_ptr_get(push_list_q.head), &push_list_nodes[2],
+		      "Queue head should point at the last node of the list");
+
+	mpsc_push(&push_list_q, &push_list_nodes[3]);
+
+	for (int i = 0; i < ARRAY_SIZE(push_list_nodes); i++) {
+		node = mpsc_pop(&push_list_q);
+		zassert_equal(node, &push_list_nodes[i],
+			      "Pop should return node %d %p, instead was %p",
+			      i, &push_list_nodes[i], node);
+	}
+
+	node = mpsc_pop(&push_list_q);
+	zassert_is_null(node, "Pop on empty queue should return null");
+}
+
 #define MPSC_FREEQ_SZ 8
 #define MPSC_ITERATIONS 100000
 #define MPSC_STACK_SIZE (512 + CONFIG_TEST_EXTRA_STACK_SIZE)
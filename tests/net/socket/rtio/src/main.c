@@ -0,0 +1,259 @@
+/*
+ * Copyright (c) 2025 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_REGISTER(net_test, CONFIG_NET_SOCKETS_LOG_LEVEL);
+
+#include <stdio.h>
+#include <zephyr/ztest_assert.h>
+
+#include <zephyr/net/socket_rtio.h>
+
+#include "../../socket_helpers.h"
+
+#define BUF_AND_SIZE(buf) buf, sizeof(buf) - 1
+#define STRLEN(buf) (sizeof(buf) - 1)
+
+#define TEST_STR_SMALL "test"
+#define TEST_STR_OTHER "other"
+
+#define MY_IPV6_ADDR "::1"
+
+#define SERVER_PORT 4242
+#define CLIENT_PORT 9898
+
+#define WAIT_TIME K_MSEC(500)
+
+#define MEM_BLK_COUNT 8
+#define MEM_BLK_SIZE 16
+
+RTIO_DEFINE_WITH_MEMPOOL(r_sock, 8, 8, MEM_BLK_COUNT, MEM_BLK_SIZE, 4);
+
+NET_SOCKET_RTIO_IODEV_DEFINE(iodev_server);
+NET_SOCKET_RTIO_IODEV_DEFINE(iodev_client);
+static struct rtio_iodev iodev_accepted;
+
+static void wait_cqe(struct rtio_cqe *cqe, void *userdata)
+{
+	int ret;
+
+	ret = rtio_cqe_copy_out(&r_sock, cqe, 1, WAIT_TIME);
+	zassert_equal(ret, 1, "Timeout while waiting completion");
+	zassert_equal_ptr(cqe->userdata, userdata, "Unexpected completion");
+}
+
+static void no_cqe(void)
+{
+	struct rtio_cqe cqe;
+
+	zassert_equal(rtio_cqe_copy_out(&r_sock, &cqe, 1, K_MSEC(50)), 0,
+		      "Unexpected completion");
+}
+
+ZTEST(net_socket_rtio, test_udp_recv_send)
+{
+	int c_sock;
+	int s_sock;
+	struct sockaddr_in6 c_addr;
+	struct sockaddr_in6 s_addr;
+	struct rtio_sqe *sqe;
+	struct rtio_cqe cqe;
+	char buf[10];
+	ssize_t len;
+	int ret;
+
+	prepare_sock_udp_v6(MY_IPV6_ADDR, CLIENT_PORT, &c_sock, &c_addr);
+	prepare_sock_udp_v6(MY_IPV6_ADDR, SERVER_PORT, &s_sock, &s_addr);
+
+	ret = bind(s_sock, (struct sockaddr *)&s_addr, sizeof(s_addr));
+	zassert_equal(ret, 0, "bind failed");
+	ret = connect(c_sock, (struct sockaddr *)&s_addr, sizeof(s_addr));
+	zassert_equal(ret, 0, "connect failed");
+
+	net_socket_rtio_iodev_init(&iodev_server, s_sock);
+	net_socket_rtio_iodev_init(&iodev_client, c_sock);
+
+	/* Receive waits for the data to arrive */
+	sqe = rtio_sqe_acquire(&r_sock);
+	rtio_sqe_prep_read(sqe, &iodev_server, RTIO_PRIO_NORM, buf, sizeof(buf), buf);
+	zassert_ok(rtio_submit(&r_sock, 0));
+	no_cqe();
+
+	/* Send completes right away */
+	sqe = rtio_sqe_acquire(&r_sock);
+	rtio_sqe_prep_write(sqe, &iodev_client, RTIO_PRIO_NORM,
+			    BUF_AND_SIZE(TEST_STR_SMALL), &iodev_client);
+	zassert_ok(rtio_submit(&r_sock, 0));
+
+	/* Either completion may come first */
+	for (int i = 0; i < 2; i++) {
+		ret = rtio_cqe_copy_out(&r_sock, &cqe, 1, WAIT_TIME);
+		zassert_equal(ret, 1, "Timeout while waiting completion");
+		zassert_equal(cqe.result, STRLEN(TEST_STR_SMALL), "invalid length %d",
+			      cqe.result);
+		zassert_true(cqe.userdata == buf || cqe.userdata == &iodev_client,
+			     "Unexpected completion");
+	}
+	zassert_mem_equal(buf, TEST_STR_SMALL, STRLEN(TEST_STR_SMALL));
+
+	/* Receive of data that already arrived completes right away */
+	len = send(c_sock, BUF_AND_SIZE(TEST_STR_OTHER), 0);
+	zassert_equal(len, STRLEN(TEST_STR_OTHER), "invalid send len");
+	k_msleep(10);
+
+	sqe = rtio_sqe_acquire(&r_sock);
+	rtio_sqe_prep_read(sqe, &iodev_server, RTIO_PRIO_NORM, buf, sizeof(buf), buf);
+	zassert_ok(rtio_submit(&r_sock, 1));
+	wait_cqe(&cqe, buf);
+	zassert_equal(cqe.result, STRLEN(TEST_STR_OTHER), "invalid length %d", cqe.result);
+	zassert_mem_equal(buf, TEST_STR_OTHER, STRLEN(TEST_STR_OTHER));
+
+	zassert_equal(close(c_sock), 0, "close failed");
+	zassert_equal(close(s_sock), 0, "close failed");
+}
+
+ZTEST(net_socket_rtio, test_udp_recvmsg_cancel)
+{
+	int c_sock;
+	int s_sock;
+	struct sockaddr_in6 c_addr;
+	struct sockaddr_in6 s_addr;
+	struct sockaddr_in6 peer;
+	struct rtio_sqe *sqe;
+	struct rtio_sqe *handle;
+	struct rtio_cqe cqe;
+	char buf0[2];
+	char buf1[8];
+	struct iovec iov[] = {
+		{ .iov_base = buf0, .iov_len = sizeof(buf0) },
+		{ .iov_base = buf1, .iov_len = sizeof(buf1) },
+	};
+	struct msghdr msg = {
+		.msg_name = &peer,
+		.msg_namelen = sizeof(peer),
+		.msg_iov = iov,
+		.msg_iovlen = ARRAY_SIZE(iov),
+	};
+	ssize_t len;
+	int ret;
+
+	prepare_sock_udp_v6(MY_IPV6_ADDR, CLIENT_PORT, &c_sock, &c_addr);
+	prepare_sock_udp_v6(MY_IPV6_ADDR, SERVER_PORT, &s_sock, &s_addr);
+
+	ret = bind(s_sock, (struct sockaddr *)&s_addr, sizeof(s_addr));
+	zassert_equal(ret, 0, "bind failed");
+	ret = bind(c_sock, (struct sockaddr *)&c_addr, sizeof(c_addr));
+	zassert_equal(ret, 0, "bind failed");
+
+	net_socket_rtio_iodev_init(&iodev_server, s_sock);
+
+	/* A canceled receive never completes */
+	sqe = rtio_sqe_acquire(&r_sock);
+	rtio_sqe_prep_read(sqe, &iodev_server, RTIO_PRIO_NORM, buf1, sizeof(buf1), buf1);
+	handle = sqe;
+	zassert_ok(rtio_submit(&r_sock, 0));
+	zassert_ok(rtio_sqe_cancel(handle));
+
+	/* Nor does one canceled while waiting, the poller drops it right away */
+	sqe = rtio_sqe_acquire(&r_sock);
+	rtio_sqe_prep_read(sqe, &iodev_server, RTIO_PRIO_NORM, buf0, sizeof(buf0), buf0);
+	handle = sqe;
+	zassert_ok(rtio_submit(&r_sock, 0));
+	zassert_ok(net_socket_rtio_cancel(handle));
+	no_cqe();
+
+	sqe = rtio_sqe_acquire(&r_sock);
+	net_socket_rtio_prep_recvmsg(sqe, &iodev_server, &msg, &msg);
+	zassert_ok(rtio_submit(&r_sock, 0));
+
+	len = sendto(c_sock, BUF_AND_SIZE(TEST_STR_SMALL), 0, (struct sockaddr *)&s_addr,
+		     sizeof(s_addr));
+	zassert_equal(len, STRLEN(TEST_STR_SMALL), "invalid send len");
+
+	wait_cqe(&cqe, &msg);
+	zassert_equal(cqe.result, STRLEN(TEST_STR_SMALL), "invalid length %d", cqe.result);
+	zassert_mem_equal(buf0, TEST_STR_SMALL, sizeof(buf0));
+	zassert_mem_equal(buf1, TEST_STR_SMALL + sizeof(buf0),
+			  STRLEN(TEST_STR_SMALL) - sizeof(buf0));
+	zassert_equal(peer.sin6_port, c_addr.sin6_port, "Unexpected peer");
+	no_cqe();
+
+	zassert_equal(close(c_sock), 0, "close failed");
+	zassert_equal(close(s_sock), 0, "close failed");
+}
+
+ZTEST(net_socket_rtio, test_tcp_accept_multishot)
+{
+	int c_sock;
+	int s_sock;
+	struct sockaddr_in6 c_addr;
+	struct sockaddr_in6 s_addr;
+	struct sockaddr_in6 peer;
+	socklen_t peer_len = sizeof(peer);
+	struct rtio_sqe *sqe;
+	struct rtio_cqe cqe;
+	uint8_t *buf;
+	uint32_t buf_len;
+	ssize_t len;
+	int ret;
+
+	prepare_sock_tcp_v6(MY_IPV6_ADDR, CLIENT_PORT, &c_sock, &c_addr);
+	prepare_sock_tcp_v6(MY_IPV6_ADDR, SERVER_PORT, &s_sock, &s_addr);
+
+	ret = bind(s_sock, (struct sockaddr *)&s_addr, sizeof(s_addr));
+	zassert_equal(ret, 0, "bind failed (%d)", -errno);
+	ret = listen(s_sock, 0);
+	zassert_equal(ret, 0, "listen failed");
+
+	net_socket_rtio_iodev_init(&iodev_server, s_sock);
+
+	sqe = rtio_sqe_acquire(&r_sock);
+	net_socket_rtio_prep_accept(sqe, &iodev_server, (struct sockaddr *)&peer, &peer_len,
+				    &iodev_server);
+	zassert_ok(rtio_submit(&r_sock, 0));
+	no_cqe();
+
+	ret = connect(c_sock, (const struct sockaddr *)&s_addr, sizeof(s_addr));
+	zassert_equal(ret, 0, "connect failed");
+
+	wait_cqe(&cqe, &iodev_server);
+	zassert_true(cqe.result >= 0, "accept failed (%d)", cqe.result);
+	zassert_equal(peer_len, sizeof(peer), "Unexpected peer length");
+	net_socket_rtio_iodev_init(&iodev_accepted, cqe.result);
+
+	/* One receive gets every message sent on the connection */
+	sqe = rtio_sqe_acquire(&r_sock);
+	rtio_sqe_prep_read_multishot(sqe, &iodev_accepted, RTIO_PRIO_NORM, &iodev_accepted);
+	zassert_ok(rtio_submit(&r_sock, 0));
+
+	for (int i = 0; i < 3; i++) {
+		len = send(c_sock, BUF_AND_SIZE(TEST_STR_SMALL), 0);
+		zassert_equal(len, STRLEN(TEST_STR_SMALL), "invalid send len");
+
+		wait_cqe(&cqe, &iodev_accepted);
+		zassert_equal(cqe.result, STRLEN(TEST_STR_SMALL), "invalid length %d",
+			      cqe.result);
+		zassert_ok(rtio_cqe_get_mempool_buffer(&r_sock, &cqe, &buf, &buf_len));
+		zassert_true(buf_len >= STRLEN(TEST_STR_SMALL), "buffer too small");
+		zassert_mem_equal(buf, TEST_STR_SMALL, STRLEN(TEST_STR_SMALL));
+		rtio_release_buffer(&r_sock, buf, buf_len);
+	}
+
+	/* Closing the connection ends the receive */
+	zassert_equal(close(c_sock), 0, "close failed");
+
+	wait_cqe(&cqe, &iodev_accepted);
+	zassert_equal(cqe.result, 0, "Expected end of connection (%d)", cqe.result);
+	no_cqe();
+
+	zassert_equal(close(net_socket_rtio_iodev_sock(&iodev_accepted)), 0, "close failed");
+	zassert_equal(close(s_sock), 0, "close failed");
+
+	/* Let the stack close the TCP sockets properly */
+	k_msleep(100);
+}
+
+ZTEST_SUITE(net_socket_rtio, NULL, NULL, NULL, NULL, NULL);
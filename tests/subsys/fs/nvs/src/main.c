@@ -101,6 +101,19 @@ ZTEST_F(nvs, test_nvs_mount)
 	zassert_true(err == 0,  "nvs_mount call failure: %d", err);
 }
 
+/* Remount keeping the entries still held by the write combining buffer */
+static int nvs_remount(struct nvs_fs *fs)
+{
+	int err;
+
+	err = nvs_flush(fs);
+	if (err) {
+		return err;
+	}
+
+	return nvs_mount(fs);
+}
+
 static void execute_long_pattern_write(uint16_t id, struct nvs_fs *fs)
 {
 	char rd_buf[512];
@@ -171,6 +184,9 @@ ZTEST_F(nvs, test_nvs_corrupted_write)
 	uint32_t *flash_write_stat;
 	uint32_t *flash_max_write_calls;
 
+	/* Counts the flash writes done by a single nvs_write() */
+	Z_TEST_SKIP_IFDEF(CONFIG_NVS_WRITE_COMBINE);
+
 	err = nvs_mount(&fixture->fs);
 	zassert_true(err == 0,  "nvs_mount call failure: %d", err);
 
@@ -281,7 +297,7 @@ ZTEST_F(nvs, test_nvs_gc)
 
 	}
 
-	err = nvs_mount(&fixture->fs);
+	err = nvs_remount(&fixture->fs);
 	zassert_true(err == 0,  "nvs_mount call failure: %d", err);
 
 	for (uint16_t id = 0; id < max_id; id++) {
@@ -354,6 +370,9 @@ ZTEST_F(nvs, test_nvs_gc_3sectors)
 	/* 125th write will trigger 4st GC. */
 	const uint16_t max_writes_4 = 51 + 25 + 25 + 25;
 
+	/* Expects the sectors to be switched by nvs_write() only */
+	Z_TEST_SKIP_IFDEF(CONFIG_NVS_GC_ASYNC);
+
 	fixture->fs.sector_count = 3;
 
 	err = nvs_mount(&fixture->fs);
@@ -369,7 +388,7 @@ ZTEST_F(nvs, test_nvs_gc_3sectors)
 		     "unexpected write sector");
 	check_content(max_id, &fixture->fs);
 
-	err = nvs_mount(&fixture->fs);
+	err = nvs_remount(&fixture->fs);
 	zassert_true(err == 0,  "nvs_mount call failure: %d", err);
 
 	zassert_equal(fixture->fs.ate_wra >> ADDR_SECT_SHIFT, 2,
@@ -384,7 +403,7 @@ ZTEST_F(nvs, test_nvs_gc_3sectors)
 		     "unexpected write sector");
 	check_content(max_id, &fixture->fs);
 
-	err = nvs_mount(&fixture->fs);
+	err = nvs_remount(&fixture->fs);
 	zassert_true(err == 0,  "nvs_mount call failure: %d", err);
 
 	zassert_equal(fixture->fs.ate_wra >> ADDR_SECT_SHIFT, 0,
@@ -399,7 +418,7 @@ ZTEST_F(nvs, test_nvs_gc_3sectors)
 		     "unexpected write sector");
 	check_content(max_id, &fixture->fs);
 
-	err = nvs_mount(&fixture->fs);
+	err = nvs_remount(&fixture->fs);
 	zassert_true(err == 0,  "nvs_mount call failure: %d", err);
 
 	zassert_equal(fixture->fs.ate_wra >> ADDR_SECT_SHIFT, 1,
@@ -414,7 +433,7 @@ ZTEST_F(nvs, test_nvs_gc_3sectors)
 		     "unexpected write sector");
 	check_content(max_id, &fixture->fs);
 
-	err = nvs_mount(&fixture->fs);
+	err = nvs_remount(&fixture->fs);
 	zassert_true(err == 0,  "nvs_mount call failure: %d", err);
 
 	zassert_equal(fixture->fs.ate_wra >> ADDR_SECT_SHIFT, 2,
@@ -470,6 +489,9 @@ ZTEST_F(nvs, test_nvs_corrupted_sector_close_operation)
 	/* 25th write will trigger GC. */
 	const uint16_t max_writes = 26;
 
+	/* Counts the flash writes done by a single nvs_write() */
+	Z_TEST_SKIP_IFDEF(CONFIG_NVS_WRITE_COMBINE);
+
 	/* Get the address of simulator parameters. */
 	stats_walk(fixture->sim_thresholds, flash_sim_max_write_calls_find,
 		   &flash_max_write_calls);
@@ -553,7 +575,7 @@ ZTEST_F(nvs, test_nvs_full_sector)
 	zassert_true(err == 0,  "nvs_delete call failure: %d", err);
 
 	/* the last sector is full now, test re-initialization */
-	err = nvs_mount(&fixture->fs);
+	err = nvs_remount(&fixture->fs);
 	zassert_true(err == 0,  "nvs_mount call failure: %d", err);
 
 	len = nvs_write(&fixture->fs, filling_id, &filling_id, sizeof(filling_id));
@@ -100,6 +100,19 @@ ZTEST_F(zms, test_zms_mount)
 	zassert_true(err == 0, "zms_mount call failure: %d", err);
 }
 
+/* Remount keeping the entries still held by the write combining buffer */
+static int zms_remount(struct zms_fs *fs)
+{
+	int err;
+
+	err = zms_flush(fs);
+	if (err) {
+		return err;
+	}
+
+	return zms_mount(fs);
+}
+
 static void execute_long_pattern_write(uint32_t id, struct zms_fs *fs)
 {
 	char rd_buf[512];
@@ -168,6 +181,9 @@ ZTEST_F(zms, test_zms_corrupted_write)
 	uint32_t *flash_write_stat;
 	uint32_t *flash_max_write_calls;
 
+	/* Counts the flash writes done by a single zms_write() */
+	Z_TEST_SKIP_IFDEF(CONFIG_ZMS_WRITE_COMBINE);
+
 	err = zms_mount(&fixture->fs);
 	zassert_true(err == 0, "zms_mount call failure: %d", err);
 
@@ -261,7 +277,7 @@ ZTEST_F(zms, test_zms_gc)
 				  "RD buff should be equal to the WR buff");
 	}
 
-	err = zms_mount(&fixture->fs);
+	err = zms_remount(&fixture->fs);
 	zassert_true(err == 0, "zms_mount call failure: %d", err);
 
 	for (int id = 0; id < max_id; id++) {
@@ -328,6 +344,9 @@ ZTEST_F(zms, test_zms_gc_3sectors)
 	/* 101st write will trigger 4th GC. */
 	const uint16_t max_writes_4 = 41 + 20 + 20 + 20;
 
+	/* Expects the sectors to be switched by zms_write() only */
+	Z_TEST_SKIP_IFDEF(CONFIG_ZMS_GC_ASYNC);
+
 	fixture->fs.sector_count = 3;
 
 	err = zms_mount(&fixture->fs);
@@ -341,7 +360,7 @@ ZTEST_F(zms, test_zms_gc_3sectors)
 	zassert_equal(fixture->fs.ate_wra >> ADDR_SECT_SHIFT, 2, "unexpected write sector");
 	check_content(max_id, &fixture->fs);
 
-	err = zms_mount(&fixture->fs);
+	err = zms_remount(&fixture->fs);
 	zassert_true(err == 0, "zms_mount call failure: %d", err);
 
 	zassert_equal(fixture->fs.ate_wra >> ADDR_SECT_SHIFT, 2, "unexpected write sector");
@@ -354,7 +373,7 @@ ZTEST_F(zms, test_zms_gc_3sectors)
 	zassert_equal(fixture->fs.ate_wra >> ADDR_SECT_SHIFT, 0, "unexpected write sector");
 	check_content(max_id, &fixture->fs);
 
-	err = zms_mount(&fixture->fs);
+	err = zms_remount(&fixture->fs);
 	zassert_true(err == 0, "zms_mount call failure: %d", err);
 
 	zassert_equal(fixture->fs.ate_wra >> ADDR_SECT_SHIFT, 0, "unexpected write sector");
@@ -367,7 +386,7 @@ ZTEST_F(zms, test_zms_gc_3sectors)
 	zassert_equal(fixture->fs.ate_wra >> ADDR_SECT_SHIFT, 1, "unexpected write sector");
 	check_content(max_id, &fixture->fs);
 
-	err = zms_mount(&fixture->fs);
+	err = zms_remount(&fixture->fs);
 	zassert_true(err == 0, "zms_mount call failure: %d", err);
 
 	zassert_equal(fixture->fs.ate_wra >> ADDR_SECT_SHIFT, 1, "unexpected write sector");
@@ -380,7 +399,7 @@ ZTEST_F(zms, test_zms_gc_3sectors)
 	zassert_equal(fixture->fs.ate_wra >> ADDR_SECT_SHIFT, 2, "unexpected write sector");
 	check_content(max_id, &fixture->fs);
 
-	err = zms_mount(&fixture->fs);
+	err = zms_remount(&fixture->fs);
 	zassert_true(err == 0, "zms_mount call failure: %d", err);
 
 	zassert_equal(fixture->fs.ate_wra >> ADDR_SECT_SHIFT, 2, "unexpected write sector");
@@ -409,6 +428,9 @@ ZTEST_F(zms, test_zms_corrupted_sector_close_operation)
 	/* 21st write will trigger GC. */
 	const uint16_t max_writes = 21;
 
+	/* Counts the flash writes done by a single zms_write() */
+	Z_TEST_SKIP_IFDEF(CONFIG_ZMS_WRITE_COMBINE);
+
 	/* Get the address of simulator parameters. */
 	stats_walk(fixture->sim_thresholds, flash_sim_max_write_calls_find, &flash_max_write_calls);
 	stats_walk(fixture->sim_thresholds, flash_sim_max_len_find, &flash_max_len);
@@ -481,7 +503,7 @@ ZTEST_F(zms, test_zms_full_sector)
 	zassert_true(err == 0, "zms_delete call failure: %d", err);
 
 	/* the last sector is full now, test re-initialization */
-	err = zms_mount(&fixture->fs);
+	err = zms_remount(&fixture->fs);
 	zassert_true(err == 0, "zms_mount call failure: %d", err);
 
 	len = zms_write(&fixture->fs, filling_id, &filling_id, sizeof(filling_id));
@@ -889,3 +911,159 @@ ZTEST_F(zms, test_zms_cache_hash_quality)
 
 #endif
 }
+
+#ifdef CONFIG_ZMS_LOOKUP_INDEX
+static size_t num_index_entries_in_sector(uint32_t sector, struct zms_fs *fs)
+{
+	size_t num = 0;
+
+	for (int i = 0; i < CONFIG_ZMS_LOOKUP_INDEX_SIZE; i++) {
+		if ((fs->lookup_index[i].addr != ZMS_LOOKUP_CACHE_NO_ADDR) &&
+		    (SECTOR_NUM(fs->lookup_index[i].addr) == sector)) {
+			num++;
+		}
+	}
+
+	return num;
+}
+#endif
+
+/*
+ * Test that ZMS lookup index is rebuilt on zms_mount() with the latest ATE of
+ * every ID, and that deleted and missing IDs are not found.
+ */
+ZTEST_F(zms, test_zms_index_init)
+{
+#ifdef CONFIG_ZMS_LOOKUP_INDEX
+	int err;
+	uint32_t data;
+	uint64_t ate_addr[3];
+
+	err = zms_mount(&fixture->fs);
+	zassert_true(err == 0, "zms_mount call failure: %d", err);
+	zassert_true(fixture->fs.lookup_index_valid, "index not built");
+	zassert_equal(fixture->fs.lookup_index_count, 0, "uninitialized index");
+
+	for (uint32_t id = 0; id < ARRAY_SIZE(ate_addr); id++) {
+		data = id;
+		ate_addr[id] = fixture->fs.ate_wra;
+		err = zms_write(&fixture->fs, id, &data, sizeof(data));
+		zassert_equal(err, sizeof(data), "zms_write call failure: %d", err);
+	}
+
+	err = zms_delete(&fixture->fs, 1);
+	zassert_true(err == 0, "zms_delete call failure: %d", err);
+	ate_addr[1] = fixture->fs.ate_wra + fixture->fs.ate_size;
+
+	memset(fixture->fs.lookup_index, 0xAA, sizeof(fixture->fs.lookup_index));
+	err = zms_mount(&fixture->fs);
+	zassert_true(err == 0, "zms_mount call failure: %d", err);
+
+	zassert_equal(fixture->fs.lookup_index_count, ARRAY_SIZE(ate_addr),
+		      "invalid index after restart");
+	for (uint32_t id = 0; id < ARRAY_SIZE(ate_addr); id++) {
+		int i;
+
+		for (i = 0; i < CONFIG_ZMS_LOOKUP_INDEX_SIZE; i++) {
+			if ((fixture->fs.lookup_index[i].addr != ZMS_LOOKUP_CACHE_NO_ADDR) &&
+			    (fixture->fs.lookup_index[i].id == id)) {
+				break;
+			}
+		}
+		zassert_true(i < CONFIG_ZMS_LOOKUP_INDEX_SIZE, "ID %u not indexed", id);
+		zassert_equal(fixture->fs.lookup_index[i].addr, ate_addr[id],
+			      "invalid index entry for ID %u", id);
+	}
+
+	err = zms_read(&fixture->fs, 1, &data, sizeof(data));
+	zassert_equal(err, -ENOENT, "deleted ID found: %d", err);
+	err = zms_read(&fixture->fs, ARRAY_SIZE(ate_addr), &data, sizeof(data));
+	zassert_equal(err, -ENOENT, "missing ID found: %d", err);
+	err = zms_read(&fixture->fs, 2, &data, sizeof(data));
+	zassert_equal(err, sizeof(data), "zms_read call failure: %d", err);
+	zassert_equal(data, 2, "incorrect data read");
+#endif
+}
+
+/*
+ * Test that ZMS lookup index follows the entries moved by gc and does not
+ * contain any address from the gc-ed sector.
+ */
+ZTEST_F(zms, test_zms_index_gc)
+{
+#ifdef CONFIG_ZMS_LOOKUP_INDEX
+	int err;
+	uint16_t data = 0;
+
+	fixture->fs.sector_count = 3;
+	err = zms_mount(&fixture->fs);
+	zassert_true(err == 0, "zms_mount call failure: %d", err);
+
+	/* Sector 0 holds ID 1 and ID 3, ID 3 is deleted afterwards */
+	err = zms_write(&fixture->fs, 3, &data, sizeof(data));
+	zassert_equal(err, sizeof(data), "zms_write call failure: %d", err);
+	err = zms_delete(&fixture->fs, 3);
+	zassert_true(err == 0, "zms_delete call failure: %d", err);
+
+	while (fixture->fs.data_wra + sizeof(data) + sizeof(struct zms_ate) <=
+	       fixture->fs.ate_wra) {
+		++data;
+		err = zms_write(&fixture->fs, 1, &data, sizeof(data));
+		zassert_equal(err, sizeof(data), "zms_write call failure: %d", err);
+	}
+
+	/* Fill the next sectors with writes of ID 2 until sector 0 is gc-ed */
+	while ((fixture->fs.ate_wra >> ADDR_SECT_SHIFT) != 2) {
+		err = zms_write(&fixture->fs, 2, &data, sizeof(data));
+		zassert_equal(err, sizeof(data), "zms_write call failure: %d", err);
+		++data;
+	}
+
+	zassert_true(fixture->fs.lookup_index_valid, "index invalidated");
+	zassert_equal(num_index_entries_in_sector(0, &fixture->fs), 0,
+		      "index entries left in gc-ed sector");
+	zassert_equal(fixture->fs.lookup_index_count, 2, "invalid index content after gc");
+
+	err = zms_read(&fixture->fs, 1, &data, sizeof(data));
+	zassert_equal(err, sizeof(data), "zms_read call failure: %d", err);
+	err = zms_read(&fixture->fs, 3, &data, sizeof(data));
+	zassert_equal(err, -ENOENT, "deleted ID found after gc: %d", err);
+#endif
+}
+
+/*
+ * Test that writing more IDs than the ZMS lookup index can hold falls back to
+ * ATE walks. A deleted ID keeps its slot until gc drops its ATEs, so the index
+ * is still overflowed after a delete and a remount.
+ */
+ZTEST_F(zms, test_zms_index_overflow)
+{
+#ifdef CONFIG_ZMS_LOOKUP_INDEX
+	int err;
+	uint16_t data;
+
+	err = zms_mount(&fixture->fs);
+	zassert_true(err == 0, "zms_mount call failure: %d", err);
+
+	for (int id = 0; id < CONFIG_ZMS_LOOKUP_INDEX_SIZE; id++) {
+		data = id;
+		err = zms_write(&fixture->fs, id, &data, sizeof(data));
+		zassert_equal(err, sizeof(data), "zms_write call failure: %d", err);
+	}
+
+	zassert_false(fixture->fs.lookup_index_valid, "index overflow not detected");
+
+	for (int id = 0; id < CONFIG_ZMS_LOOKUP_INDEX_SIZE; id++) {
+		err = zms_read(&fixture->fs, id, &data, sizeof(data));
+		zassert_equal(err, sizeof(data), "zms_read call failure: %d", err);
+		zassert_equal(data, id, "incorrect data read");
+	}
+
+	err = zms_delete(&fixture->fs, 0);
+	zassert_true(err == 0, "zms_delete call failure: %d", err);
+
+	err = zms_mount(&fixture->fs);
+	zassert_true(err == 0, "zms_mount call failure: %d", err);
+	zassert_false(fixture->fs.lookup_index_valid, "index overflow not detected");
+#endif
+}
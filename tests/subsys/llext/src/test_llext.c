@@ -132,6 +132,11 @@ void load_call_unload(const struct llext_test *test_case)
 
 	zassert_ok(res, "load should succeed");
 
+#if defined(CONFIG_LLEXT_BUILD_PIC) && !defined(CONFIG_LLEXT_STORAGE_WRITABLE)
+	/* Position independent code is executed in place from read-only storage */
+	zassert_false(ext->mem_on_heap[LLEXT_MEM_TEXT], "text should not be copied");
+#endif
+
 	void (*test_entry_fn)() = llext_find_sym(&ext->exp_tab, "test_entry");
 
 	zassert_not_null(test_entry_fn, "test_entry should be an exported symbol");
@@ -305,6 +310,53 @@ static LLEXT_CONST uint8_t object_ext[] ELF_ALIGN = {
 };
 LLEXT_LOAD_UNLOAD(object)
 
+#ifdef CONFIG_LLEXT_LOAD_CACHE
+ZTEST(llext, test_load_cache)
+{
+	struct llext_buf_loader buf_loader =
+		LLEXT_TEMPORARY_BUF_LOADER(object_ext, sizeof(object_ext));
+	struct llext_buf_loader other_loader =
+		LLEXT_TEMPORARY_BUF_LOADER(hello_world_ext, sizeof(hello_world_ext));
+	struct llext_load_param ldr_parm = LLEXT_LOAD_PARAM_DEFAULT;
+	struct llext *ext = NULL;
+	struct llext *cached = NULL;
+	void *text = NULL;
+	void (*test_entry_fn)(void);
+
+	ldr_parm.cache = true;
+
+	/* test_entry() fails on the third run unless its data is restored */
+	for (int i = 0; i < 3; i++) {
+		zassert_ok(llext_load(&buf_loader.loader, "cached", &ext, &ldr_parm),
+			   "load should succeed");
+
+		if (i == 0) {
+			cached = ext;
+			text = ext->mem[LLEXT_MEM_TEXT];
+		} else {
+			zassert_equal_ptr(ext, cached, "extension should come from the cache");
+			zassert_equal_ptr(ext->mem[LLEXT_MEM_TEXT], text,
+					  "cached code should not move");
+		}
+
+		test_entry_fn = llext_find_sym(&ext->exp_tab, "test_entry");
+		zassert_not_null(test_entry_fn, "test_entry should be an exported symbol");
+		test_entry_fn();
+
+		zassert_ok(llext_unload(&ext), "unload should succeed");
+	}
+
+	/* A different ELF file loaded under the same name replaces the cached one */
+	zassert_ok(llext_load(&other_loader.loader, "cached", &ext, &ldr_parm),
+		   "load should succeed");
+	zassert_not_null(llext_find_sym(&ext->exp_tab, "test_entry"),
+			 "test_entry should be an exported symbol");
+	zassert_ok(llext_unload(&ext), "unload should succeed");
+
+	llext_cache_flush();
+}
+#endif
+
 static LLEXT_CONST uint8_t syscalls_ext[] ELF_ALIGN = {
 	#include "syscalls.inc"
 };
@@ -36,6 +36,7 @@ FAKE_VOID_FUNC(log_output_dropped_process, const struct log_output *, uint32_t);
 FAKE_VALUE_FUNC(log_format_func_t, log_format_func_t_get, uint32_t);
 
 int write_log_to_file(uint8_t *data, size_t length, void *ctx);
+int write_log_block(uint8_t *data, size_t length, void *ctx);
 
 
 ZTEST(test_log_backend_fs, test_fs_nonexist)
@@ -244,6 +245,70 @@ ZTEST(test_log_backend_fs, test_log_fs_files_max)
 	zassert_equal(test_mask, 0b11110, "Unexpected file numeration");
 }
 
+#ifdef CONFIG_LOG_BACKEND_FS_BLOCKS
+#define BLOCK_HDR_SIZE 12
+#define BLOCK_PAYLOAD_SIZE (CONFIG_LOG_BACKEND_FS_BLOCK_SIZE - BLOCK_HDR_SIZE)
+
+struct test_block_hdr {
+	uint32_t magic;
+	uint32_t seq;
+	uint16_t used;
+	uint16_t first;
+} __packed;
+
+static void read_block_hdr(struct fs_file_t *file, int idx, struct test_block_hdr *hdr)
+{
+	zassert_equal(fs_seek(file, idx * CONFIG_LOG_BACKEND_FS_BLOCK_SIZE, FS_SEEK_SET), 0);
+	zassert_equal(fs_read(file, hdr, sizeof(*hdr)), sizeof(*hdr), "Can not read block");
+	zassert_equal(hdr->magic, 0x4b424c5a, "Bad block magic");
+	zassert_equal(hdr->first, 0xffff, "Unexpected record start");
+}
+
+ZTEST(test_log_backend_fs, test_log_fs_write_blocks)
+{
+	struct fs_file_t file;
+	struct test_block_hdr hdr[2];
+	struct fs_dirent entry;
+	static char fname[MAX_PATH_LEN];
+	uint8_t to_log[BLOCK_PAYLOAD_SIZE + 10];
+
+	memset(to_log, 0xa5, sizeof(to_log));
+	fs_file_t_init(&file);
+
+	/* The newest file holds text logs, blocks start in a new file. */
+	(void)write_log_block(to_log, sizeof(to_log), NULL);
+	backend->api->notify(backend, LOG_BACKEND_EVT_PROCESS_THREAD_DONE, NULL);
+
+	sprintf(fname, "%s/%s0005", CONFIG_LOG_BACKEND_FS_DIR, log_prefix);
+	zassert_equal(fs_stat(fname, &entry), 0, "Can not get file info.");
+	zassert_equal(entry.size, 2 * CONFIG_LOG_BACKEND_FS_BLOCK_SIZE,
+		      "Unexpected %s file size (%d B)", fname, entry.size);
+
+	zassert_equal(fs_open(&file, fname, FS_O_READ), 0, "Can not open log file.");
+	read_block_hdr(&file, 0, &hdr[0]);
+	read_block_hdr(&file, 1, &hdr[1]);
+	zassert_equal(fs_close(&file), 0, "Can not close log file.");
+
+	zassert_equal(hdr[0].used, BLOCK_PAYLOAD_SIZE);
+	zassert_equal(hdr[1].used, sizeof(to_log) - BLOCK_PAYLOAD_SIZE);
+	zassert_equal(hdr[1].seq, hdr[0].seq + 1);
+
+	/* Partially written block is completed in place. */
+	(void)write_log_block(to_log, 5, NULL);
+	backend->api->notify(backend, LOG_BACKEND_EVT_PROCESS_THREAD_DONE, NULL);
+
+	zassert_equal(fs_stat(fname, &entry), 0, "Can not get file info.");
+	zassert_equal(entry.size, 2 * CONFIG_LOG_BACKEND_FS_BLOCK_SIZE,
+		      "Unexpected %s file size (%d B)", fname, entry.size);
+
+	zassert_equal(fs_open(&file, fname, FS_O_READ), 0, "Can not open log file.");
+	read_block_hdr(&file, 1, &hdr[1]);
+	zassert_equal(fs_close(&file), 0, "Can not close log file.");
+
+	zassert_equal(hdr[1].used, sizeof(to_log) - BLOCK_PAYLOAD_SIZE + 5);
+}
+#endif /* CONFIG_LOG_BACKEND_FS_BLOCKS */
+
 static const struct log_backend *backend_find(char const *name)
 {
 	size_t slen = strlen(name);
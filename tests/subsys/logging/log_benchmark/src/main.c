@@ -230,13 +230,77 @@ ZTEST(test_log_benchmark, test_log_message_with_string)
 		cyc / repeat, us / repeat);
 }
 
+#define CONCURRENT_LOGGERS MAX(CONFIG_MP_MAX_NUM_CPUS, 2)
+#define CONCURRENT_MSGS 200
+#define CONCURRENT_STACK_SIZE (1024 + CONFIG_TEST_EXTRA_STACK_SIZE)
+
+static K_THREAD_STACK_ARRAY_DEFINE(logger_stacks, CONCURRENT_LOGGERS, CONCURRENT_STACK_SIZE);
+static struct k_thread logger_threads[CONCURRENT_LOGGERS];
+static K_SEM_DEFINE(logger_start, 0, CONCURRENT_LOGGERS);
+
+static void logger_thread(void *p1, void *p2, void *p3)
+{
+	int id = (int)(uintptr_t)p1;
+
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	(void)k_sem_take(&logger_start, K_FOREVER);
+
+	for (int i = 0; i < CONCURRENT_MSGS; i++) {
+		LOG_ERR("test %d %d", id, i);
+	}
+}
+
+/** Test throughput of threads logging at the same time. On SMP the threads
+ * run on different CPUs and contend on the log buffer unless
+ * CONFIG_LOG_BUFFER_PER_CPU is enabled.
+ */
+ZTEST(test_log_benchmark, test_log_concurrent_throughput)
+{
+	uint32_t total_msg = CONCURRENT_LOGGERS * CONCURRENT_MSGS;
+	uint32_t cyc;
+	uint32_t us;
+
+	test_helpers_log_setup();
+
+	for (int i = 0; i < CONCURRENT_LOGGERS; i++) {
+		k_thread_create(&logger_threads[i], logger_stacks[i],
+				K_THREAD_STACK_SIZEOF(logger_stacks[i]), logger_thread,
+				(void *)(uintptr_t)i, NULL, NULL, K_PRIO_PREEMPT(1), 0, K_NO_WAIT);
+	}
+
+	cyc = test_helpers_cycle_get();
+	for (int i = 0; i < CONCURRENT_LOGGERS; i++) {
+		k_sem_give(&logger_start);
+	}
+	for (int i = 0; i < CONCURRENT_LOGGERS; i++) {
+		zassert_equal(k_thread_join(&logger_threads[i], K_FOREVER), 0);
+	}
+	cyc = test_helpers_cycle_get() - cyc;
+	us = MAX(k_cyc_to_us_ceil32(cyc), 1);
+
+	PRINT("%d threads logged %u messages in %u cycles (%u us), %u messages/s\n",
+	      CONCURRENT_LOGGERS, total_msg, cyc, us,
+	      (uint32_t)(((uint64_t)total_msg * USEC_PER_SEC) / us));
+
+	for (unsigned int i = 0; IS_ENABLED(CONFIG_LOG_BUFFER_PER_CPU) && (i < arch_num_cpus());
+	     i++) {
+		uint32_t dropped;
+
+		zassert_equal(log_mem_get_cpu_dropped(i, &dropped), 0);
+		DBG_PRINT("CPU %u dropped %u messages\n", i, dropped);
+	}
+}
+
 /*test case main entry*/
 static void *log_benchmark_setup(void)
 {
 	PRINT("LOGGING MODE:%s\n", IS_ENABLED(CONFIG_LOG_MODE_DEFERRED) ? "DEFERRED" : "IMMEDIATE");
 	PRINT("\tOVERWRITE: %d\n", IS_ENABLED(CONFIG_LOG_MODE_OVERFLOW));
 	PRINT("\tBUFFER_SIZE: %d\n", CONFIG_LOG_BUFFER_SIZE);
-	PRINT("\tSPEED: %d", IS_ENABLED(CONFIG_LOG_SPEED));
+	PRINT("\tSPEED: %d\n", IS_ENABLED(CONFIG_LOG_SPEED));
+	PRINT("\tPER_CPU: %d", IS_ENABLED(CONFIG_LOG_BUFFER_PER_CPU));
 
 	return NULL;
 }
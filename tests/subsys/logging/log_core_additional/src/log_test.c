@@ -526,7 +526,7 @@ ZTEST(test_log_core_additional, test_log_msg_create)
 					  level, &msg_data, 0,
 					  sizeof(msg_data), NULL);
 		/* try z_log_msg_static_create() */
-		Z_LOG_MSG_STACK_CREATE(0, domain, __log_current_const_data,
+		Z_LOG_MSG_STACK_CREATE(0, 0, domain, __log_current_const_data,
 					level, &msg_data,
 					sizeof(msg_data), NULL);
 
@@ -554,7 +554,7 @@ ZTEST_USER(test_log_core_additional, test_log_msg_create_user)
 				  level, &msg_data, 0,
 				  sizeof(msg_data), TEST_MESSAGE);
 	/* try z_log_msg_static_create() */
-	Z_LOG_MSG_STACK_CREATE(0, domain, NULL,
+	Z_LOG_MSG_STACK_CREATE(0, 0, domain, NULL,
 				level, &msg_data,
 				sizeof(msg_data), TEST_MESSAGE);
 
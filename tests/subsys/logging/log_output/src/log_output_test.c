@@ -284,6 +284,86 @@ ZTEST(test_log_output, test_skip_src)
 	zassert_str_equal(exp_str, mock_buffer);
 }
 
+#ifdef CONFIG_LOG_PROCESS_BATCH
+static uint8_t log_output_batch_buf[64];
+static uint32_t mock_calls;
+static size_t mock_seg_len[4];
+static size_t mock_seg_cnt;
+
+static int mock_batch_output_func(uint8_t *buf, size_t size, void *ctx)
+{
+	mock_calls++;
+
+	return mock_output_func(buf, size, ctx);
+}
+
+static void mock_vec_output_func(const struct log_output_iovec *iov, size_t iovcnt, void *ctx)
+{
+	mock_calls++;
+	mock_seg_cnt = iovcnt;
+
+	for (size_t i = 0; i < iovcnt; i++) {
+		if (i < ARRAY_SIZE(mock_seg_len)) {
+			mock_seg_len[i] = iov[i].len;
+		}
+		(void)mock_output_func(iov[i].buf, iov[i].len, ctx);
+	}
+}
+
+LOG_OUTPUT_DEFINE(log_output_batch, mock_batch_output_func,
+		  log_output_batch_buf, sizeof(log_output_batch_buf));
+LOG_OUTPUT_VEC_DEFINE(log_output_vec, mock_batch_output_func, mock_vec_output_func,
+		      log_output_batch_buf, sizeof(log_output_batch_buf));
+
+ZTEST(test_log_output, test_batch)
+{
+	char package[256];
+	static const char *exp_str = SNAME ": " TEST_STR "\r\n" SNAME ": " TEST_STR "\r\n";
+	int err;
+
+	err = cbprintf_package(package, sizeof(package), 0, TEST_STR);
+	zassert_true(err > 0);
+
+	mock_calls = 0;
+	log_output_batch_begin(&log_output_batch);
+	log_output_process(&log_output_batch, 0, NULL, SNAME, NULL, LOG_LEVEL_INF,
+			   package, NULL, 0, 0);
+	log_output_process(&log_output_batch, 0, NULL, SNAME, NULL, LOG_LEVEL_INF,
+			   package, NULL, 0, 0);
+	zassert_equal(mock_calls, 0, "Batch written out early");
+	log_output_batch_end(&log_output_batch);
+
+	zassert_equal(mock_calls, 1);
+	mock_buffer[mock_len] = '\0';
+	zassert_str_equal(exp_str, mock_buffer);
+}
+
+ZTEST(test_log_output, test_batch_vectored)
+{
+	char package[256];
+	static const char *exp_str = SNAME ": " TEST_STR "\r\n" SNAME ": " TEST_STR "\r\n";
+	int err;
+
+	err = cbprintf_package(package, sizeof(package), 0, TEST_STR);
+	zassert_true(err > 0);
+
+	mock_calls = 0;
+	log_output_batch_begin(&log_output_vec);
+	log_output_process(&log_output_vec, 0, NULL, SNAME, NULL, LOG_LEVEL_INF,
+			   package, NULL, 0, 0);
+	log_output_process(&log_output_vec, 0, NULL, SNAME, NULL, LOG_LEVEL_INF,
+			   package, NULL, 0, 0);
+	log_output_batch_end(&log_output_vec);
+
+	zassert_equal(mock_calls, 1);
+	zassert_equal(mock_seg_cnt, 2);
+	zassert_equal(mock_seg_len[0], strlen(exp_str) / 2);
+	zassert_equal(mock_seg_len[1], strlen(exp_str) / 2);
+	mock_buffer[mock_len] = '\0';
+	zassert_str_equal(exp_str, mock_buffer);
+}
+#endif /* CONFIG_LOG_PROCESS_BATCH */
+
 static void before(void *notused)
 {
 	reset_mock_buffer();
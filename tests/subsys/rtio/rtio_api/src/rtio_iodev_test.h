@@ -87,8 +87,11 @@ static void rtio_iodev_timer_fn(struct k_timer *tm)
 {
 	struct rtio_iodev_test_data *data = CONTAINER_OF(tm, struct rtio_iodev_test_data, timer);
 	struct rtio_iodev_sqe *iodev_sqe = data->txn_curr;
+	const struct rtio_iovec *iov;
+	uint16_t iov_cnt;
 	uint8_t *buf;
 	uint32_t buf_len;
+	uint32_t off;
 	int rc;
 
 	switch (iodev_sqe->sqe.op) {
@@ -105,6 +108,17 @@ static void rtio_iodev_timer_fn(struct k_timer *tm)
 		memcpy(buf, ((uint8_t *)iodev_sqe->sqe.userdata), 16);
 		rtio_iodev_test_complete(data, 0);
 		break;
+	case RTIO_OP_RXV:
+		/* Scatter up to 16 bytes from the given userdata over the segments */
+		iov = rtio_sqe_iov(iodev_sqe, &iov_cnt);
+		off = 0;
+		for (uint16_t i = 0; i < iov_cnt && off < 16; i++) {
+			buf_len = MIN(iov[i].buf_len, 16 - off);
+			memcpy(iov[i].buf, ((uint8_t *)iodev_sqe->sqe.userdata) + off, buf_len);
+			off += buf_len;
+		}
+		rtio_iodev_test_complete(data, 0);
+		break;
 	case RTIO_OP_AWAIT:
 		rtio_iodev_sqe_await_signal(iodev_sqe, rtio_iodev_await_signaled, data);
 		break;
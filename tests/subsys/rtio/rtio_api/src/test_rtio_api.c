@@ -914,6 +914,203 @@ ZTEST(rtio_api, test_rtio_await)
 	test_rtio_await_(&r_await0, &r_await1);
 }
 
+#ifdef CONFIG_RTIO_SQ_PRODUCER
+#define PRODUCER_NUM 3
+#define PRODUCER_CHAIN_LEN 4
+#define PRODUCER_ITERS 100
+#define PRODUCER_STACK_SIZE (1024 + CONFIG_TEST_EXTRA_STACK_SIZE)
+
+RTIO_DEFINE(r_producers, 1, 2 * PRODUCER_NUM * PRODUCER_CHAIN_LEN);
+RTIO_SQ_PRODUCER_DEFINE(producer0, r_producers, PRODUCER_CHAIN_LEN);
+RTIO_SQ_PRODUCER_DEFINE(producer1, r_producers, PRODUCER_CHAIN_LEN);
+RTIO_SQ_PRODUCER_DEFINE(producer2, r_producers, PRODUCER_CHAIN_LEN);
+
+static struct rtio_sq_producer *const producers[PRODUCER_NUM] = {
+	&producer0, &producer1, &producer2,
+};
+static struct k_thread producer_threads[PRODUCER_NUM];
+static K_THREAD_STACK_ARRAY_DEFINE(producer_stacks, PRODUCER_NUM, PRODUCER_STACK_SIZE);
+static uint32_t producer_seq[PRODUCER_NUM];
+static atomic_t producer_order_errors;
+
+static void producer_cb(struct rtio *r, const struct rtio_sqe *sqe, void *arg0)
+{
+	uintptr_t id = (uintptr_t)arg0 >> 16;
+	uint32_t seq = (uintptr_t)arg0 & 0xffff;
+
+	if (producer_seq[id] != seq) {
+		atomic_inc(&producer_order_errors);
+	}
+	producer_seq[id] = seq + 1;
+}
+
+static void producer_thread(void *p1, void *p2, void *p3)
+{
+	struct rtio_sq_producer *p = p1;
+	uintptr_t id = (uintptr_t)p2;
+	uint32_t seq = 0;
+
+	ARG_UNUSED(p3);
+
+	for (int i = 0; i < PRODUCER_ITERS; i++) {
+		for (int j = 0; j < PRODUCER_CHAIN_LEN; j++) {
+			struct rtio_sqe *sqe = rtio_sq_producer_acquire(p);
+
+			/* Entries are released as the previous chain completes */
+			while (sqe == NULL) {
+				k_yield();
+				sqe = rtio_sq_producer_acquire(p);
+			}
+
+			rtio_sqe_prep_callback(sqe, producer_cb, (void *)((id << 16) | seq),
+					       (void *)id);
+			if (j < PRODUCER_CHAIN_LEN - 1) {
+				sqe->flags |= RTIO_SQE_CHAINED;
+			}
+			seq++;
+		}
+
+		rtio_sq_producer_submit(p);
+		k_yield();
+	}
+}
+
+/**
+ * @brief Test concurrent submissions from several producers
+ *
+ * Threads submit chains to the same context through their own producer while
+ * the test thread consumes the completions. Every chain must run in order and
+ * produce all of its completions.
+ */
+ZTEST(rtio_api, test_rtio_sq_producers)
+{
+	const uint32_t total = PRODUCER_NUM * PRODUCER_ITERS * PRODUCER_CHAIN_LEN;
+	uint32_t completions[PRODUCER_NUM] = {0};
+	struct rtio_cqe *cqe;
+
+	atomic_clear(&producer_order_errors);
+
+	for (uintptr_t i = 0; i < PRODUCER_NUM; i++) {
+		producer_seq[i] = 0;
+		k_thread_create(&producer_threads[i], producer_stacks[i],
+				K_THREAD_STACK_SIZEOF(producer_stacks[i]), producer_thread,
+				producers[i], (void *)i, NULL, K_PRIO_PREEMPT(1), 0, K_NO_WAIT);
+	}
+
+	for (uint32_t i = 0; i < total; i++) {
+		cqe = rtio_cqe_consume_block(&r_producers);
+		zassert_ok(cqe->result, "Result should be ok");
+		completions[(uintptr_t)cqe->userdata]++;
+		rtio_cqe_release(&r_producers, cqe);
+	}
+
+	for (int i = 0; i < PRODUCER_NUM; i++) {
+		k_thread_join(&producer_threads[i], K_FOREVER);
+		zassert_equal(completions[i], PRODUCER_ITERS * PRODUCER_CHAIN_LEN,
+			      "Producer %d got %u completions", i, completions[i]);
+		zassert_equal(producer_seq[i], PRODUCER_ITERS * PRODUCER_CHAIN_LEN,
+			      "Producer %d ran %u callbacks", i, producer_seq[i]);
+	}
+	zassert_equal(atomic_get(&producer_order_errors), 0, "Chains should run in order");
+	zassert_is_null(rtio_cqe_consume(&r_producers), "No completion should be left");
+}
+#endif /* CONFIG_RTIO_SQ_PRODUCER */
+
+RTIO_DEFINE(r_readv, SQE_POOL_SIZE, CQE_POOL_SIZE);
+
+/**
+ * @brief Test a scatter read into several segments
+ */
+ZTEST(rtio_api, test_rtio_readv)
+{
+	uint8_t data[16];
+	uint8_t seg0[4];
+	uint8_t seg1[12];
+	const struct rtio_iovec iov[] = {
+		{ .buf = seg0, .buf_len = sizeof(seg0) },
+		{ .buf = seg1, .buf_len = sizeof(seg1) },
+	};
+	struct rtio_sqe *sqe;
+	struct rtio_cqe *cqe;
+	int res;
+
+	for (int i = 0; i < sizeof(data); i++) {
+		data[i] = i;
+	}
+
+	sqe = rtio_sqe_acquire(&r_readv);
+	zassert_not_null(sqe, "Expected a valid sqe");
+	rtio_sqe_prep_readv(sqe, (struct rtio_iodev *)&iodev_test_simple, 0, iov,
+			    ARRAY_SIZE(iov), data);
+
+	res = rtio_submit(&r_readv, 1);
+	zassert_ok(res, "Should return ok from rtio_submit");
+
+	cqe = rtio_cqe_consume(&r_readv);
+	zassert_not_null(cqe, "Expected a valid cqe");
+	zassert_ok(cqe->result, "Result should be ok");
+	rtio_cqe_release(&r_readv, cqe);
+
+	zassert_mem_equal(seg0, &data[0], sizeof(seg0), "First segment mismatch");
+	zassert_mem_equal(seg1, &data[sizeof(seg0)], sizeof(seg1), "Second segment mismatch");
+}
+
+#if CONFIG_RTIO_REGISTERED_BUFFERS > 0
+#define REGISTERED_BUF_SIZE 8
+
+RTIO_BMEM uint8_t registered_bufs[2][REGISTERED_BUF_SIZE];
+RTIO_BMEM uint8_t registered_data[2 * REGISTERED_BUF_SIZE];
+
+RTIO_DEFINE(r_registered, SQE_POOL_SIZE, CQE_POOL_SIZE);
+
+/**
+ * @brief Test scatter reads into registered buffers, from user mode if enabled
+ */
+ZTEST_USER(rtio_api, test_rtio_registered_buffers)
+{
+	struct rtio_iovec bufs[CONFIG_RTIO_REGISTERED_BUFFERS + 1];
+	struct rtio_sqe sqe;
+	struct rtio_cqe cqe;
+	int res;
+
+	for (int i = 0; i < ARRAY_SIZE(bufs); i++) {
+		bufs[i].buf = registered_bufs[i % 2];
+		bufs[i].buf_len = REGISTERED_BUF_SIZE;
+	}
+
+	res = rtio_register_buffers(&r_registered, bufs, ARRAY_SIZE(bufs));
+	zassert_equal(res, -ENOMEM, "Expected registering too many buffers to fail");
+
+	res = rtio_register_buffers(&r_registered, bufs, 2);
+	zassert_ok(res, "Expected registering buffers to succeed");
+
+	for (int run = 0; run < TEST_REPEATS; run++) {
+		for (int i = 0; i < sizeof(registered_data); i++) {
+			registered_data[i] = i + run;
+		}
+
+		rtio_sqe_prep_readv_registered(&sqe, &iodev_test_syscall, 0, 0, 2,
+					       registered_data);
+		res = rtio_sqe_copy_in(&r_registered, &sqe, 1);
+		zassert_ok(res, "Expected success copying sqe");
+
+		res = rtio_submit(&r_registered, 1);
+		zassert_ok(res, "Should return ok from rtio_submit");
+
+		res = rtio_cqe_copy_out(&r_registered, &cqe, 1, K_FOREVER);
+		zassert_equal(res, 1, "Expected success copying cqe");
+		zassert_ok(cqe.result, "Result should be ok");
+		zassert_equal_ptr(cqe.userdata, registered_data, "Expected userdata back");
+
+		zassert_mem_equal(registered_bufs, registered_data, sizeof(registered_data),
+				  "Data expected to be scattered over the registered buffers");
+	}
+
+	res = rtio_register_buffers(&r_registered, NULL, 0);
+	zassert_ok(res, "Expected unregistering buffers to succeed");
+}
+#endif /* CONFIG_RTIO_REGISTERED_BUFFERS > 0 */
+
 static void *rtio_api_setup(void)
 {
 #ifdef CONFIG_USERSPACE
@@ -945,6 +1142,9 @@ static void rtio_api_before(void *a)
 	k_mem_domain_add_thread(&rtio_domain, k_current_get());
 	rtio_access_grant(&r_simple, k_current_get());
 	rtio_access_grant(&r_syscall, k_current_get());
+#if CONFIG_RTIO_REGISTERED_BUFFERS > 0
+	rtio_access_grant(&r_registered, k_current_get());
+#endif
 	k_object_access_grant(&iodev_test_simple, k_current_get());
 	k_object_access_grant(&iodev_test_syscall, k_current_get());
 #endif
@@ -474,6 +474,48 @@ ZTEST(settings_functional, test_direct_loading)
 	settings_deregister(&val123_settings);
 }
 
+#ifdef CONFIG_SETTINGS_DEFERRED_LOAD
+ZTEST(settings_functional, test_deferred_loading)
+{
+	int rc;
+	uint8_t val;
+
+	settings_subsys_init();
+	val = 41;
+	settings_save_one("ps/val1", &val, sizeof(uint8_t));
+	val = 42;
+	settings_save_one("val/2", &val, sizeof(uint8_t));
+
+	rc = settings_register(&val1_settings);
+	zassert_true(rc == 0, "register of val1 settings failed");
+	rc = settings_register(&val123_settings);
+	zassert_true(rc == 0, "register of val123 settings failed");
+	memset(&data, 0, sizeof(data));
+
+	rc = settings_load_defer("val");
+	zassert_true(rc == 0, "settings_load_defer failed");
+
+	/* Deferred subtree is loaded after the test thread yields */
+	rc = settings_load();
+	zassert_true(rc == 0, "settings_load failed");
+	zassert_equal(1, data.val1, "val1 settings not loaded");
+	zassert_false(data.en2, "deferred subtree loaded by settings_load");
+
+	rc = settings_load_deferred_wait(K_SECONDS(1));
+	zassert_true(rc == 0, "deferred loading did not complete");
+	zassert_equal(42, data.val2);
+
+	/* Subtree is loaded by settings_load once deferred loading is done */
+	memset(&data, 0, sizeof(data));
+	rc = settings_load();
+	zassert_true(rc == 0, "settings_load failed");
+	zassert_equal(42, data.val2);
+
+	settings_deregister(&val1_settings);
+	settings_deregister(&val123_settings);
+}
+#endif /* CONFIG_SETTINGS_DEFERRED_LOAD */
+
 struct test_loading_data {
 	const char *n;
 	const char *v;
@@ -126,6 +126,15 @@ ZTEST(settings_perf, test_performance)
 	err = k_sem_take(&waitfor_work, K_SECONDS(TEST_TIMEOUT_SEC));
 	zassert_equal(err, 0, "k_sem_take failed %d", err);
 
+	/* benchmark loading of the stored entries, as done on boot */
+	int64_t ts = k_uptime_get();
+
+	err = settings_load();
+	zassert_equal(err, 0, "settings_load failed %d", err);
+
+	printk("*** loading of %u entries completed in %u ms ***\n",
+	       ARRAY_SIZE(test_settings), (uint32_t)k_uptime_delta(&ts));
+
 	if (IS_ENABLED(CONFIG_BT)) {
 		err = bt_le_scan_stop();
 		zassert_equal(err, 0, "Scanning failed to stop (err %d)\n", err);
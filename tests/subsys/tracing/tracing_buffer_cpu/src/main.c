@@ -0,0 +1,183 @@
+/*
+ * Copyright (c) 2025 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <string.h>
+#include <zephyr/ztest.h>
+#include <zephyr/kernel.h>
+#include <tracing_core.h>
+#include <tracing_buffer.h>
+#include <zephyr/tracing/tracing_format.h>
+
+/* Output of the RAM backend. */
+extern uint8_t ram_tracing[CONFIG_RAM_TRACING_BUFFER_SIZE];
+
+#define MARKER_MAGIC "tbc"
+#define MARKER_MAX 4096
+
+/* Markers are told apart from the events of the kernel by the magic. */
+struct test_marker {
+	char magic[4];
+	uint32_t seq;
+};
+
+static uint32_t markers[MARKER_MAX];
+
+static void markers_put(uint32_t first, uint32_t cnt)
+{
+	for (uint32_t i = 0; i < cnt; i++) {
+		struct test_marker marker = { .magic = MARKER_MAGIC, .seq = first + i };
+
+		tracing_format_raw_data((uint8_t *)&marker, sizeof(marker));
+	}
+}
+
+/* Wait for tracing thread to output buffered packets. */
+static void markers_output(void)
+{
+	if (IS_ENABLED(CONFIG_TRACING_OVERFLOW_OVERWRITE)) {
+		tracing_flush();
+	}
+
+	k_sleep(K_MSEC(2 * CONFIG_TRACING_THREAD_WAIT_THRESHOLD));
+
+	if (!is_tracing_enabled()) {
+		uint8_t cmd[] = "enable";
+
+		tracing_cmd_handle(cmd, sizeof(cmd));
+	}
+}
+
+/* Get markers in range [first, first + cnt) in order of output. */
+static uint32_t markers_get(uint32_t first, uint32_t cnt)
+{
+	uint32_t found = 0;
+
+	for (size_t i = 0; i + sizeof(struct test_marker) <= sizeof(ram_tracing); i++) {
+		struct test_marker marker;
+
+		if (memcmp(&ram_tracing[i], MARKER_MAGIC, sizeof(marker.magic)) != 0) {
+			continue;
+		}
+
+		memcpy(&marker, &ram_tracing[i], sizeof(marker));
+		if ((marker.seq >= first) && (marker.seq - first < cnt) && (found < MARKER_MAX)) {
+			markers[found++] = marker.seq;
+		}
+	}
+
+	return found;
+}
+
+static void markers_check_contiguous(uint32_t found)
+{
+	for (uint32_t i = 1; i < found; i++) {
+		zassert_equal(markers[i], markers[i - 1] + 1,
+			      "Marker %u follows marker %u", markers[i], markers[i - 1]);
+	}
+}
+
+ZTEST(tracing_buffer_cpu, test_output_order)
+{
+	const uint32_t first = 0x10000;
+	const uint32_t cnt = 32;
+	uint32_t found;
+
+	markers_put(first, cnt);
+	markers_output();
+
+	found = markers_get(first, cnt);
+	zassert_equal(found, cnt, "Got %u markers", found);
+	zassert_equal(markers[0], first);
+	markers_check_contiguous(found);
+}
+
+ZTEST(tracing_buffer_cpu, test_overflow)
+{
+	const uint32_t first = 0x20000;
+	/* Enough to fill the buffer several times over, packets have a header. */
+	const uint32_t cnt = 2 * CONFIG_TRACING_BUFFER_SIZE / sizeof(struct test_marker);
+	uint32_t found;
+
+	/* The tracing thread drains the buffers concurrently from another CPU */
+	Z_TEST_SKIP_IFDEF(CONFIG_SMP);
+
+	zassert_true(cnt <= MARKER_MAX);
+
+	markers_put(first, cnt);
+	zassert_equal(is_tracing_enabled(), !IS_ENABLED(CONFIG_TRACING_OVERFLOW_STOP),
+		      "Unexpected tracing state after overflow");
+	markers_output();
+
+	found = markers_get(first, cnt);
+	zassert_true((found > 0) && (found < cnt), "Got %u markers", found);
+	markers_check_contiguous(found);
+
+	if (IS_ENABLED(CONFIG_TRACING_OVERFLOW_OVERWRITE)) {
+		/* Flight recorder keeps the latest packets. */
+		zassert_equal(markers[found - 1], first + cnt - 1);
+	} else {
+		/* Packets put after the buffer got full are lost. */
+		zassert_equal(markers[0], first);
+	}
+}
+
+#if defined(CONFIG_SMP) && defined(CONFIG_SCHED_CPU_MASK)
+#define CPU_MARKERS 32
+#define CPU_STACK_SIZE 1024
+
+static struct k_thread cpu_threads[CONFIG_MP_MAX_NUM_CPUS];
+static K_THREAD_STACK_ARRAY_DEFINE(cpu_stacks, CONFIG_MP_MAX_NUM_CPUS, CPU_STACK_SIZE);
+
+static void cpu_markers_entry(void *p1, void *p2, void *p3)
+{
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	markers_put(POINTER_TO_UINT(p1), CPU_MARKERS);
+}
+
+ZTEST(tracing_buffer_cpu, test_cpu_buffers)
+{
+	const uint32_t first = 0x30000;
+	unsigned int num_cpus = arch_num_cpus();
+
+	/* Each CPU puts to its own buffer at the same time */
+	for (unsigned int cpu = 0; cpu < num_cpus; cpu++) {
+		k_thread_create(&cpu_threads[cpu], cpu_stacks[cpu], CPU_STACK_SIZE,
+				cpu_markers_entry, UINT_TO_POINTER(first + cpu * CPU_MARKERS),
+				NULL, NULL, K_PRIO_PREEMPT(1), 0, K_FOREVER);
+		zassert_ok(k_thread_cpu_pin(&cpu_threads[cpu], cpu));
+	}
+
+	for (unsigned int cpu = 0; cpu < num_cpus; cpu++) {
+		k_thread_start(&cpu_threads[cpu]);
+	}
+
+	for (unsigned int cpu = 0; cpu < num_cpus; cpu++) {
+		zassert_ok(k_thread_join(&cpu_threads[cpu], K_SECONDS(1)));
+	}
+
+	markers_output();
+
+	/* Nothing is lost and the packets of every CPU keep their order */
+	for (unsigned int cpu = 0; cpu < num_cpus; cpu++) {
+		uint32_t found = markers_get(first + cpu * CPU_MARKERS, CPU_MARKERS);
+
+		zassert_equal(found, CPU_MARKERS, "Got %u markers of CPU %u", found, cpu);
+		markers_check_contiguous(found);
+	}
+}
+#endif /* CONFIG_SMP && CONFIG_SCHED_CPU_MASK */
+
+static void tracing_buffer_cpu_before(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	/* Start with empty buffers and tracing enabled. */
+	markers_output();
+}
+
+ZTEST_SUITE(tracing_buffer_cpu, NULL, NULL, tracing_buffer_cpu_before, NULL, NULL);
@@ -0,0 +1,234 @@
+/*
+ * Copyright (c) 2025 The Zephyr Project Contributors
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/zbus/zbus.h>
+#include <zephyr/ztest.h>
+#include <zephyr/ztest_assert.h>
+
+#define TEST_MSG_COUNT 16
+#define SLOW_LISTENER_MS 50
+
+struct sample {
+	uint32_t seq;
+	uint8_t payload[124];
+};
+
+/* More messages than the heap can queue, whatever the allocation overhead */
+#define TEST_QUEUE_MAX (CONFIG_ZBUS_ASYNC_DISPATCH_HEAP_SIZE / sizeof(struct sample) + 1)
+
+BUILD_ASSERT(CONFIG_ZBUS_ASYNC_DISPATCH_HEAP_SIZE >= 2 * TEST_MSG_COUNT * sizeof(struct sample),
+	     "The heap must queue TEST_MSG_COUNT messages with room for the allocation overhead");
+
+static uint32_t received[TEST_QUEUE_MAX];
+static size_t received_count;
+static k_tid_t listener_thread;
+static bool slow_listener;
+static bool gate_closed;
+static K_SEM_DEFINE(gate, 0, 1);
+static K_SEM_DEFINE(delivered, 0, TEST_QUEUE_MAX);
+
+static void listener_cb(const struct zbus_channel *chan)
+{
+	const struct sample *msg = zbus_chan_const_msg(chan);
+
+	if (gate_closed) {
+		(void)k_sem_take(&gate, K_FOREVER);
+	}
+
+	if (slow_listener) {
+		k_busy_wait(SLOW_LISTENER_MS * USEC_PER_MSEC);
+	}
+
+	listener_thread = k_current_get();
+	if (received_count < ARRAY_SIZE(received)) {
+		received[received_count++] = msg->seq;
+	}
+
+	k_sem_give(&delivered);
+}
+
+ZBUS_LISTENER_DEFINE(lis, listener_cb);
+
+ZBUS_CHAN_DEFINE(sample_chan, struct sample, NULL, NULL, ZBUS_OBSERVERS(lis),
+		 ZBUS_MSG_INIT(0));
+
+static struct zbus_async_metrics last_metrics;
+static size_t metrics_count;
+
+static void metrics_cb(const struct zbus_channel *chan)
+{
+	const struct zbus_async_metrics *metrics = zbus_chan_const_msg(chan);
+
+	last_metrics = *metrics;
+	metrics_count++;
+}
+
+ZBUS_LISTENER_DEFINE(metrics_lis, metrics_cb);
+
+static int publish(uint32_t seq)
+{
+	struct sample msg = {.seq = seq};
+
+	return zbus_chan_pub(&sample_chan, &msg, K_NO_WAIT);
+}
+
+static void open_gate(void)
+{
+	gate_closed = false;
+	k_sem_give(&gate);
+}
+
+static void wait_delivered(size_t count)
+{
+	for (size_t i = 0; i < count; i++) {
+		zassert_equal(k_sem_take(&delivered, K_SECONDS(1)), 0, "Message %zu not delivered",
+			      i);
+	}
+}
+
+/* The dispatcher dequeues a message only after notifying the listener */
+static void wait_idle(void)
+{
+	for (int i = 0; i < 100 && sample_chan.data->async_pending > 0; i++) {
+		k_msleep(1);
+	}
+
+	zassert_equal(sample_chan.data->async_pending, 0, "Messages left in the queue");
+}
+
+static void assert_received_in_order(size_t count)
+{
+	zassert_equal(received_count, count, "Received %zu messages, expected %zu",
+		      received_count, count);
+	for (size_t i = 0; i < count; i++) {
+		zassert_equal(received[i], i + 1, "Message %zu out of order (%u)", i, received[i]);
+	}
+}
+
+static void async_dispatch_before(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	received_count = 0;
+	slow_listener = false;
+	gate_closed = false;
+	k_sem_reset(&gate);
+	k_sem_reset(&delivered);
+
+	zassert_equal(zbus_chan_set_async_dispatch(&sample_chan, true), 0);
+}
+
+ZTEST(async_dispatch, test_publish_does_not_wait)
+{
+	int64_t start;
+
+	slow_listener = true;
+
+	start = k_uptime_get();
+	zassert_equal(publish(1), 0);
+	zassert_true(k_uptime_get() - start < SLOW_LISTENER_MS, "Publish waited for the listener");
+
+	wait_delivered(1);
+	assert_received_in_order(1);
+	zassert_not_equal(listener_thread, k_current_get(), "Listener ran on the publisher");
+}
+
+ZTEST(async_dispatch, test_order_preserved)
+{
+	gate_closed = true;
+
+	for (uint32_t seq = 1; seq <= TEST_MSG_COUNT; seq++) {
+		zassert_equal(publish(seq), 0);
+	}
+
+	/* Nothing delivered yet, the messages only wait in the queue */
+	zassert_equal(received_count, 0);
+
+	open_gate();
+	wait_delivered(TEST_MSG_COUNT);
+	assert_received_in_order(TEST_MSG_COUNT);
+}
+
+ZTEST(async_dispatch, test_disable_keeps_order)
+{
+	gate_closed = true;
+
+	zassert_equal(publish(1), 0);
+	zassert_equal(publish(2), 0);
+
+	zassert_equal(zbus_chan_set_async_dispatch(&sample_chan, false), 0);
+	zassert_false(zbus_chan_is_async_dispatch(&sample_chan));
+
+	/* Queued behind the pending messages instead of overtaking them */
+	zassert_equal(publish(3), 0);
+	zassert_equal(received_count, 0);
+
+	open_gate();
+	wait_delivered(3);
+	wait_idle();
+	assert_received_in_order(3);
+
+	/* Back to synchronous publishing once the queue is empty */
+	zassert_equal(publish(4), 0);
+	zassert_equal(received_count, 4);
+	zassert_equal(listener_thread, k_current_get());
+}
+
+ZTEST(async_dispatch, test_queue_full)
+{
+	uint32_t seq;
+	int err = 0;
+
+	gate_closed = true;
+
+	for (seq = 1; seq <= TEST_QUEUE_MAX; seq++) {
+		err = publish(seq);
+		if (err) {
+			break;
+		}
+	}
+
+	zassert_equal(err, -ENOMEM, "Publishing never ran out of queue space");
+	zassert_true(seq > 1, "No message was queued");
+
+	/* The rejected message is not dispatched */
+	open_gate();
+	wait_delivered(seq - 1);
+	zassert_equal(k_sem_take(&delivered, K_MSEC(100)), -EAGAIN);
+	assert_received_in_order(seq - 1);
+}
+
+ZTEST(async_dispatch, test_metrics)
+{
+	static struct zbus_observer_node node;
+
+	zassert_equal(zbus_chan_set_async_dispatch(&zbus_async_metrics_chan, true), -EINVAL);
+	zassert_equal(zbus_chan_add_obs(&zbus_async_metrics_chan, &metrics_lis, &node, K_MSEC(200)),
+		      0);
+
+	metrics_count = 0;
+	slow_listener = true;
+
+	zassert_equal(publish(1), 0);
+	zassert_equal(publish(2), 0);
+	wait_delivered(2);
+	/* The metrics are published right after the notification */
+	k_msleep(10);
+
+	zassert_equal(metrics_count, 2);
+	zassert_equal(last_metrics.chan, &sample_chan);
+	zassert_equal(last_metrics.err, 0);
+	zassert_equal(last_metrics.pending, 0);
+	zassert_true(last_metrics.count >= 2);
+	zassert_true(last_metrics.dispatch_us >= SLOW_LISTENER_MS * USEC_PER_MSEC,
+		     "Dispatch took %u us", last_metrics.dispatch_us);
+	/* The second message waited for the slow listener to handle the first one */
+	zassert_true(last_metrics.latency_us >= SLOW_LISTENER_MS * USEC_PER_MSEC,
+		     "Latency was %u us", last_metrics.latency_us);
+
+	zassert_equal(zbus_chan_rm_obs(&zbus_async_metrics_chan, &metrics_lis, K_MSEC(200)), 0);
+}
+
+ZTEST_SUITE(async_dispatch, NULL, NULL, async_dispatch_before, NULL, NULL);
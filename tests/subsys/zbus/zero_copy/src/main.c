@@ -0,0 +1,228 @@
+/*
+ * Copyright (c) 2025 The Zephyr Project Contributors
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/zbus/zbus.h>
+#include <zephyr/ztest.h>
+#include <zephyr/ztest_assert.h>
+
+#define TEST_BUF_COUNT 3
+
+struct image_meta {
+	uint32_t seq;
+	uint8_t payload[256];
+	uint32_t check;
+};
+
+static uint32_t listener_seq;
+
+static bool meta_validator(const void *msg, size_t msg_size)
+{
+	const struct image_meta *meta = msg;
+
+	ARG_UNUSED(msg_size);
+
+	return meta->check == ~meta->seq;
+}
+
+static void listener_cb(const struct zbus_channel *chan)
+{
+	const struct image_meta *meta = zbus_chan_const_msg(chan);
+
+	listener_seq = meta->seq;
+}
+
+ZBUS_LISTENER_DEFINE(lis, listener_cb);
+
+ZBUS_CHAN_DEFINE_ZERO_COPY(meta_chan, struct image_meta, meta_validator, NULL, TEST_BUF_COUNT,
+			   ZBUS_OBSERVERS(lis), ZBUS_MSG_INIT(.seq = 0, .check = ~0U));
+
+ZBUS_CHAN_DEFINE(regular_chan, struct image_meta, NULL, NULL, ZBUS_OBSERVERS_EMPTY,
+		 ZBUS_MSG_INIT(0));
+
+static void meta_fill(struct image_meta *meta, uint32_t seq)
+{
+	meta->seq = seq;
+	memset(meta->payload, (uint8_t)seq, sizeof(meta->payload));
+	meta->check = ~seq;
+}
+
+static void meta_assert(const struct image_meta *meta, uint32_t seq)
+{
+	zassert_equal(meta->seq, seq, "Expected message %u, got %u", seq, meta->seq);
+	zassert_equal(meta->check, ~seq);
+	for (size_t i = 0; i < sizeof(meta->payload); i++) {
+		zassert_equal(meta->payload[i], (uint8_t)seq, "Torn message %u", seq);
+	}
+}
+
+static void publish(uint32_t seq)
+{
+	struct image_meta meta;
+
+	meta_fill(&meta, seq);
+	zassert_equal(zbus_chan_pub(&meta_chan, &meta, K_NO_WAIT), 0);
+}
+
+static void zero_copy_before(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	/* Leave no message borrowed from a failed test behind */
+	for (int i = 0; i < TEST_BUF_COUNT; i++) {
+		atomic_clear(&meta_chan.data->zc_refs[i]);
+	}
+
+	publish(1);
+}
+
+ZTEST(zero_copy, test_borrow_latest)
+{
+	const struct image_meta *first, *second;
+	struct image_meta copy;
+
+	zassert_true(zbus_chan_is_zero_copy(&meta_chan));
+	zassert_false(zbus_chan_is_zero_copy(&regular_chan));
+
+	zassert_equal(zbus_chan_borrow(&meta_chan, (const void **)&first), 0);
+	meta_assert(first, 1);
+
+	/* Borrowed messages are left alone by later publishes */
+	publish(2);
+	meta_assert(first, 1);
+
+	zassert_equal(zbus_chan_borrow(&meta_chan, (const void **)&second), 0);
+	zassert_not_equal(first, second);
+	meta_assert(second, 2);
+
+	zassert_equal(zbus_chan_read(&meta_chan, &copy, K_NO_WAIT), 0);
+	meta_assert(&copy, 2);
+	zassert_equal(listener_seq, 2);
+
+	zassert_equal(zbus_chan_release(&meta_chan, first), 0);
+	zassert_equal(zbus_chan_release(&meta_chan, second), 0);
+
+	zassert_equal(zbus_chan_release(&meta_chan, &copy), -EINVAL);
+	zassert_equal(zbus_chan_borrow(&regular_chan, (const void **)&first), -ENOTSUP);
+
+	/* A claim would let the borrowed message change in place */
+	zassert_equal(zbus_chan_claim(&meta_chan, K_NO_WAIT), -ENOTSUP);
+}
+
+ZTEST(zero_copy, test_buffers_exhausted)
+{
+	uint32_t count = zbus_chan_pub_stats_count(&meta_chan);
+	const struct image_meta *first, *second;
+	struct image_meta meta;
+
+	zassert_equal(zbus_chan_borrow(&meta_chan, (const void **)&first), 0);
+	publish(2);
+	zassert_equal(zbus_chan_borrow(&meta_chan, (const void **)&second), 0);
+	publish(3);
+
+	/* One buffer borrowed, one borrowed and latest, one latest */
+	meta_fill(&meta, 4);
+	zassert_equal(zbus_chan_pub(&meta_chan, &meta, K_NO_WAIT), -ENOBUFS);
+
+	zassert_equal(zbus_chan_release(&meta_chan, first), 0);
+	zassert_equal(zbus_chan_pub(&meta_chan, &meta, K_NO_WAIT), 0);
+	meta_assert(second, 2);
+
+	zassert_equal(zbus_chan_release(&meta_chan, second), 0);
+	/* The failed publish is not counted */
+	zassert_equal(zbus_chan_pub_stats_count(&meta_chan), count + 3);
+}
+
+ZTEST(zero_copy, test_loan_commit)
+{
+	struct image_meta *loaned;
+	const struct image_meta *latest;
+	struct image_meta copy;
+
+	zassert_equal(zbus_chan_loan(&meta_chan, (void **)&loaned, K_NO_WAIT), 0);
+	meta_fill(loaned, 2);
+
+	/* The channel is locked for other publishers, readers see the previous message */
+	meta_fill(&copy, 9);
+	zassert_equal(zbus_chan_pub(&meta_chan, &copy, K_NO_WAIT), -EBUSY);
+	zassert_equal(zbus_chan_read(&meta_chan, &copy, K_NO_WAIT), 0);
+	meta_assert(&copy, 1);
+
+	zassert_equal(zbus_chan_commit(&meta_chan, loaned, K_NO_WAIT), 0);
+	zassert_equal(listener_seq, 2);
+
+	zassert_equal(zbus_chan_borrow(&meta_chan, (const void **)&latest), 0);
+	zassert_equal(latest, loaned, "Committed message was copied");
+	zassert_equal(zbus_chan_release(&meta_chan, latest), 0);
+
+	/* Canceled and invalid messages are not published */
+	zassert_equal(zbus_chan_loan(&meta_chan, (void **)&loaned, K_NO_WAIT), 0);
+	meta_fill(loaned, 3);
+	zassert_equal(zbus_chan_loan_cancel(&meta_chan, loaned), 0);
+
+	zassert_equal(zbus_chan_loan(&meta_chan, (void **)&loaned, K_NO_WAIT), 0);
+	meta_fill(loaned, 4);
+	loaned->check = 0;
+	zassert_equal(zbus_chan_commit(&meta_chan, loaned, K_NO_WAIT), -ENOMSG);
+
+	zassert_equal(zbus_chan_read(&meta_chan, &copy, K_NO_WAIT), 0);
+	meta_assert(&copy, 2);
+	zassert_equal(listener_seq, 2);
+
+	zassert_equal(zbus_chan_loan(&regular_chan, (void **)&loaned, K_NO_WAIT), -ENOTSUP);
+}
+
+#define READER_STACK_SIZE 1024
+#define READER_ROUNDS     200
+
+static K_THREAD_STACK_DEFINE(reader_stack, READER_STACK_SIZE);
+static struct k_thread reader_thread;
+static volatile bool reader_stop;
+
+static void reader_entry(void *p1, void *p2, void *p3)
+{
+	ARG_UNUSED(p1);
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	while (!reader_stop) {
+		const struct image_meta *meta;
+
+		zassert_equal(zbus_chan_borrow(&meta_chan, (const void **)&meta), 0);
+		k_yield();
+		meta_assert(meta, meta->seq);
+		zassert_equal(zbus_chan_release(&meta_chan, meta), 0);
+		k_yield();
+	}
+}
+
+ZTEST(zero_copy, test_concurrent_readers)
+{
+	uint32_t seq = 2;
+
+	reader_stop = false;
+	k_thread_create(&reader_thread, reader_stack, K_THREAD_STACK_SIZEOF(reader_stack),
+			reader_entry, NULL, NULL, NULL, k_thread_priority_get(k_current_get()), 0,
+			K_NO_WAIT);
+
+	for (int i = 0; i < READER_ROUNDS; i++) {
+		struct image_meta meta;
+		int err;
+
+		meta_fill(&meta, seq);
+		err = zbus_chan_pub(&meta_chan, &meta, K_NO_WAIT);
+		zassert_true(err == 0 || err == -ENOBUFS, "Publish failed: %d", err);
+		if (err == 0) {
+			seq++;
+		}
+		k_yield();
+	}
+
+	reader_stop = true;
+	zassert_equal(k_thread_join(&reader_thread, K_SECONDS(1)), 0);
+
+	zassert_true(seq > 2, "Nothing was published");
+}
+
+ZTEST_SUITE(zero_copy, NULL, NULL, zero_copy_before, NULL, NULL);